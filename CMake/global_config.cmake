@@ -53,6 +53,10 @@ macro(global_set_flags)
         add_definitions(-DRS2_USE_CUDA)
     endif()
 
+    if (BUILD_WITH_LIBJPEG_TURBO)
+        add_definitions(-DRS2_USE_LIBJPEG_TURBO)
+    endif()
+
     if (BUILD_SHARED_LIBS)
         add_definitions(-DBUILD_SHARED_LIBS)
     endif()
@@ -95,6 +99,16 @@ macro(global_target_config)
             $<INSTALL_INTERFACE:include>
             PRIVATE ${USB_INCLUDE_DIRS}
     )
+
+    if(BUILD_WITH_LIBJPEG_TURBO)
+        add_dependencies(${LRS_TARGET} libjpeg-turbo)
+        target_include_directories(${LRS_TARGET} PRIVATE ${CMAKE_BINARY_DIR}/libjpeg-turbo/include)
+        if(WIN32)
+            target_link_libraries(${LRS_TARGET} PRIVATE ${CMAKE_BINARY_DIR}/libjpeg-turbo/lib/jpeg-static.lib)
+        else()
+            target_link_libraries(${LRS_TARGET} PRIVATE ${CMAKE_BINARY_DIR}/libjpeg-turbo/lib/libjpeg.a)
+        endif()
+    endif()
 endmacro()
 
 macro(add_tm2)
@@ -28,6 +28,7 @@ option(IMPORT_DEPTH_CAM_FW "Download the latest firmware for the depth cameras"
 option(BUILD_CV_KINFU_EXAMPLE "Build OpenCV KinectFusion example" OFF)
 option(FORCE_RSUSB_BACKEND "Use RS USB backend, mandatory for Win7/MacOS/Android, optional for Linux" OFF)
 option(BUILD_NETWORK_DEVICE "Build Network Device support" OFF)
+option(BUILD_WITH_LIBJPEG_TURBO "Decode MJPEG streams with libjpeg-turbo, downloaded and built as part of the build" OFF)
 option(FORCE_LIBUVC "Explicitly turn-on libuvc backend - deprecated, use FORCE_RSUSB_BACKEND instead" OFF)
 option(FORCE_WINUSB_UVC "Explicitly turn-on winusb_uvc (for win7) backend - deprecated, use FORCE_RSUSB_BACKEND instead" OFF)
 option(ANDROID_USB_HOST_UVC "Build UVC backend for Android - deprecated, use FORCE_RSUSB_BACKEND instead" OFF)
\ No newline at end of file
@@ -353,6 +353,27 @@ rs2_raw_data_buffer* rs2_serialize_json(rs2_device* dev, rs2_error** error);
 /* Load JSON and apply advanced-mode controls */
 void rs2_load_json(rs2_device* dev, const void* json_content, unsigned content_size, rs2_error** error);
 
+/** \brief Quality of the synchronization of a device clock to the host clock, for devices that support RS2_EXTENSION_GLOBAL_TIMER */
+typedef struct rs2_global_time_stats
+{
+    unsigned long long updates;     /**< Number of device clock samples taken since the device was opened */
+    unsigned long long failures;    /**< Number of device clock samples that failed or took too long, and were skipped */
+    unsigned long long resets;      /**< Number of times the device clock wrapped around and the fit was restarted */
+    int                samples;     /**< Number of recent samples the linear fit is currently based on */
+    double             drift_ppm;   /**< Drift of the device clock relative to the host clock, in parts per million */
+    double             offset;      /**< Host time minus device time at the last sample, in milliseconds */
+    double             residual;    /**< Host time at the last sample minus the host time the fit predicted for it, in milliseconds */
+    double             last_update; /**< Host time of the last sample, in milliseconds since the epoch, 0 before the first one */
+} rs2_global_time_stats;
+
+/**
+* Retrieve the statistics of the synchronization of the device clock to the host clock, which global timestamps rely on
+* \param[in]  device    Device that supports RS2_EXTENSION_GLOBAL_TIMER
+* \param[out] stats     Receives the statistics
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_global_time_stats(const rs2_device* device, rs2_global_time_stats* stats, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
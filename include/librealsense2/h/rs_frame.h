@@ -66,6 +66,14 @@ typedef enum rs2_frame_metadata_value
 const char* rs2_frame_metadata_to_string(rs2_frame_metadata_value metadata);
 const char* rs2_frame_metadata_value_to_string(rs2_frame_metadata_value metadata);
 
+/** \brief Flags selecting what rs2_export_to_ply_ex and rs2_export_to_ply_fd write, combined with bitwise OR. Zero exports the vertices only. */
+typedef enum rs2_ply_export_flags
+{
+    RS2_PLY_EXPORT_MESH     = 1 << 0, /**< Triangulate neighbouring vertices of similar depth into faces */
+    RS2_PLY_EXPORT_NORMALS  = 1 << 1, /**< Per-vertex normals, averaged over the adjacent faces. Requires RS2_PLY_EXPORT_MESH */
+    RS2_PLY_EXPORT_PARALLEL = 1 << 2  /**< Build the file on the processing threads (see rs2_set_processing_threads) */
+} rs2_ply_export_flags;
+
 /**
 * retrieve metadata from frame handle
 * \param[in] frame      handle returned from a callback
@@ -84,6 +92,17 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 */
 int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* retrieve all the metadata attributes the frame supports, decoding the metadata of the frame in a single pass
+* \param[in] frame          handle returned from a callback
+* \param[out] attributes    receives the supported attributes, in ascending order
+* \param[out] values        receives the value of each of the attributes
+* \param[in] capacity       number of elements the attributes and values arrays can hold, RS2_FRAME_METADATA_COUNT is always enough
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                   the number of supported attributes, only the first capacity of which are written
+*/
+int rs2_get_frame_metadata_all(const rs2_frame* frame, rs2_frame_metadata_value* attributes, rs2_metadata_type* values, int capacity, rs2_error** error);
+
 /**
 * retrieve timestamp domain from frame handle. timestamps can only be comparable if they are in common domain
 * (for example, depth timestamp might come from system time while color timestamp might come from the device)
@@ -213,6 +232,29 @@ rs2_vertex* rs2_get_frame_vertices(const rs2_frame* frame, rs2_error** error);
 */
 void rs2_export_to_ply(const rs2_frame* frame, const char* fname, rs2_frame* texture, rs2_error** error);
 
+/**
+* When called on Points frame type, this method creates a binary ply file of the model with the given file name.
+* \param[in] frame       Points frame
+* \param[in] fname       The name for the ply file
+* \param[in] texture     Texture frame, null to export the vertices without color
+* \param[in] flags       Combination of rs2_ply_export_flags
+* \param[in] threshold   Maximal depth difference, in meters, between the corners of a face of the mesh
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_export_to_ply_ex(const rs2_frame* frame, const char* fname, rs2_frame* texture, int flags, float threshold, rs2_error** error);
+
+/**
+* When called on Points frame type, this method writes a binary ply file of the model to an open file descriptor,
+* such as a pipe or a socket, in a single write. The descriptor is left open.
+* \param[in] frame       Points frame
+* \param[in] fd          File descriptor open for writing
+* \param[in] texture     Texture frame, null to export the vertices without color
+* \param[in] flags       Combination of rs2_ply_export_flags
+* \param[in] threshold   Maximal depth difference, in meters, between the corners of a face of the mesh
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_export_to_ply_fd(const rs2_frame* frame, int fd, rs2_frame* texture, int flags, float threshold, rs2_error** error);
+
 /**
 * When called on Points frame type, this method returns a pointer to an array of texture coordinates per vertex
 * Each coordinate represent a (u,v) pair within [0,1] range, to be mapped to texture image
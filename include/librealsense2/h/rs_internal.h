@@ -215,6 +215,16 @@ void rs2_software_sensor_on_notification(rs2_sensor* sensor, rs2_software_notifi
 */
 void rs2_software_sensor_set_metadata(rs2_sensor* sensor, rs2_frame_metadata_value value, rs2_metadata_type type, rs2_error** error);
 
+/**
+* Set several frame metadata attributes for the upcoming frames in a single call
+* \param[in] sensor the software sensor
+* \param[in] keys   metadata keys to set
+* \param[in] values metadata values, one per key
+* \param[in] count  number of keys and values
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_software_sensor_set_metadata_block(rs2_sensor* sensor, const rs2_frame_metadata_value* keys, const rs2_metadata_type* values, int count, rs2_error** error);
+
 /**
 * set callback to be notified when a specific software device is destroyed
 * \param[in] dev             software device
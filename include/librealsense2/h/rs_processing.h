@@ -118,6 +118,28 @@ void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_fr
 */
 void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_ptr on_frame, void* user, rs2_error** error);
 
+/**
+* Provide the memory for the image frames produced by the processing block.
+* Every video/depth frame allocated by the block will be backed by a buffer obtained from on_allocate,
+* and handed back to on_deallocate once the last reference to the frame is released.
+* If on_allocate returns null, the frame falls back to library-owned memory.
+* Passing null functions restores the default allocator.
+* \param[in] block          Processing block
+* \param[in] on_allocate    function returning a buffer of at least the requested size in bytes
+* \param[in] on_deallocate  function releasing a buffer previously returned by on_allocate
+* \param[in] user           User context for the callbacks (can be anything or null)
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_processing_block_set_frame_allocator(rs2_processing_block* block, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error);
+
+/**
+* Provide the memory for the image frames produced by the processing block, see rs2_processing_block_set_frame_allocator
+* \param[in] block      Processing block
+* \param[in] allocator  allocator object created from c++ application. ownership over the allocator object is moved into the block. null restores the default allocator
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_processing_block_set_frame_allocator_cpp(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error);
+
 /**
 * This method is used to direct the output from the processing block to a dedicated queue object
 * \param[in] block          Processing block
@@ -251,6 +273,19 @@ rs2_processing_block* rs2_create_zero_order_invalidation_block(rs2_error** error
 */
 rs2_processing_block* rs2_create_huffman_depth_decompress_block(rs2_error** error);
 
+/**
+* Creates a processing block chaining the given processing blocks, each one processing the output of the block preceding it.
+* In pipelined mode every block of the chain runs on a dedicated thread and consecutive frames are processed concurrently
+* by the different blocks, while each block still receives the frames one at a time and in order.
+* The output of the chained blocks is taken over by the chain.
+* \param[in] blocks     processing blocks, in processing order
+* \param[in] count      number of processing blocks
+* \param[in] pipelined  non-zero to run the blocks concurrently
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               chain processing block
+*/
+rs2_processing_block* rs2_create_processing_chain(rs2_processing_block** blocks, int count, int pipelined, rs2_error** error);
+
 /**
 * Retrieve processing block specific information, like name.
 * \param[in]  block     The processing block
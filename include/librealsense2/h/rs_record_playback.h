@@ -186,6 +186,39 @@ void rs2_playback_device_set_playback_speed(const rs2_device* device, float spee
 */
 void rs2_playback_device_stop(const rs2_device* device, rs2_error** error);
 
+/**
+* Returns the number of frames recorded in the file for the given stream.
+* The frames are listed by an index stored in the file when the recording was closed; for files without one, the index is
+* built once by scanning the stream.
+* \param[in] device    A playback device
+* \param[in] profile   One of the stream profiles of the playback sensors
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return Number of frames of the stream in the file
+*/
+unsigned long long int rs2_playback_get_frames_count(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error);
+
+/**
+* Reads a frame of the given stream directly by its position in the file, without playing the frames before it.
+* The playback does not need to be streaming, and its position is left unchanged.
+* The returned frame should be released with rs2_release_frame(...)
+* \param[in] device    A playback device
+* \param[in] profile   One of the stream profiles of the playback sensors
+* \param[in] index     Position of the frame in the stream, from 0 to rs2_playback_get_frames_count(...) - 1
+* \param[out] error    If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return The frame
+*/
+rs2_frame* rs2_playback_get_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int index, rs2_error** error);
+
+/**
+* Finds the position in the file of the frame of the given stream having the given frame number
+* \param[in] device        A playback device
+* \param[in] profile       One of the stream profiles of the playback sensors
+* \param[in] frame_number  Frame number, as returned by rs2_get_frame_number(...)
+* \param[out] error        If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return Position of the frame in the stream, to be passed to rs2_playback_get_frame(...)
+*/
+unsigned long long int rs2_playback_find_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int frame_number, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -276,6 +276,28 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 */
 void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notifications_callback* callback, rs2_error** error);
 
+/**
+* Provide the memory for the image frames produced by the sensor.
+* Every video/depth frame delivered by the sensor will be backed by a buffer obtained from on_allocate,
+* and handed back to on_deallocate once the last reference to the frame is released.
+* If on_allocate returns null, the frame falls back to library-owned memory.
+* Must be called while the sensor is not streaming. Passing null functions restores the default allocator.
+* \param[in] sensor          RealSense sensor
+* \param[in] on_allocate     function returning a buffer of at least the requested size in bytes
+* \param[in] on_deallocate   function releasing a buffer previously returned by on_allocate
+* \param[in] user            User context for the callbacks (can be anything or null)
+* \param[out] error          if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error);
+
+/**
+* Provide the memory for the image frames produced by the sensor, see rs2_set_frame_allocator
+* \param[in] sensor     RealSense sensor
+* \param[in] allocator  allocator object created from c++ application. ownership over the allocator object is moved into the relevant sensor. null restores the default allocator
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error);
+
 /**
 * retrieve description from notification handle
 * \param[in] notification      handle returned from a callback
@@ -282,6 +282,32 @@ return results;
         }
     };
 
+    class global_timer : public device
+    {
+    public:
+        global_timer() : device() {}
+        global_timer(device d)
+            : device(d.get())
+        {
+            rs2_error* e = nullptr;
+            if (rs2_is_device_extendable_to(_dev.get(), RS2_EXTENSION_GLOBAL_TIMER, &e) == 0 && !e)
+            {
+                _dev.reset();
+            }
+            error::handle(e);
+        }
+
+        // Statistics of the synchronization of the device clock to the host clock, for monitoring the quality of global timestamps
+        rs2_global_time_stats get_global_time_stats() const
+        {
+            rs2_global_time_stats stats;
+            rs2_error* e = nullptr;
+            rs2_get_global_time_stats(_dev.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+    };
+
     typedef std::vector<uint8_t> calibration_table;
 
     class calibrated_device : public device
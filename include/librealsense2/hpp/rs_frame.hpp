@@ -507,6 +507,23 @@ namespace rs2
             return r != 0;
         }
 
+        /** retrieve all the frame_metadata the frame supports in a single call
+        * \return            the supported frame_metadata and their values, in ascending order of frame_metadata
+        */
+        std::vector<std::pair<rs2_frame_metadata_value, rs2_metadata_type>> get_all_metadata() const
+        {
+            rs2_frame_metadata_value attributes[RS2_FRAME_METADATA_COUNT];
+            rs2_metadata_type values[RS2_FRAME_METADATA_COUNT];
+            rs2_error* e = nullptr;
+            auto count = rs2_get_frame_metadata_all(frame_ref, attributes, values, RS2_FRAME_METADATA_COUNT, &e);
+            error::handle(e);
+
+            std::vector<std::pair<rs2_frame_metadata_value, rs2_metadata_type>> res;
+            for (int i = 0; i < count && i < RS2_FRAME_METADATA_COUNT; ++i)
+                res.emplace_back(attributes[i], values[i]);
+            return res;
+        }
+
         /**
         * retrieve frame number (from frame handle)
         * \return               the frame number of the frame, in milliseconds since the device was started
@@ -762,6 +779,38 @@ namespace rs2
             rs2_export_to_ply(get(), fname.c_str(), ptr, &e);
             error::handle(e);
         }
+
+        /**
+        * Export the point cloud to a binary PLY file
+        * \param[in] string fname - file name of the PLY to be saved
+        * \param[in] video_frame texture - the texture for the PLY, an empty frame for none
+        * \param[in] int flags - combination of rs2_ply_export_flags, zero for the vertices only
+        * \param[in] float threshold - maximal depth difference, in meters, between the corners of a face of the mesh
+        */
+        void export_to_ply(const std::string& fname, video_frame texture, int flags, float threshold = 0.05f)
+        {
+            rs2_frame* ptr = nullptr;
+            std::swap(texture.frame_ref, ptr);
+            rs2_error* e = nullptr;
+            rs2_export_to_ply_ex(get(), fname.c_str(), ptr, flags, threshold, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Write the point cloud as a binary PLY to an open file descriptor (file, pipe or socket), which is left open
+        * \param[in] int fd - file descriptor open for writing
+        * \param[in] video_frame texture - the texture for the PLY, an empty frame for none
+        * \param[in] int flags - combination of rs2_ply_export_flags, zero for the vertices only
+        * \param[in] float threshold - maximal depth difference, in meters, between the corners of a face of the mesh
+        */
+        void export_to_ply(int fd, video_frame texture, int flags, float threshold = 0.05f)
+        {
+            rs2_frame* ptr = nullptr;
+            std::swap(texture.frame_ref, ptr);
+            rs2_error* e = nullptr;
+            rs2_export_to_ply_fd(get(), fd, ptr, flags, threshold, &e);
+            error::handle(e);
+        }
         /**
         * Retrieve the texture coordinates (uv map) for the point cloud
         * \return texture_coordinate* - pointer of texture coordinates.
@@ -1145,5 +1194,26 @@ namespace rs2
 
         void release() override { delete this; }
     };
+
+    template<class A, class D>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;
+        D deallocate_function;
+    public:
+        frame_allocator(A allocate, D deallocate) : allocate_function(allocate), deallocate_function(deallocate) {}
+
+        void* allocate(int size) override
+        {
+            return allocate_function(size);
+        }
+
+        void deallocate(void* buffer, int size) override
+        {
+            deallocate_function(buffer, size);
+        }
+
+        void release() override { delete this; }
+    };
 }
 #endif // LIBREALSENSE_RS2_FRAME_HPP
@@ -184,6 +184,19 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Set several frame metadata attributes for the upcoming frames in a single call
+        * \param[in] keys   metadata keys to set
+        * \param[in] values metadata values, one per key
+        * \param[in] count  number of keys and values
+        */
+        void set_metadata(const rs2_frame_metadata_value* keys, const rs2_metadata_type* values, int count)
+        {
+            rs2_error* e = nullptr;
+            rs2_software_sensor_set_metadata_block(_sensor.get(), keys, values, count, &e);
+            error::handle(e);
+        }
+
         /**
         * Register read-only option that will be supported by the sensor
         *
@@ -260,6 +260,20 @@ namespace rs2
             return on_frame;
         }
         /**
+        * Provide the memory for the image frames produced by the processing block.
+        *
+        * \param[in] allocate     callable returning a buffer of at least the given size in bytes, or nullptr to fall back to library memory
+        * \param[in] deallocate   callable releasing a buffer previously returned by allocate, together with its size
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_processing_block_set_frame_allocator_cpp(get(),
+                new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+        /**
         * Ask processing block to process the frame
         *
         * \param[in] on_frame      frame to be processed.
@@ -1100,5 +1114,31 @@ namespace rs2
             return block;
         }
     };
+
+    class processing_chain : public processing_block
+    {
+    public:
+        /**
+        * Chain processing blocks, each one processing the output of the block preceding it.
+        * The output of the chain is received by starting it, as with any processing block.
+        * \param[in] pipelined  run every block on a dedicated thread, so that consecutive frames are processed concurrently
+        * \param[in] blocks     processing blocks, in processing order. Their output is taken over by the chain
+        */
+        template<class... T>
+        processing_chain(bool pipelined, const T&... blocks)
+            : processing_block(init({ blocks.get()... }, pipelined)) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init(std::vector<rs2_processing_block*> blocks, bool pipelined)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_processing_chain(blocks.data(), static_cast<int>(blocks.size()), pipelined ? 1 : 0, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
 }
 #endif // LIBREALSENSE_RS2_PROCESSING_HPP
@@ -179,6 +179,47 @@ namespace rs2
             rs2_playback_device_stop(_dev.get(), &e);
             error::handle(e);
         }
+
+        /**
+        * Returns the number of frames recorded in the file for the given stream
+        * \param[in] profile   One of the stream profiles of the playback sensors
+        * \return Number of frames of the stream in the file
+        */
+        uint64_t get_frames_count(const stream_profile& profile) const
+        {
+            rs2_error* e = nullptr;
+            uint64_t count = rs2_playback_get_frames_count(_dev.get(), profile.get(), &e);
+            error::handle(e);
+            return count;
+        }
+
+        /**
+        * Reads a frame of the given stream directly by its position in the file, without playing the frames before it
+        * \param[in] profile   One of the stream profiles of the playback sensors
+        * \param[in] index     Position of the frame in the stream, from 0 to get_frames_count(profile) - 1
+        * \return The frame
+        */
+        frame get_frame(const stream_profile& profile, uint64_t index) const
+        {
+            rs2_error* e = nullptr;
+            auto f = rs2_playback_get_frame(_dev.get(), profile.get(), index, &e);
+            error::handle(e);
+            return frame(f);
+        }
+
+        /**
+        * Finds the position in the file of the frame of the given stream having the given frame number
+        * \param[in] profile       One of the stream profiles of the playback sensors
+        * \param[in] frame_number  Frame number, as returned by frame::get_frame_number()
+        * \return Position of the frame in the stream, to be passed to get_frame()
+        */
+        uint64_t find_frame(const stream_profile& profile, unsigned long long frame_number) const
+        {
+            rs2_error* e = nullptr;
+            uint64_t index = rs2_playback_find_frame(_dev.get(), profile.get(), frame_number, &e);
+            error::handle(e);
+            return index;
+        }
     protected:
         friend context;
         explicit playback(std::shared_ptr<rs2_device> dev) : device(dev)
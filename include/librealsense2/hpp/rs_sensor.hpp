@@ -213,6 +213,20 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * provide the memory for the image frames produced by the sensor, must be called while the sensor is not streaming
+        * \param[in] allocate     callable returning a buffer of at least the given size in bytes, or nullptr to fall back to library memory
+        * \param[in] deallocate   callable releasing a buffer previously returned by allocate, together with its size
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(),
+                new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
 
         /**
         * Retrieves the list of stream profiles supported by the sensor.
@@ -73,6 +73,14 @@ struct rs2_playback_status_changed_callback
     virtual                                 ~rs2_playback_status_changed_callback() {}
 };
 
+struct rs2_frame_allocator
+{
+    virtual void*                           allocate(int size) = 0;
+    virtual void                            deallocate(void* buffer, int size) = 0;
+    virtual void                            release() = 0;
+    virtual                                 ~rs2_frame_allocator() {}
+};
+
 struct rs2_update_progress_callback
 {
     virtual void                            on_update_progress(const float update_progress) = 0;
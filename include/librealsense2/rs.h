@@ -93,6 +93,22 @@ const char * rs2_get_full_log_message( rs2_log_message const * msg, rs2_error**
  */
 void rs2_log(rs2_log_severity severity, const char * message, rs2_error ** error);
 
+/**
+ * Set the number of threads the library uses to run a single post-processing filter (decimation, temporal,
+ * hole-filling, colorizer) over a frame. The threads are shared by all the processing blocks of the process.
+ * \param[in] threads  Number of threads including the calling one, 1 runs the filters single-threaded.
+ *                      Zero or a negative value restores the default - one thread per physical core
+ * \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_set_processing_threads(int threads, rs2_error ** error);
+
+/**
+ * Retrieve the number of threads used to run a single post-processing filter over a frame
+ * \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return             Number of threads, including the calling one
+ */
+int rs2_get_processing_threads(rs2_error ** error);
+
 /**
 * Given the 2D depth coordinate (x,y) provide the corresponding depth in metric units
 * \param[in] frame_ref  2D depth pixel coordinates (Left-Upper corner origin)
@@ -131,6 +131,21 @@ namespace rs2
         rs2_log(severity, message, &e);
         error::handle(e);
     }
+
+    inline void set_processing_threads(int threads)
+    {
+        rs2_error* e = nullptr;
+        rs2_set_processing_threads(threads, &e);
+        error::handle(e);
+    }
+
+    inline int get_processing_threads()
+    {
+        rs2_error* e = nullptr;
+        auto res = rs2_get_processing_threads(&e);
+        error::handle(e);
+        return res;
+    }
 }
 
 inline std::ostream & operator << (std::ostream & o, rs2_stream stream) { return o << rs2_stream_to_string(stream); }
@@ -2,12 +2,10 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 #include "metadata-parser.h"
 #include "archive.h"
-#include <fstream>
 #include "core/processing.h"
 #include "core/video.h"
 #include "frame-archive.h"
-
-#define MIN_DISTANCE 1e-6
+#include "environment.h"
 
 namespace librealsense
 {
@@ -30,113 +28,42 @@ namespace librealsense
         return xyz;
     }
 
-    std::tuple<uint8_t, uint8_t, uint8_t> get_texcolor(const frame_holder& texture, float u, float v)
+    void points::export_to_ply(const std::string& fname, const frame_holder& texture)
     {
-        auto ptr = dynamic_cast<video_frame*>(texture.frame);
-        if (ptr == nullptr) {
-            throw librealsense::invalid_value_exception("frame must be video frame");
-        }
-        const int w = ptr->get_width(), h = ptr->get_height();
-        int x = std::min(std::max(int(u*w + .5f), 0), w - 1);
-        int y = std::min(std::max(int(v*h + .5f), 0), h - 1);
-        int idx = x * ptr->get_bpp() / 8 + y * ptr->get_stride();
-        const auto texture_data = reinterpret_cast<const uint8_t*>(ptr->get_frame_data());
-        return std::make_tuple(texture_data[idx], texture_data[idx + 1], texture_data[idx + 2]);
+        export_to_ply(fname, texture, ply_export_options(), false);
     }
 
+    void points::export_to_ply(const std::string& fname, const frame_holder& texture, const ply_export_options& options, bool parallel)
+    {
+        write_ply(fname, serialize(texture, options, parallel));
+    }
 
-    void points::export_to_ply(const std::string& fname, const frame_holder& texture)
+    void points::export_to_ply(int fd, const frame_holder& texture, const ply_export_options& options, bool parallel)
+    {
+        write_ply(fd, serialize(texture, options, parallel));
+    }
+
+    std::vector<uint8_t> points::serialize(const frame_holder& texture, const ply_export_options& options, bool parallel)
     {
         auto stream_profile = get_stream().get();
         auto video_stream_profile = dynamic_cast<video_stream_profile_interface*>(stream_profile);
         if (!video_stream_profile)
             throw librealsense::invalid_value_exception("stream must be video stream");
-        const auto vertices = get_vertices();
-        const auto texcoords = get_texture_coordinates();
-        std::vector<float3> new_vertices;
-        std::vector<std::tuple<uint8_t, uint8_t, uint8_t>> new_tex;
-        std::map<int, int> index2reducedIndex;
-
-        new_vertices.reserve(get_vertex_count());
-        new_tex.reserve(get_vertex_count());
-        assert(get_vertex_count());
-        for (size_t i = 0; i < get_vertex_count(); ++i)
-            if (fabs(vertices[i].x) >= MIN_DISTANCE || fabs(vertices[i].y) >= MIN_DISTANCE ||
-                fabs(vertices[i].z) >= MIN_DISTANCE)
-            {
-                index2reducedIndex[i] = new_vertices.size();
-                new_vertices.push_back({ vertices[i].x,  -1*vertices[i].y, -1*vertices[i].z });
-                if (texture)
-                {
-                    auto color = get_texcolor(texture, texcoords[i].x, texcoords[i].y);
-                    new_tex.push_back(color);
-                }
-            }
+        auto width = video_stream_profile->get_width(), height = video_stream_profile->get_height();
+        if (size_t(width) * height != get_vertex_count())
+            throw librealsense::invalid_value_exception("points frame must hold a vertex per pixel of its stream");
 
-        const auto threshold = 0.05f;
-        auto width = video_stream_profile->get_width();
-        std::vector<std::tuple<int, int, int>> faces;
-        for (int x = 0; x < width - 1; ++x) {
-            for (int y = 0; y < video_stream_profile->get_height() - 1; ++y) {
-                auto a = y * width + x, b = y * width + x + 1, c = (y + 1)*width + x, d = (y + 1)*width + x + 1;
-                if (vertices[a].z && vertices[b].z && vertices[c].z && vertices[d].z
-                    && abs(vertices[a].z - vertices[b].z) < threshold && abs(vertices[a].z - vertices[c].z) < threshold
-                    && abs(vertices[b].z - vertices[d].z) < threshold && abs(vertices[c].z - vertices[d].z) < threshold)
-                {
-                    if (index2reducedIndex.count(a) == 0 || index2reducedIndex.count(b) == 0 || index2reducedIndex.count(c) == 0 ||
-                        index2reducedIndex.count(d) == 0)
-                        continue;
-
-                    faces.emplace_back(index2reducedIndex[a], index2reducedIndex[d], index2reducedIndex[b]);
-                    faces.emplace_back(index2reducedIndex[d], index2reducedIndex[a], index2reducedIndex[c]);
-                }
-            }
-        }
-
-        std::ofstream out(fname);
-        out << "ply\n";
-        out << "format binary_little_endian 1.0\n";
-        out << "comment pointcloud saved from Realsense Viewer\n";
-        out << "element vertex " << new_vertices.size() << "\n";
-        out << "property float" << sizeof(float) * 8 << " x\n";
-        out << "property float" << sizeof(float) * 8 << " y\n";
-        out << "property float" << sizeof(float) * 8 << " z\n";
+        ply_texture tex = {};
         if (texture)
         {
-            out << "property uchar red\n";
-            out << "property uchar green\n";
-            out << "property uchar blue\n";
+            auto ptr = dynamic_cast<video_frame*>(texture.frame);
+            if (ptr == nullptr)
+                throw librealsense::invalid_value_exception("frame must be video frame");
+            tex = { ptr->get_frame_data(), ptr->get_width(), ptr->get_height(), ptr->get_bpp() / 8, ptr->get_stride() };
         }
-        out << "element face " << faces.size() << "\n";
-        out << "property list uchar int vertex_indices\n";
-        out << "end_header\n";
-        out.close();
-
-        out.open(fname, std::ios_base::app | std::ios_base::binary);
-        for (int i = 0; i < new_vertices.size(); ++i)
-        {
-            // we assume little endian architecture on your device
-            out.write(reinterpret_cast<const char*>(&(new_vertices[i].x)), sizeof(float));
-            out.write(reinterpret_cast<const char*>(&(new_vertices[i].y)), sizeof(float));
-            out.write(reinterpret_cast<const char*>(&(new_vertices[i].z)), sizeof(float));
 
-            if (texture)
-            {
-                uint8_t x, y, z;
-                std::tie(x, y, z) = new_tex[i];
-                out.write(reinterpret_cast<const char*>(&x), sizeof(uint8_t));
-                out.write(reinterpret_cast<const char*>(&y), sizeof(uint8_t));
-                out.write(reinterpret_cast<const char*>(&z), sizeof(uint8_t));
-            }
-        }
-        auto size = faces.size();
-        for (int i = 0; i < size; ++i) {
-            int three = 3;
-            out.write(reinterpret_cast<const char*>(&three), sizeof(uint8_t));
-            out.write(reinterpret_cast<const char*>(&(std::get<0>(faces[i]))), sizeof(int));
-            out.write(reinterpret_cast<const char*>(&(std::get<1>(faces[i]))), sizeof(int));
-            out.write(reinterpret_cast<const char*>(&(std::get<2>(faces[i]))), sizeof(int));
-        }
+        auto pool = parallel ? environment::get_instance().get_processing_pool() : nullptr;
+        return serialize_ply(width, height, get_vertices(), get_texture_coordinates(), texture ? &tex : nullptr, options, pool.get());
     }
 
     size_t points::get_vertex_count() const
@@ -217,14 +144,14 @@ namespace librealsense
             throw invalid_value_exception(to_string() << "metadata not available for "
                 << get_string(get_stream()->get_stream_type()) << " stream");
 
-        auto it = metadata_parsers.get()->find(frame_metadata);
-        if (it == metadata_parsers.get()->end())          // Possible user error - md attribute is not supported by this frame type
+        auto& parser = metadata_parsers->find(frame_metadata);
+        if (!parser)          // Possible user error - md attribute is not supported by this frame type
             throw invalid_value_exception(to_string() << get_string(frame_metadata)
                 << " attribute is not applicable for "
                 << get_string(get_stream()->get_stream_type()) << " stream ");
 
         // Proceed to parse and extract the required data attribute
-        return it->second->get(*this);
+        return parser->get(*this);
     }
 
     bool frame::supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const
@@ -233,21 +160,45 @@ namespace librealsense
         if (!metadata_parsers)
             return false;                         // No parsers are available or no metadata was attached
 
-        auto it = metadata_parsers.get()->find(frame_metadata);
-        if (it == metadata_parsers.get()->end())          // Possible user error - md attribute is not supported by this frame type
+        auto& parser = metadata_parsers->find(frame_metadata);
+        if (!parser)          // Possible user error - md attribute is not supported by this frame type
             return false;
 
-        return it->second->supports(*this);
+        return parser->supports(*this);
+    }
+
+    int frame::get_all_frame_metadata(rs2_frame_metadata_value* attributes, rs2_metadata_type* values, int capacity) const
+    {
+        if (!metadata_parsers)
+            return 0;
+
+        int count = 0;
+        for (int i = 0; i < static_cast<int>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); ++i)
+        {
+            auto attribute = static_cast<rs2_frame_metadata_value>(i);
+            auto& parser = metadata_parsers->find(attribute);
+            rs2_metadata_type value;
+            if (!parser || !parser->try_get(*this, value))
+                continue;
+
+            if (count < capacity)
+            {
+                attributes[count] = attribute;
+                values[count] = value;
+            }
+            ++count;
+        }
+        return count;
     }
 
     int frame::get_frame_data_size() const
     {
-        return data.size();
+        return external_data ? external_data.size() : data.size();
     }
 
     const byte* frame::get_frame_data() const
     {
-        const byte* frame_data = data.data();
+        const byte* frame_data = external_data ? external_data.data() : data.data();
 
         if (on_release.get_data())
         {
@@ -5,6 +5,7 @@
 
 #include "types.h"
 #include "core/streaming.h"
+#include "proc/ply-export.h"
 #include <atomic>
 #include <array>
 #include <math.h>
@@ -15,7 +16,46 @@ namespace librealsense
     class md_attribute_parser_base;
     class frame;
 
-    typedef std::map<rs2_frame_metadata_value, std::shared_ptr<md_attribute_parser_base>> metadata_parser_map;
+    /** \brief Metadata fields that are utilized internally by librealsense
+        Provides extention to the r2_frame_metadata list of attributes*/
+    enum frame_metadata_internal
+    {
+        RS2_FRAME_METADATA_HW_TYPE  =   RS2_FRAME_METADATA_COUNT +1 , /**< 8-bit Module type: RS4xx, IVCAM*/
+        RS2_FRAME_METADATA_SKU_ID                                   , /**< 8-bit SKU Id*/
+        RS2_FRAME_METADATA_FORMAT                                   , /**< 16-bit Frame format*/
+        RS2_FRAME_METADATA_WIDTH                                    , /**< 16-bit Frame width. pixels*/
+        RS2_FRAME_METADATA_HEIGHT                                   , /**< 16-bit Frame height. pixels*/
+        RS2_FRAME_METADATA_COUNT
+    };
+
+    /** \brief The metadata parsers of a sensor, indexed directly by the attribute - public and internal alike.
+        Looked up for every attribute query of every frame, so it is a flat table rather than a tree */
+    class metadata_parser_map
+    {
+    public:
+        typedef std::shared_ptr<md_attribute_parser_base> parser_ptr;
+
+        // The parser of the attribute, or null when the attribute is not supported
+        const parser_ptr& find(rs2_frame_metadata_value metadata) const
+        {
+            static const parser_ptr none;
+            auto i = static_cast<size_t>(metadata);
+            return i < _parsers.size() ? _parsers[i] : none;
+        }
+
+        bool contains(rs2_frame_metadata_value metadata) const { return find(metadata) != nullptr; }
+
+        parser_ptr& operator[](rs2_frame_metadata_value metadata)
+        {
+            auto i = static_cast<size_t>(metadata);
+            if (i >= _parsers.size())
+                throw invalid_value_exception(to_string() << "metadata attribute " << i << " is out of range");
+            return _parsers[i];
+        }
+
+    private:
+        std::array<parser_ptr, static_cast<size_t>(frame_metadata_internal::RS2_FRAME_METADATA_COUNT)> _parsers;
+    };
 
     /*
         Each frame is attached with a static header
@@ -78,6 +118,8 @@ namespace librealsense
 
         virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
 
+        virtual void set_frame_allocator(frame_allocator_ptr allocator) = 0;
+
         virtual void flush() = 0;
 
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
@@ -91,11 +133,78 @@ namespace librealsense
         std::shared_ptr<platform::time_service> ts,
         std::shared_ptr<metadata_parser_map> parsers);
 
+    // Frame data buffer not owned by the frame archive: either provided by a user allocator,
+    // or borrowed from the backend. Handed back to its owner on destruction
+    class external_frame_buffer
+    {
+    public:
+        external_frame_buffer() : _data(nullptr), _size(0) {}
+        external_frame_buffer(frame_allocator_ptr allocator, size_t size)
+            : _allocator(std::move(allocator)), _data(nullptr), _size(0)
+        {
+            if (_allocator)
+            {
+                _data = static_cast<byte*>(_allocator->allocate(static_cast<int>(size)));
+                if (_data) _size = size;
+            }
+        }
+        external_frame_buffer(byte* data, size_t size, frame_continuation on_release)
+            : _data(data), _size(size), _on_release(std::move(on_release))
+        {}
+        external_frame_buffer(const external_frame_buffer&) = delete;
+        external_frame_buffer(external_frame_buffer&& other)
+            : _allocator(std::move(other._allocator)), _data(other._data), _size(other._size),
+            _on_release(std::move(other._on_release))
+        {
+            other._data = nullptr;
+            other._size = 0;
+        }
+
+        external_frame_buffer& operator=(const external_frame_buffer&) = delete;
+        external_frame_buffer& operator=(external_frame_buffer&& other)
+        {
+            if (this != &other)
+            {
+                reset();
+                _allocator = std::move(other._allocator);
+                _on_release = std::move(other._on_release);
+                _data = other._data;
+                _size = other._size;
+                other._data = nullptr;
+                other._size = 0;
+            }
+            return *this;
+        }
+
+        ~external_frame_buffer() { reset(); }
+
+        void reset()
+        {
+            if (_data && _allocator)
+                _allocator->deallocate(_data, static_cast<int>(_size));
+            _on_release();
+            _allocator.reset();
+            _data = nullptr;
+            _size = 0;
+        }
+
+        byte* data() const { return _data; }
+        size_t size() const { return _size; }
+        explicit operator bool() const { return _data != nullptr; }
+
+    private:
+        frame_allocator_ptr _allocator;
+        byte* _data;
+        size_t _size;
+        frame_continuation _on_release;
+    };
+
     // Define a movable but explicitly noncopyable buffer type to hold our frame data
     class LRS_EXTENSION_API frame : public frame_interface
     {
     public:
         std::vector<byte> data;
+        external_frame_buffer external_data; // when set, holds the frame data instead of data
         frame_additional_data additional_data;
         std::shared_ptr<metadata_parser_map> metadata_parsers = nullptr;
         explicit frame() : ref_count(0), _kept(false), owner(nullptr), on_release() {}
@@ -113,6 +222,7 @@ namespace librealsense
         frame& operator=(frame&& r)
         {
             data = move(r.data);
+            external_data = std::move(r.external_data);
             owner = r.owner;
             ref_count = r.ref_count.exchange(0);
             _kept = r._kept.exchange(false);
@@ -127,6 +237,7 @@ namespace librealsense
         virtual ~frame() { on_release.reset(); }
         rs2_metadata_type get_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
         bool supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
+        int get_all_frame_metadata(rs2_frame_metadata_value* attributes, rs2_metadata_type* values, int capacity) const override;
         int get_frame_data_size() const override;
         const byte* get_frame_data() const override;
         rs2_time_t get_frame_timestamp() const override;
@@ -186,8 +297,13 @@ namespace librealsense
     public:
         float3* get_vertices();
         void export_to_ply(const std::string& fname, const frame_holder& texture);
+        void export_to_ply(const std::string& fname, const frame_holder& texture, const ply_export_options& options, bool parallel);
+        void export_to_ply(int fd, const frame_holder& texture, const ply_export_options& options, bool parallel);
         size_t get_vertex_count() const;
         float2* get_texture_coordinates();
+
+    private:
+        std::vector<uint8_t> serialize(const frame_holder& texture, const ply_export_options& options, bool parallel);
     };
 
     MAP_EXTENSION(RS2_EXTENSION_POINTS, librealsense::points);
@@ -233,6 +349,10 @@ namespace librealsense
         {
             return first()->supports_frame_metadata(frame_metadata);
         }
+        int get_all_frame_metadata(rs2_frame_metadata_value* attributes, rs2_metadata_type* values, int capacity) const override
+        {
+            return first()->get_all_frame_metadata(attributes, values, capacity);
+        }
         int get_frame_data_size() const override
         {
             return first()->get_frame_data_size();
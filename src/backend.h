@@ -372,6 +372,10 @@ namespace librealsense
             virtual std::string get_device_location() const = 0;
             virtual usb_spec  get_usb_specification() const = 0;
 
+            // True when a frame buffer is re-queued only once its continuation is invoked,
+            // so frames may keep referencing the backend memory until they are released
+            virtual bool defers_buffer_requeue() const { return false; }
+
             virtual ~uvc_device() = default;
 
         protected:
@@ -497,6 +501,11 @@ namespace librealsense
                 return _dev->get_usb_specification();
             }
 
+            bool defers_buffer_requeue() const override
+            {
+                return _dev->defers_buffer_requeue();
+            }
+
             void lock() const override { _dev->lock(); }
             void unlock() const override { _dev->unlock(); }
 
@@ -759,6 +768,14 @@ namespace librealsense
                 return _dev.front()->get_usb_specification();
             }
 
+            bool defers_buffer_requeue() const override
+            {
+                for (auto&& dev : _dev)
+                    if (!dev->defers_buffer_requeue())
+                        return false;
+                return true;
+            }
+
             void lock() const override
             {
                 std::vector<uvc_device*> locked_dev;
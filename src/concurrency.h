@@ -8,6 +8,8 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <cstdint>
+#include <cstring>
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -443,4 +445,54 @@ private:
     bool _blocker = true;
     std::function<void()> _operation;
     std::shared_ptr<active_object<>> _watcher;
-};
\ No newline at end of file
+};
+// Publishes a small, trivially copyable value to readers that never block: a reader that overlaps
+// a store retries instead. Stores must be serialized by the caller. The value is kept in atomic
+// words, so that a read racing a store is detected rather than undefined.
+template<class T>
+class seqlock
+{
+public:
+    seqlock() : seqlock(T()) {}
+    explicit seqlock(const T& value) : _sequence(0) { store_words(value); }
+
+    void store(const T& value)
+    {
+        auto sequence = _sequence.load(std::memory_order_relaxed);
+        _sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store_words(value);
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    T load() const
+    {
+        uint64_t words[word_count];
+        unsigned sequence;
+        do
+        {
+            sequence = _sequence.load(std::memory_order_acquire);
+            for (size_t i = 0; i < word_count; ++i)
+                words[i] = _words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((sequence & 1) || sequence != _sequence.load(std::memory_order_relaxed));
+
+        T value;
+        memcpy(&value, words, sizeof(value));
+        return value;
+    }
+
+private:
+    static const size_t word_count = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    void store_words(const T& value)
+    {
+        uint64_t words[word_count] = {};
+        memcpy(words, &value, sizeof(value));
+        for (size_t i = 0; i < word_count; ++i)
+            _words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    std::atomic<unsigned> _sequence;
+    std::atomic<uint64_t> _words[word_count];
+};
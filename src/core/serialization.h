@@ -346,6 +346,9 @@ namespace librealsense
             virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
             virtual const std::string& get_file_name() const = 0;
             virtual std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) = 0;
+            virtual size_t query_frames_count(const stream_identifier& stream_id) = 0;
+            virtual std::shared_ptr<serialized_frame> read_frame(const stream_identifier& stream_id, size_t index) = 0;
+            virtual size_t find_frame(const stream_identifier& stream_id, unsigned long long frame_number) = 0;
         };
     }
 }
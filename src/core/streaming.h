@@ -83,6 +83,8 @@ namespace librealsense
     public:
         virtual rs2_metadata_type get_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const = 0;
         virtual bool supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const = 0;
+        // Retrieves every supported attribute in one pass, writing up to capacity of them; returns how many are supported
+        virtual int get_all_frame_metadata(rs2_frame_metadata_value* attributes, rs2_metadata_type* values, int capacity) const = 0;
         virtual int get_frame_data_size() const = 0;
         virtual const byte* get_frame_data() const = 0;
         virtual rs2_time_t get_frame_timestamp() const = 0;
@@ -234,6 +236,7 @@ namespace librealsense
         virtual void stop() = 0;
         virtual frame_callback_ptr get_frames_callback() const = 0;
         virtual void set_frames_callback(frame_callback_ptr cb) = 0;
+        virtual void set_frame_allocator(frame_allocator_ptr allocator) = 0;
         virtual bool is_streaming() const = 0;
         virtual device_interface& get_device() = 0;
 
@@ -0,0 +1,209 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#include "device-cache.h"
+#include "types.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+namespace librealsense
+{
+    namespace
+    {
+        const char cache_magic[] = { 'L', 'R', 'S', 'D', 'C', 'A', 'C', 'H' };
+        const uint32_t cache_version = 1;
+
+        void write_u32(std::ostream& out, uint32_t value)
+        {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void write_bytes(std::ostream& out, const void* data, size_t size)
+        {
+            write_u32(out, static_cast<uint32_t>(size));
+            out.write(static_cast<const char*>(data), size);
+        }
+
+        // Reads from a file already in memory, failing on anything truncated
+        class reader
+        {
+        public:
+            explicit reader(const std::vector<char>& buffer) : _pos(buffer.data()), _end(buffer.data() + buffer.size()) {}
+
+            bool read_u32(uint32_t& value)
+            {
+                if (_end - _pos < static_cast<ptrdiff_t>(sizeof(value)))
+                    return false;
+                memcpy(&value, _pos, sizeof(value));
+                _pos += sizeof(value);
+                return true;
+            }
+
+            template<class T>
+            bool read_bytes(T& value)
+            {
+                uint32_t size;
+                if (!read_u32(size) || _end - _pos < static_cast<ptrdiff_t>(size))
+                    return false;
+                value.assign(_pos, _pos + size);
+                _pos += size;
+                return true;
+            }
+
+            bool read_magic()
+            {
+                if (_end - _pos < static_cast<ptrdiff_t>(sizeof(cache_magic)) || memcmp(_pos, cache_magic, sizeof(cache_magic)))
+                    return false;
+                _pos += sizeof(cache_magic);
+                return true;
+            }
+
+            bool at_end() const { return _pos == _end; }
+
+        private:
+            const char* _pos;
+            const char* _end;
+        };
+    }
+
+    std::shared_ptr<device_cache> device_cache::open(const std::string& name, const std::vector<uint8_t>& descriptor)
+    {
+        auto dir = getenv("LRS_DEVICE_CACHE_DIR");
+        if (!dir || !*dir)
+            return nullptr;
+
+        std::string file_name;
+        for (auto c : name)
+            file_name += (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '.') ? c : '_';
+
+        std::string path(dir);
+        if (path.back() != '/' && path.back() != '\\')
+            path += '/';
+        return std::make_shared<device_cache>(path + file_name + ".cache", descriptor);
+    }
+
+    device_cache::device_cache(const std::string& path, const std::vector<uint8_t>& descriptor)
+        : _path(path), _descriptor(descriptor)
+    {
+        if (load())
+            LOG_DEBUG("Device cache " << _path << " holds " << _values.size() << " values");
+        else
+            _values.clear();
+    }
+
+    bool device_cache::load()
+    {
+        std::ifstream in(_path, std::ios_base::in | std::ios_base::binary);
+        if (!in)
+            return false;
+        std::vector<char> buffer((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        reader r(buffer);
+        uint32_t version, count;
+        std::vector<uint8_t> descriptor;
+        if (!r.read_magic() || !r.read_u32(version) || version != cache_version || !r.read_bytes(descriptor) || !r.read_u32(count))
+        {
+            LOG_WARNING("Ignoring the invalid device cache " << _path);
+            return false;
+        }
+        if (descriptor != _descriptor)
+        {
+            LOG_INFO("Device cache " << _path << " is stale, starting it over");
+            return false;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            std::string key;
+            std::vector<uint8_t> value;
+            if (!r.read_bytes(key) || !r.read_bytes(value))
+            {
+                LOG_WARNING("Ignoring the truncated device cache " << _path);
+                return false;
+            }
+            _values[key] = std::move(value);
+        }
+        return r.at_end();
+    }
+
+    void device_cache::save() const
+    {
+        // Written aside and renamed over, so that other processes never read a partial file
+        auto tmp_path = _path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+            out.write(cache_magic, sizeof(cache_magic));
+            write_u32(out, cache_version);
+            write_bytes(out, _descriptor.data(), _descriptor.size());
+            write_u32(out, static_cast<uint32_t>(_values.size()));
+            for (auto& kvp : _values)
+            {
+                write_bytes(out, kvp.first.data(), kvp.first.size());
+                write_bytes(out, kvp.second.data(), kvp.second.size());
+            }
+            if (!out)
+            {
+                LOG_WARNING("Failed to write the device cache " << tmp_path);
+                return;
+            }
+        }
+#ifdef _WIN32
+        std::remove(_path.c_str());
+#endif
+        if (std::rename(tmp_path.c_str(), _path.c_str()))
+        {
+            LOG_WARNING("Failed to replace the device cache " << _path);
+            std::remove(tmp_path.c_str());
+        }
+    }
+
+    bool device_cache::get(const std::string& key, std::vector<uint8_t>& value) const
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto it = _values.find(key);
+        if (it == _values.end())
+            return false;
+        value = it->second;
+        return true;
+    }
+
+    void device_cache::put(const std::string& key, const std::vector<uint8_t>& value)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _values[key] = value;
+        save();
+    }
+
+    void device_cache::clear()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++_generation;
+        if (_values.empty())
+            return;
+        _values.clear();
+        save();
+    }
+
+    uint64_t device_cache::get_generation() const
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        return _generation;
+    }
+
+    bool device_cache::refresh(const std::string& key, const std::vector<uint8_t>& value, uint64_t generation)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (generation != _generation)
+            return false;
+        auto& stored = _values[key];
+        if (stored == value)
+            return false;
+        stored = value;
+        save();
+        return true;
+    }
+}
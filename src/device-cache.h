@@ -0,0 +1,57 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    /*
+        An opt-in on-disk cache of the data of a device that does not change as long as its firmware does not -
+        calibration tables and the like - so that opening the device again does not wait for the round trips that
+        read them. It is enabled by pointing LRS_DEVICE_CACHE_DIR at a writable directory. Every device and firmware
+        version has its own file, which is valid only as long as the descriptor read from the device on open is
+        identical to the one it was stored with. Values are cached as they are first read, and written back at once.
+        The descriptor does not change when calibration is written by another tool, so the readers of a value served
+        from the cache read it again from the device in the background, and refresh() it.
+    */
+    class device_cache
+    {
+    public:
+        // The cache of the named device, or null when caching is disabled. A stale cache is started over
+        static std::shared_ptr<device_cache> open(const std::string& name, const std::vector<uint8_t>& descriptor);
+
+        device_cache(const std::string& path, const std::vector<uint8_t>& descriptor);
+
+        bool get(const std::string& key, std::vector<uint8_t>& value) const;
+        void put(const std::string& key, const std::vector<uint8_t>& value);
+
+        // Drops all the values, for when the device data they were read from is written
+        void clear();
+
+        // Counts the clear() calls, a value read from the device before one of them must not be stored
+        uint64_t get_generation() const;
+
+        // Stores a value read again from the device, unless the cache was cleared since the given generation.
+        // Returns whether the value changed
+        bool refresh(const std::string& key, const std::vector<uint8_t>& value, uint64_t generation);
+
+        const std::string& get_path() const { return _path; }
+
+    private:
+        bool load();
+        void save() const;
+
+        std::string _path;
+        std::vector<uint8_t> _descriptor;
+        std::map<std::string, std::vector<uint8_t>> _values;
+        uint64_t _generation = 0;
+        mutable std::mutex _mtx;
+    };
+}
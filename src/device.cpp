@@ -274,6 +274,9 @@ std::vector<rs2_format> librealsense::device::map_supported_color_formats(rs2_fo
     case RS2_FORMAT_UYVY:
         target_formats.push_back(RS2_FORMAT_UYVY);
         break;
+    case RS2_FORMAT_MJPEG:
+        target_formats.push_back(RS2_FORMAT_MJPEG);
+        break;
     default:
         LOG_ERROR("Format is not supported for mapping");
     }
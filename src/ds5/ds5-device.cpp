@@ -9,6 +9,7 @@
 #include <string>
 
 #include "device.h"
+#include "device-cache.h"
 #include "context.h"
 #include "image.h"
 #include "metadata-parser.h"
@@ -483,6 +484,15 @@ namespace librealsense
         return fabs(table->baseline);
     }
 
+    void ds5_device::attach_cache()
+    {
+        using namespace ds;
+        // Calibration tables are read from the cache, anything that may write them drops it
+        _hw_monitor->set_cache(_cache,
+            { GETINTCAL, RECPARAMSGET, LOADINTCAL, MMER },
+            { SETINTCAL, SETINTCALNEW, CAL_RESTORE_DFLT, CALIBRECALC, AUTO_CALIB, FWB, FES, FEF, DFU });
+    }
+
     std::vector<uint8_t> ds5_device::get_raw_calibration_table(ds::calibration_table_id table_id) const
     {
         command cmd(ds::GETINTCAL, table_id);
@@ -499,11 +509,9 @@ namespace librealsense
         return {};
     }
 
-    ds::d400_caps ds5_device::parse_device_capabilities(const uint16_t pid) const
+    ds::d400_caps ds5_device::parse_device_capabilities(const std::vector<uint8_t>& gvd_buf, const uint16_t pid) const
     {
         using namespace ds;
-        std::array<unsigned char,HW_MONITOR_BUFFER_SIZE> gvd_buf;
-        _hw_monitor->get_gvd(gvd_buf.size(), gvd_buf.data(), GVD);
 
         // Opaque retrieval
         d400_caps val{d400_caps::CAP_UNDEFINED};
@@ -629,17 +637,32 @@ namespace librealsense
 
         std::vector<uint8_t> gvd_buff(HW_MONITOR_BUFFER_SIZE);
         _hw_monitor->get_gvd(gvd_buff.size(), gvd_buff.data(), GVD);
-        // fooling tests recordings - don't remove
-        _hw_monitor->get_gvd(gvd_buff.size(), gvd_buff.data(), GVD);
 
         auto optic_serial = _hw_monitor->get_module_serial_string(gvd_buff, module_serial_offset);
         auto asic_serial = _hw_monitor->get_module_serial_string(gvd_buff, module_asic_serial_offset);
         auto fwv = _hw_monitor->get_firmware_version_string(gvd_buff, camera_fw_version_offset);
         _fw_version = firmware_version(fwv);
 
+        // The descriptor just read validates the cache, and stands for the later reads of it
+        _cache = device_cache::open(to_string() << "d400-" << optic_serial << "-" << fwv, gvd_buff);
+        if (_cache)
+            attach_cache();
+        else
+            // fooling tests recordings - don't remove
+            _hw_monitor->get_gvd(gvd_buff.size(), gvd_buff.data(), GVD);
+
+        auto read_gvd = [&]() -> std::vector<uint8_t>
+        {
+            if (_cache)
+                return gvd_buff;
+            std::vector<uint8_t> gvd(HW_MONITOR_BUFFER_SIZE);
+            _hw_monitor->get_gvd(gvd.size(), gvd.data(), GVD);
+            return gvd;
+        };
+
         _recommended_fw_version = firmware_version(D4XX_RECOMMENDED_FIRMWARE_VERSION);
         if (_fw_version >= firmware_version("5.10.4.0"))
-            _device_capabilities = parse_device_capabilities(pid);
+            _device_capabilities = parse_device_capabilities(read_gvd(), pid);
 
         auto& depth_sensor = get_depth_sensor();
         auto& raw_depth_sensor = get_raw_depth_sensor();
@@ -693,7 +716,7 @@ namespace librealsense
 
         if (_fw_version >= firmware_version("5.6.3.0"))
         {
-            _is_locked = _hw_monitor->is_camera_locked(GVD, is_camera_locked_offset);
+            _is_locked = read_gvd()[is_camera_locked_offset] != 0;
 
 #ifdef HWM_OVER_XU
             //if hw_monitor was created by usb replace it with xu
@@ -705,6 +728,8 @@ namespace librealsense
                         std::make_shared<command_transfer_over_xu>(
                             raw_depth_sensor, depth_xu, DS5_HWMONITOR),
                         raw_depth_sensor));
+                if (_cache)
+                    attach_cache();
             }
 #endif
 
@@ -73,7 +73,9 @@ namespace librealsense
 
         float get_stereo_baseline_mm() const;
 
-        ds::d400_caps  parse_device_capabilities(const uint16_t pid) const;
+        ds::d400_caps  parse_device_capabilities(const std::vector<uint8_t>& gvd_buf, const uint16_t pid) const;
+
+        void attach_cache();
 
         void init(std::shared_ptr<context> ctx,
             const platform::backend_device_group& group);
@@ -81,6 +83,7 @@ namespace librealsense
         friend class ds5_depth_sensor;
 
         std::shared_ptr<hw_monitor> _hw_monitor;
+        std::shared_ptr<device_cache> _cache;
         firmware_version            _fw_version;
         firmware_version            _recommended_fw_version;
         ds::d400_caps               _device_capabilities;
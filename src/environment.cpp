@@ -205,4 +205,30 @@ namespace librealsense
     {
         return _ts;
     }
+
+    std::shared_ptr<worker_pool> environment::get_processing_pool()
+    {
+        std::lock_guard<std::mutex> lock(_pool_mutex);
+        if (!_processing_pool)
+        {
+            auto threads = _processing_threads > 0 ? _processing_threads : worker_pool::get_physical_cores();
+            _processing_pool = std::make_shared<worker_pool>(threads);
+        }
+        return _processing_pool;
+    }
+
+    void environment::set_processing_threads(int threads)
+    {
+        std::lock_guard<std::mutex> lock(_pool_mutex);
+        if (threads != _processing_threads)
+        {
+            _processing_threads = threads;
+            _processing_pool.reset();
+        }
+    }
+
+    int environment::get_processing_threads()
+    {
+        return static_cast<int>(get_processing_pool()->get_threads_count());
+    }
 }
@@ -4,6 +4,7 @@
 #pragma once
 #include "core/streaming.h"
 #include "types.h"
+#include "proc/worker-pool.h"
 #include <memory>
 #include <mutex>
 
@@ -75,6 +76,12 @@ namespace librealsense
         void set_time_service(std::shared_ptr<platform::time_service> ts);
         std::shared_ptr<platform::time_service> get_time_service();
 
+        // Worker pool shared by the processing blocks. Resizing creates a new pool, calls in flight
+        // complete on the pool they started with.
+        std::shared_ptr<worker_pool> get_processing_pool();
+        void set_processing_threads(int threads); // Non-positive value restores the default of one thread per physical core
+        int get_processing_threads();
+
         environment(const environment&) = delete;
         environment(const environment&&) = delete;
         environment operator=(const environment&) = delete;
@@ -84,6 +91,9 @@ namespace librealsense
         extrinsics_graph _extrinsics;
         std::atomic<int> _stream_id;
         std::shared_ptr<platform::time_service> _ts;
+        std::mutex _pool_mutex;
+        std::shared_ptr<worker_pool> _processing_pool;
+        int _processing_threads = 0;
 
         environment(){_stream_id = 0;}
 
@@ -57,7 +57,7 @@ void ip_device::stop_sensor_streams(int sensor_index)
     for(long long int key : remote_sensors[sensor_index]->active_streams_keys)
     {
         DBG << "Stopping stream [uid:key] " << streams_collection[key].get()->m_rs_stream.uid << ":" << key << "]";
-        streams_collection[key].get()->is_enabled = false;
+        streams_collection[key].get()->disable();
         if(inject_frames_thread[key].joinable())
             inject_frames_thread[key].join();
     }
@@ -327,6 +327,7 @@ void ip_device::update_sensor_state(int sensor_index, std::vector<rs2::stream_pr
 
         rtp_callbacks[requested_stream_key] = new rs_rtp_callback(streams_collection[requested_stream_key]);
         remote_sensors[sensor_index]->rtsp_client->addStream(streams_collection[requested_stream_key].get()->m_rs_stream, rtp_callbacks[requested_stream_key]);
+        streams_collection[requested_stream_key].get()->enable();
         inject_frames_thread[requested_stream_key] = std::thread(&ip_device::inject_frames_loop, this, streams_collection[requested_stream_key]);
         remote_sensors[sensor_index]->active_streams_keys.push_front(requested_stream_key);
     }
@@ -346,33 +347,43 @@ void ip_device::inject_frames_loop(std::shared_ptr<rs_rtp_stream> rtp_stream)
 {
     try
     {
-        rtp_stream.get()->is_enabled = true;
-
         rtp_stream.get()->frame_data_buff.frame_number = 0;
         int uid = rtp_stream.get()->m_rs_stream.uid;
         rs2_stream type = rtp_stream.get()->m_rs_stream.type;
         int sensor_id = stream_type_to_sensor_id(type);
 
-        while(rtp_stream.get()->is_enabled == true)
+        const rs2_frame_metadata_value metadata_keys[] = {
+            RS2_FRAME_METADATA_FRAME_TIMESTAMP,
+            RS2_FRAME_METADATA_ACTUAL_FPS,
+            RS2_FRAME_METADATA_FRAME_COUNTER,
+            RS2_FRAME_METADATA_FRAME_EMITTER_MODE,
+            RS2_FRAME_METADATA_TIME_OF_ARRIVAL };
+        const int metadata_count = sizeof(metadata_keys) / sizeof(metadata_keys[0]);
+        rs2_metadata_type metadata_values[metadata_count];
+
+        // The RTP sink wakes this thread up on every inserted frame, and stop_sensor_streams() on disable.
+        // The timeout only bounds the wait in case a wake-up is ever missed.
+        while(rtp_stream.get()->is_enabled)
         {
-            if(rtp_stream.get()->queue_size() != 0)
-            {
-                Raw_Frame* frame = rtp_stream.get()->extract_frame();
-                rtp_stream.get()->frame_data_buff.pixels = frame->m_buffer;
+            Raw_Frame* frame = rtp_stream.get()->wait_for_frame(std::chrono::milliseconds(100));
+            if(!frame)
+                continue;
 
-                rtp_stream.get()->frame_data_buff.timestamp = frame->m_metadata->data.timestamp;
+            rtp_stream.get()->frame_data_buff.pixels = frame->m_buffer;
 
-                rtp_stream.get()->frame_data_buff.frame_number++;
-                rtp_stream.get()->frame_data_buff.domain = frame->m_metadata->data.timestampDomain;
+            rtp_stream.get()->frame_data_buff.timestamp = frame->m_metadata->data.timestamp;
 
-                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP, rtp_stream.get()->frame_data_buff.timestamp);
-                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_ACTUAL_FPS, frame->m_metadata->data.actualFps);
-                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_FRAME_COUNTER, rtp_stream.get()->frame_data_buff.frame_number);
-                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_FRAME_EMITTER_MODE, 1);
+            rtp_stream.get()->frame_data_buff.frame_number++;
+            rtp_stream.get()->frame_data_buff.domain = frame->m_metadata->data.timestampDomain;
 
-                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL, std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count());
-                remote_sensors[sensor_id]->sw_sensor->on_video_frame(rtp_stream.get()->frame_data_buff);
-            }
+            metadata_values[0] = static_cast<rs2_metadata_type>(rtp_stream.get()->frame_data_buff.timestamp);
+            metadata_values[1] = frame->m_metadata->data.actualFps;
+            metadata_values[2] = rtp_stream.get()->frame_data_buff.frame_number;
+            metadata_values[3] = 1;
+            metadata_values[4] = static_cast<rs2_metadata_type>(std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+            remote_sensors[sensor_id]->sw_sensor->set_metadata(metadata_keys, metadata_values, metadata_count);
+            remote_sensors[sensor_id]->sw_sensor->on_video_frame(rtp_stream.get()->frame_data_buff);
         }
 
         rtp_stream.get()->reset_queue();
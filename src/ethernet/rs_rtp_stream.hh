@@ -11,6 +11,10 @@
 
 #include <NetdevLog.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+
 const int RTP_QUEUE_MAX_SIZE = 30;
 
 struct Raw_Frame
@@ -62,15 +66,16 @@ public:
 
     void insert_frame(Raw_Frame* new_raw_frame)
     {
-        if(queue_size() > RTP_QUEUE_MAX_SIZE)
-        {
-            ERR << "Queue is full. Dropping frame for: " << this->m_rs_stream.uid;
-        }
-        else
         {
             std::lock_guard<std::mutex> lock(this->stream_lock);
+            if(frames_queue.size() > RTP_QUEUE_MAX_SIZE)
+            {
+                ERR << "Queue is full. Dropping frame for: " << this->m_rs_stream.uid;
+                return;
+            }
             frames_queue.push(new_raw_frame);
         }
+        frames_available.notify_one();
     }
 
     // extrinsics between this stream to all other streams
@@ -85,8 +90,38 @@ public:
         return frame;
     }
 
+    // Blocks until a frame is inserted or the stream is disabled.
+    // Returns nullptr when the stream was disabled or nothing arrived within the timeout.
+    Raw_Frame* wait_for_frame(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(this->stream_lock);
+        frames_available.wait_for(lock, timeout, [this] { return !is_enabled || !frames_queue.empty(); });
+        if(!is_enabled || frames_queue.empty())
+            return nullptr;
+        Raw_Frame* frame = frames_queue.front();
+        frames_queue.pop();
+        return frame;
+    }
+
+    void enable()
+    {
+        std::lock_guard<std::mutex> lock(this->stream_lock);
+        is_enabled = true;
+    }
+
+    // Wakes up the thread waiting for frames
+    void disable()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->stream_lock);
+            is_enabled = false;
+        }
+        frames_available.notify_all();
+    }
+
     void reset_queue()
     {
+        std::lock_guard<std::mutex> lock(this->stream_lock);
         while(!frames_queue.empty())
         {
             frames_queue.pop();
@@ -106,7 +141,7 @@ public:
         return memory_pool_instance;
     }
 
-    bool is_enabled;
+    std::atomic<bool> is_enabled{false};
 
     rs2_video_stream m_rs_stream;
 
@@ -121,6 +156,7 @@ private:
     rs2::stream_profile m_stream_profile;
 
     std::mutex stream_lock;
+    std::condition_variable frames_available;
 
     std::queue<Raw_Frame*> frames_queue;
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "archive.h"
+#include "frame-buffer-pool.h"
 
 namespace librealsense
 {
@@ -16,10 +17,10 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
+        frame_buffer_pool _buffers; // return frame buffers here
+        frame_allocator_ptr _allocator; // user provided frame buffers, when set. Accessed atomically
         std::atomic<bool> recycle_frames;
         int pending_frames = 0;
-        std::recursive_mutex mutex;
         std::shared_ptr<platform::time_service> _time_service;
 
         std::weak_ptr<sensor_interface> _sensor;
@@ -30,34 +31,30 @@ namespace librealsense
         {
             T backbuffer;
             //const size_t size = modes[stream].get_image_size(stream);
+            auto allocator = requires_memory ? std::atomic_load(&_allocator) : nullptr;
+            if (allocator)
             {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
+                backbuffer.external_data = external_frame_buffer(std::move(allocator), size);
+                if (backbuffer.external_data)
                 {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
+                    backbuffer.additional_data = additional_data;
+                    return backbuffer;
                 }
+                // The user allocator declined, fall back to our own buffers
+            }
 
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
-                {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
-                }
+            if (requires_memory)
+            {
+                // Attempt to obtain a buffer of the appropriate size from the pool
+                _buffers.acquire(size, backbuffer.data);
             }
 
+            // Discard buffers that have been in the pool for longer than 1s
+            _buffers.evict_stale(additional_data.timestamp);
+
             if (requires_memory)
             {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                backbuffer.data.resize(size, 0);
             }
             backbuffer.additional_data = additional_data;
             return backbuffer;
@@ -65,8 +62,6 @@ namespace librealsense
 
         frame_interface* track_frame(T& f)
         {
-            std::unique_lock<std::recursive_mutex> lock(mutex);
-
             auto published_frame = f.publish(this->shared_from_this());
             if (published_frame)
             {
@@ -84,15 +79,18 @@ namespace librealsense
             {
                 auto f = (T*)frame;
                 log_frame_callback_end(f);
-                std::unique_lock<std::recursive_mutex> lock(mutex);
 
                 frame->keep();
 
-                if (recycle_frames)
+                // User provided buffers go back to the user allocator with the frame
+                if (f->external_data)
+                {
+                    f->external_data.reset();
+                }
+                else if (recycle_frames)
                 {
-                    freelist.push_back(std::move(*f));
+                    _buffers.release(std::move(f->data), f->additional_data.timestamp);
                 }
-                lock.unlock();
 
                 if (f->is_fixed())
                     published_frames.deallocate(f);
@@ -159,6 +157,8 @@ namespace librealsense
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        void set_frame_allocator(frame_allocator_ptr allocator) override { std::atomic_store(&_allocator, std::move(allocator)); }
+
         friend class frame;
 
     public:
@@ -166,7 +166,7 @@ namespace librealsense
             std::shared_ptr<platform::time_service> ts,
             std::shared_ptr<metadata_parser_map> parsers)
             : max_frame_queue_size(in_max_frame_queue_size),
-            mutex(), recycle_frames(true), _time_service(ts),
+            recycle_frames(true), _time_service(ts),
             _metadata_parsers(parsers)
         {
             published_frames_count = 0;
@@ -202,10 +202,11 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
+            _buffers.clear();
+
+            auto stats = _buffers.get_stats();
+            LOG_DEBUG("Frame buffer pool 0x" << std::hex << this << std::dec << ": " << stats.hits << " hits, "
+                << stats.misses << " misses, " << stats.evictions << " evictions");
 
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
@@ -0,0 +1,209 @@
+/* License: Apache 2.0. See LICENSE file in root directory. */
+/* Copyright(c) 2019 Intel Corporation. All Rights Reserved. */
+#pragma once
+
+#include "types.h"
+#include <atomic>
+#include <array>
+#include <vector>
+
+namespace librealsense
+{
+    struct frame_buffer_pool_stats
+    {
+        unsigned long long hits = 0;      // allocations served from a recycled buffer
+        unsigned long long misses = 0;    // allocations that had to go to the heap
+        unsigned long long evictions = 0; // recycled buffers freed (too old or no room left)
+    };
+
+    /*
+        Recycles frame data buffers of the same size between frames without taking any locks.
+        Buffers are kept in a fixed number of size classes (streams of a sensor rarely use more
+        than a handful of distinct frame sizes), each holding a fixed number of slots.
+        A slot is claimed with a single CAS on its state, so producers (frame release) and
+        consumers (frame allocation) never block each other, and the pool itself never allocates.
+        Stale buffers are swept at most once per max_buffer_age, instead of on every allocation.
+    */
+    class frame_buffer_pool
+    {
+    public:
+        static const size_t max_size_classes = 8;
+        static const size_t slots_per_class = 16;
+        static constexpr rs2_time_t max_buffer_age = 1000.; // ms
+
+        frame_buffer_pool() : _last_sweep(0), _hits(0), _misses(0), _evictions(0) {}
+
+        frame_buffer_pool(const frame_buffer_pool&) = delete;
+        frame_buffer_pool& operator=(const frame_buffer_pool&) = delete;
+
+        // Try to obtain a recycled buffer of exactly the requested size
+        bool acquire(size_t size, std::vector<byte>& buffer)
+        {
+            auto c = size ? find_class(size, false) : nullptr;
+            if (c)
+            {
+                for (auto&& s : c->slots)
+                {
+                    int expected = slot_full;
+                    if (s.state.load(std::memory_order_relaxed) == slot_full &&
+                        s.state.compare_exchange_strong(expected, slot_busy, std::memory_order_acquire))
+                    {
+                        buffer = std::move(s.buffer);
+                        s.buffer = std::vector<byte>();
+                        s.state.store(slot_empty, std::memory_order_release);
+                        ++_hits;
+                        return true;
+                    }
+                }
+            }
+            ++_misses;
+            return false;
+        }
+
+        // Return a buffer to the pool, stamped with the (frame) time it was released at
+        void release(std::vector<byte>&& buffer, rs2_time_t now)
+        {
+            if (buffer.empty())
+                return;
+
+            if (auto c = find_class(buffer.size(), true))
+            {
+                for (auto&& s : c->slots)
+                {
+                    int expected = slot_empty;
+                    if (s.state.load(std::memory_order_relaxed) == slot_empty &&
+                        s.state.compare_exchange_strong(expected, slot_busy, std::memory_order_acquire))
+                    {
+                        s.buffer = std::move(buffer);
+                        s.released_at = now;
+                        s.state.store(slot_full, std::memory_order_release);
+                        return;
+                    }
+                }
+            }
+            // No room for this buffer, let it go back to the heap
+            ++_evictions;
+        }
+
+        // Free buffers that were not reused for longer than max_buffer_age.
+        // Cheap to call on every frame - only one caller per period actually sweeps.
+        void evict_stale(rs2_time_t now)
+        {
+            auto last = _last_sweep.load(std::memory_order_relaxed);
+            // Timestamps going backwards (e.g. stream restart) restart the sweep period as well
+            if (now >= last && now < last + max_buffer_age)
+                return;
+            if (!_last_sweep.compare_exchange_strong(last, now))
+                return;
+
+            for (auto&& c : _classes)
+            {
+                auto size = c.size.load(std::memory_order_acquire);
+                if (!size) continue;
+
+                auto in_use = false;
+                for (auto&& s : c.slots)
+                {
+                    int expected = s.state.load(std::memory_order_relaxed);
+                    if (expected != slot_full ||
+                        !s.state.compare_exchange_strong(expected, slot_busy, std::memory_order_acquire))
+                    {
+                        in_use |= (expected != slot_empty);
+                        continue;
+                    }
+
+                    if (now > s.released_at + max_buffer_age || now < s.released_at)
+                    {
+                        s.buffer = std::vector<byte>();
+                        ++_evictions;
+                        s.state.store(slot_empty, std::memory_order_release);
+                    }
+                    else
+                    {
+                        in_use = true;
+                        s.state.store(slot_full, std::memory_order_release);
+                    }
+                }
+
+                // Give the size class back so that a different resolution can use it.
+                // A release racing with this may still park a buffer of the old size here;
+                // acquire callers resize the buffer they get, so this only costs a reallocation.
+                if (!in_use)
+                    c.size.compare_exchange_strong(size, 0);
+            }
+        }
+
+        // Free all pooled buffers
+        void clear()
+        {
+            for (auto&& c : _classes)
+            {
+                for (auto&& s : c.slots)
+                {
+                    int expected = slot_full;
+                    if (s.state.compare_exchange_strong(expected, slot_busy, std::memory_order_acquire))
+                    {
+                        s.buffer = std::vector<byte>();
+                        s.state.store(slot_empty, std::memory_order_release);
+                    }
+                }
+                c.size = 0;
+            }
+        }
+
+        frame_buffer_pool_stats get_stats() const
+        {
+            frame_buffer_pool_stats res;
+            res.hits = _hits.load();
+            res.misses = _misses.load();
+            res.evictions = _evictions.load();
+            return res;
+        }
+
+    private:
+        enum slot_state : int { slot_empty, slot_busy, slot_full };
+
+        struct slot
+        {
+            slot() : state(slot_empty), released_at(0) {}
+
+            std::atomic<int> state;
+            std::vector<byte> buffer;
+            rs2_time_t released_at;
+        };
+
+        struct size_class
+        {
+            size_class() : size(0) {}
+
+            std::atomic<size_t> size;
+            std::array<slot, slots_per_class> slots;
+        };
+
+        size_class* find_class(size_t size, bool create)
+        {
+            for (auto&& c : _classes)
+            {
+                if (c.size.load(std::memory_order_acquire) == size)
+                    return &c;
+            }
+
+            if (create)
+            {
+                for (auto&& c : _classes)
+                {
+                    size_t expected = 0;
+                    if (c.size.compare_exchange_strong(expected, size) || expected == size)
+                        return &c;
+                }
+            }
+            return nullptr;
+        }
+
+        std::array<size_class, max_size_classes> _classes;
+        std::atomic<rs2_time_t> _last_sweep;
+        std::atomic<unsigned long long> _hits;
+        std::atomic<unsigned long long> _misses;
+        std::atomic<unsigned long long> _evictions;
+    };
+}
@@ -106,7 +106,7 @@ namespace librealsense
                         auto orig = (librealsense::frame_interface*)f.get();
                         auto depth_data = (uint16_t*)orig->get_frame_data();
 
-                        memcpy(ptr->data.data(), depth_data, ptr->data.size());
+                        memcpy((void*)ptr->get_frame_data(), depth_data, ptr->get_frame_data_size());
 
                         ptr->set_sensor(orig->get_sensor());
                         orig->acquire();
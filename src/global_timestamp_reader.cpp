@@ -22,20 +22,30 @@ namespace librealsense
     CLinearCoefficients::CLinearCoefficients(unsigned int buffer_size) :
         _base_sample(0, 0),
         _buffer_size(buffer_size),
+        _coefs{ 0, 0, 1, 0, 0, 0, 0 },
+        _published(_coefs),
         _time_span_ms(1000) // Spread the linear equation modifications over a whole second.
     {
     }
 
     void CLinearCoefficients::reset()
     {
+        std::lock_guard<std::recursive_mutex> lock(_add_mtx);
         _last_values.clear();
     }
 
     bool CLinearCoefficients::is_full() const
     {
+        std::lock_guard<std::recursive_mutex> lock(_add_mtx);
         return _last_values.size() >= _buffer_size;
     }
 
+    int CLinearCoefficients::size() const
+    {
+        std::lock_guard<std::recursive_mutex> lock(_add_mtx);
+        return static_cast<int>(_last_values.size());
+    }
+
     void CLinearCoefficients::add_value(CSample val)
     {
         std::lock_guard<std::recursive_mutex> lock(_add_mtx);   // Redandent as only being read from update_diff_time() and there is a lock there.
@@ -59,10 +69,10 @@ namespace librealsense
         if (n == 1)
         {
             _base_sample = _last_values.back();
-            _dest_a = 1;
-            _dest_b = 0;
-            _prev_a = 0;
-            _prev_b = 0;
+            _coefs.dest_a = 1;
+            _coefs.dest_b = 0;
+            _coefs.prev_a = 0;
+            _coefs.prev_b = 0;
         }
         else
         {
@@ -82,34 +92,41 @@ namespace librealsense
             b = (sum_y*sum_x2 - sum_x * sum_xy) / (n*sum_x2 - sum_x * sum_x);
             a = (n*sum_xy - sum_x * sum_y) / (n*sum_x2 - sum_x * sum_x);
 
-            if (crnt_time - _prev_time < _time_span_ms)
+            if (crnt_time - _coefs.prev_time < _time_span_ms)
             {
-                dt = (crnt_time - _prev_time) / _time_span_ms;
+                dt = (crnt_time - _coefs.prev_time) / _time_span_ms;
             }
         }
-        std::lock_guard<std::recursive_mutex> lock(_stat_mtx);
-        _prev_a = _dest_a * dt + _prev_a * (1 - dt);
-        _prev_b = _dest_b * dt + _prev_b * (1 - dt);
-        _dest_a = a;
-        _dest_b = b;
-        _prev_time = crnt_time;
+        _coefs.prev_a = _coefs.dest_a * dt + _coefs.prev_a * (1 - dt);
+        _coefs.prev_b = _coefs.dest_b * dt + _coefs.prev_b * (1 - dt);
+        _coefs.dest_a = a;
+        _coefs.dest_b = b;
+        _coefs.prev_time = crnt_time;
+        _coefs.base_x = _base_sample._x;
+        _coefs.base_y = _base_sample._y;
+        _published.store(_coefs);
     }
 
     double CLinearCoefficients::calc_value(double x) const
     {
-        std::lock_guard<std::recursive_mutex> lock(_stat_mtx);
-        double a(_dest_a), b(_dest_b);
-        if (x - _prev_time < _time_span_ms)
+        auto coefs = _published.load();
+        double a(coefs.dest_a), b(coefs.dest_b);
+        if (x - coefs.prev_time < _time_span_ms)
         {
-            double dt( (x - _prev_time) / _time_span_ms );
-            a = _dest_a * dt + _prev_a * (1 - dt);
-            b = _dest_b * dt + _prev_b * (1 - dt);
+            double dt( (x - coefs.prev_time) / _time_span_ms );
+            a = coefs.dest_a * dt + coefs.prev_a * (1 - dt);
+            b = coefs.dest_b * dt + coefs.prev_b * (1 - dt);
         }
-        double y(a * (x - _base_sample._x) + b + _base_sample._y);
-        LOG_DEBUG("CLinearCoefficients::calc_value: " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << _base_sample._x << ", " << _base_sample._y);
+        double y(a * (x - coefs.base_x) + b + coefs.base_y);
+        LOG_DEBUG("CLinearCoefficients::calc_value: " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << coefs.base_x << ", " << coefs.base_y);
         return y;
     }
 
+    double CLinearCoefficients::get_slope() const
+    {
+        return _published.load().dest_a;
+    }
+
     time_diff_keeper::time_diff_keeper(global_time_interface* dev, const unsigned int sampling_interval_ms) :
         _device(dev),
         _poll_intervals_ms(sampling_interval_ms),
@@ -174,16 +191,26 @@ namespace librealsense
                 // A time loop happend:
                 //LOG_DEBUG("time_diff_keeper::call reset()");
                 _coefs.reset();
+                _stats.resets++;
             }
+            _stats.residual = _is_ready && _coefs.size() ? system_time - _coefs.calc_value(sample_hw_time) : 0;
             _last_sample_hw_time = sample_hw_time;
-            CSample crnt_sample(_last_sample_hw_time, system_time);
+            CSample crnt_sample(sample_hw_time, system_time);
             _coefs.add_value(crnt_sample);
             _is_ready = true;
+
+            _stats.updates++;
+            _stats.samples = _coefs.size();
+            _stats.drift_ppm = (_coefs.get_slope() - 1) * 1e6;
+            _stats.offset = system_time - sample_hw_time;
+            _stats.last_update = system_time;
+            _published_stats.store(_stats);
             return true;
         }
         catch (const io_exception& ex)
         {
             LOG_DEBUG("Temporary skip during time_diff_keeper polling: " << ex.what());
+            count_failure();
         }
         catch (const wrong_api_call_sequence_exception& ex)
         {
@@ -192,14 +219,28 @@ namespace librealsense
         catch (const std::exception& ex)
         {
             LOG_ERROR("Error during time_diff_keeper polling: " << ex.what());
+            count_failure();
         }
         catch (...)
         {
             LOG_ERROR("Unknown error during time_diff_keeper polling!");
+            count_failure();
         }
         return false;
     }
 
+    void time_diff_keeper::count_failure()
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mtx);
+        _stats.failures++;
+        _published_stats.store(_stats);
+    }
+
+    rs2_global_time_stats time_diff_keeper::get_stats() const
+    {
+        return _published_stats.load();
+    }
+
     void time_diff_keeper::polling(dispatcher::cancellable_timer cancellable_timer)
     {
         unsigned int time_to_sleep = _poll_intervals_ms + _coefs.is_full() * (9 * _poll_intervals_ms);
@@ -216,6 +257,7 @@ namespace librealsense
     double time_diff_keeper::get_system_hw_time(double crnt_hw_time, bool& is_ready)
     {
         static const double possible_loop_time(3000);
+        if ((_last_sample_hw_time - crnt_hw_time) > possible_loop_time)
         {
             std::lock_guard<std::recursive_mutex> lock(_read_mtx);
             if ((_last_sample_hw_time - crnt_hw_time) > possible_loop_time)
@@ -248,7 +290,11 @@ namespace librealsense
         {
             auto sp = _time_diff_keeper.lock();
             if (sp)
-                frame_time = sp->get_system_hw_time(frame_time, _ts_is_ready);
+            {
+                bool is_ready;
+                frame_time = sp->get_system_hw_time(frame_time, is_ready);
+                _ts_is_ready = is_ready;
+            }
             else
                 LOG_DEBUG("Notification: global_timestamp_reader - time_diff_keeper is being shut-down");
         }
@@ -38,20 +38,30 @@ namespace librealsense
         void add_value(CSample val);
         void update_linear_coefs(double x);
         double calc_value(double x) const;
+        double get_slope() const;
         bool is_full() const;
+        int size() const;
 
     private:
+        // Everything calc_value() needs, published as a whole so that conversions never wait for an update
+        struct coefs
+        {
+            double prev_a, prev_b;  //Linear regression coeffitions - previously used values.
+            double dest_a, dest_b;  //Linear regression coeffitions - recently calculated.
+            double prev_time;
+            double base_x, base_y;
+        };
+
         void calc_linear_coefs();
 
     private:
         unsigned int _buffer_size;
         std::deque<CSample> _last_values;
         CSample _base_sample;
-        double _prev_a, _prev_b;    //Linear regression coeffitions - previously used values.
-        double _dest_a, _dest_b;    //Linear regression coeffitions - recently calculated.
-        double _prev_time, _time_span_ms;
+        coefs _coefs;               // Written by the updater only, under _add_mtx
+        seqlock<coefs> _published;
+        double _time_span_ms;
         mutable std::recursive_mutex _add_mtx;
-        mutable std::recursive_mutex _stat_mtx;
     };
 
     class global_time_interface;
@@ -64,22 +74,26 @@ namespace librealsense
         void stop();
         ~time_diff_keeper();
         double get_system_hw_time(double crnt_hw_time, bool& is_ready);
+        rs2_global_time_stats get_stats() const;
 
     private:
         bool update_diff_time();
+        void count_failure();
         void polling(dispatcher::cancellable_timer cancellable_timer);
 
     private:
         global_time_interface* _device;
-        double _last_sample_hw_time;
+        std::atomic<double> _last_sample_hw_time;
         unsigned int _poll_intervals_ms;
         int             _users_count;
         active_object<> _active_object;
         mutable std::recursive_mutex _mtx;      // Watch the update process
-        mutable std::recursive_mutex _read_mtx; // Watch only 1 reader at a time.
+        mutable std::recursive_mutex _read_mtx; // Watch only 1 reader at a time, when the device clock looks like it wrapped around.
         mutable std::recursive_mutex _enable_mtx; // Watch only 1 start/stop operation at a time.
         CLinearCoefficients _coefs;
-        bool _is_ready;
+        std::atomic<bool> _is_ready;
+        rs2_global_time_stats _stats = {};      // Written under _mtx
+        seqlock<rs2_global_time_stats> _published_stats;
     };
 
     class global_timestamp_reader : public frame_timestamp_reader
@@ -97,9 +111,8 @@ namespace librealsense
     private:
         std::unique_ptr<frame_timestamp_reader> _device_timestamp_reader;
         std::weak_ptr<time_diff_keeper> _time_diff_keeper;
-        mutable std::recursive_mutex _mtx;
         std::shared_ptr<global_time_option> _option_is_enabled;
-        bool _ts_is_ready;
+        std::atomic<bool> _ts_is_ready;     // Written on the frame thread, read by get_frame_timestamp_domain()
     };
 
     class global_time_interface : public recordable<global_time_interface>
@@ -111,6 +124,7 @@ namespace librealsense
         global_time_interface();
         ~global_time_interface() { _tf_keeper.reset(); }
         void enable_time_diff_keeper(bool is_enable);
+        rs2_global_time_stats get_global_time_stats() const { return _tf_keeper->get_stats(); }
         virtual double get_device_time_ms() = 0; // Returns time in miliseconds.
         virtual void create_snapshot(std::shared_ptr<global_time_interface>& snapshot) const override {}
         virtual void enable_recording(std::function<void(const global_time_interface&)> record_action) override {}
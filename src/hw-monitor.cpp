@@ -1,6 +1,7 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 #include "hw-monitor.h"
+#include "device-cache.h"
 #include "types.h"
 #include <iomanip>
 
@@ -112,12 +113,74 @@ namespace librealsense
         update_cmd_details(details, receivedCmdLen, outputBuffer);
     }
 
+    void hw_monitor::set_cache(std::shared_ptr<device_cache> cache, std::set<uint8_t> cached_opcodes, std::set<uint8_t> invalidating_opcodes)
+    {
+        _cache = std::move(cache);
+        _cached_opcodes = std::move(cached_opcodes);
+        _invalidating_opcodes = std::move(invalidating_opcodes);
+        if (_cache && !_revalidation)
+        {
+            _revalidation = std::make_shared<dispatcher>(32);
+            _revalidation->start();
+        }
+    }
+
+    void hw_monitor::revalidate(const std::string& key, const command& cmd) const
+    {
+        auto cache = _cache;
+        auto generation = cache->get_generation();
+        _revalidation->invoke([this, cache, key, cmd, generation](dispatcher::cancellable_timer)
+        {
+            try
+            {
+                if (cache->refresh(key, send_uncached(cmd), generation))
+                    LOG_WARNING("Device data " << key << " was changed outside of the cache " << cache->get_path()
+                        << ", the cache is updated and the new value is used the next time the device is created");
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_DEBUG("Failed to validate the cached device data " << key << ": " << ex.what());
+            }
+        });
+    }
+
     std::vector<uint8_t> hw_monitor::send(std::vector<uint8_t> data) const
     {
+        // Raw commands are laid out as fill_usb_buffer() does - the opcode follows the length and the magic number
+        if (_cache && data.size() >= 2 * sizeof(uint32_t))
+        {
+            uint32_t opcode;
+            memcpy(&opcode, data.data() + sizeof(uint32_t), sizeof(opcode));
+            if (opcode <= 0xff && _invalidating_opcodes.count(static_cast<uint8_t>(opcode)))
+                _cache->clear();
+        }
         return _locked_transfer->send_receive(data);
     }
 
     std::vector<uint8_t> hw_monitor::send(command cmd) const
+    {
+        if (!_cache)
+            return send_uncached(cmd);
+
+        if (_invalidating_opcodes.count(cmd.cmd))
+            _cache->clear();
+        if (!_cached_opcodes.count(cmd.cmd) || !cmd.data.empty() || !cmd.require_response)
+            return send_uncached(cmd);
+
+        std::string key = to_string() << std::hex << "hwm-" << int(cmd.cmd) << "-" << cmd.param1 << "-" << cmd.param2 << "-" << cmd.param3 << "-" << cmd.param4;
+        std::vector<uint8_t> res;
+        if (_cache->get(key, res))
+        {
+            // Calibration written by another tool leaves the descriptor that validated the cache unchanged
+            revalidate(key, cmd);
+            return res;
+        }
+        res = send_uncached(cmd);
+        _cache->put(key, res);
+        return res;
+    }
+
+    std::vector<uint8_t> hw_monitor::send_uncached(const command& cmd) const
     {
         hwmon_cmd newCommand(cmd);
         auto opCodeXmit = static_cast<uint32_t>(newCommand.cmd);
@@ -5,6 +5,7 @@
 
 #include "sensor.h"
 #include <mutex>
+#include <set>
 #include "command_transfer.h"
 
 namespace librealsense
@@ -252,6 +253,8 @@ namespace librealsense
         }
     };
 
+    class device_cache;
+
     class hw_monitor
     {
         struct hwmon_cmd
@@ -312,13 +315,24 @@ namespace librealsense
         void execute_usb_command(uint8_t *out, size_t outSize, uint32_t& op, uint8_t* in, size_t& inSize) const;
         static void update_cmd_details(hwmon_cmd_details& details, size_t receivedCmdLen, unsigned char* outputBuffer);
         void send_hw_monitor_command(hwmon_cmd_details& details) const;
+        std::vector<uint8_t> send_uncached(const command& cmd) const;
+        void revalidate(const std::string& key, const command& cmd) const;
 
         std::shared_ptr<locked_transfer> _locked_transfer;
+        std::shared_ptr<device_cache> _cache;
+        std::set<uint8_t> _cached_opcodes;
+        std::set<uint8_t> _invalidating_opcodes;
+        // Declared last, so that the read in flight completes while the transfer and the cache are still alive
+        std::shared_ptr<dispatcher> _revalidation;
     public:
         explicit hw_monitor(std::shared_ptr<locked_transfer> locked_transfer)
             : _locked_transfer(std::move(locked_transfer))
         {}
 
+        // Serves the responses to the cached opcodes from the cache, and clears it on any of the invalidating opcodes.
+        // Every response served from the cache is read again from the device in the background, and refreshed in it
+        void set_cache(std::shared_ptr<device_cache> cache, std::set<uint8_t> cached_opcodes, std::set<uint8_t> invalidating_opcodes);
+
         std::vector<uint8_t> send(std::vector<uint8_t> data) const;
         std::vector<uint8_t> send(command cmd) const;
         void get_gvd(size_t sz, unsigned char* gvd, uint8_t gvd_cmd) const;
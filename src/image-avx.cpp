@@ -1,23 +1,23 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
-#define _USE_MATH_DEFINES
-#include <cmath>
 #include "image-avx.h"
 
+#include <assert.h>
+
 //#include "../include/librealsense2/rsutil.h" // For projection/deprojection logic
 
-#ifndef ANDROID
-    #if defined(__SSSE3__) && defined(__AVX2__)
+#if !defined(ANDROID) && defined(__SSSE3__) && defined(__AVX2__)
     #include <tmmintrin.h> // For SSE3 intrinsic used in unpack_yuy2_sse
     #include <immintrin.h>
 
     #pragma pack(push, 1) // All structs in this file are assumed to be byte-packed
     namespace librealsense
     {
-        template<rs2_format FORMAT> void unpack_yuy2(byte * const d[], const byte * s, int n)
+        // Unpacks YUY2 (or UYVY when the UYVY parameter is set), 32 pixels per iteration
+        template<rs2_format FORMAT, bool UYVY> void unpack_yuy2_avx2(byte * const d[], const byte * s, int n)
         {
-            assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
+            assert(n % avx2_block_pixels == 0);
 
             auto src = reinterpret_cast<const __m256i *>(s);
             auto dst = reinterpret_cast<__m256i *>(d[0]);
@@ -39,20 +39,27 @@
                 __m256i s0 = _mm256_loadu_si256(&src[i * 2]);
                 __m256i s1 = _mm256_loadu_si256(&src[i * 2 + 1]);
 
+                const __m256i evens = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                    0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+                const __m256i odds = _mm256_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14,
+                    1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14);
+
                 if (FORMAT == RS2_FORMAT_Y8)
                 {
                     // Align all Y components and output 32 pixels (32 bytes) at once
-                    __m256i y0 = _mm256_shuffle_epi8(s0, _mm256_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14,
-                        1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14));
-                    __m256i y1 = _mm256_shuffle_epi8(s1, _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
-                        0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
-                    _mm256_storeu_si256(&dst[i], _mm256_alignr_epi8(y0, y1, 8));
+                    __m256i y0 = _mm256_shuffle_epi8(s0, UYVY ? evens : odds);  // Y components in the high order bytes
+                    __m256i y1 = _mm256_shuffle_epi8(s1, UYVY ? odds : evens);  // Y components in the low order bytes
+                    // Each lane now holds 8 pixels of s0 followed by 8 pixels of s1, restore the pixels order
+                    _mm256_storeu_si256(&dst[i], _mm256_permute4x64_epi64(_mm256_alignr_epi8(y1, y0, 8), _MM_SHUFFLE(3, 1, 2, 0)));
                     continue;
                 }
 
                 // Shuffle all Y components to the low order bytes of the register, and all U/V components to the high order bytes
-                const __m256i evens_odd1s_odd3s = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15,
-                    0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15); // to get yyyyyyyyuuuuvvvvyyyyyyyyuuuuvvvv
+                const __m256i evens_odd1s_odd3s = UYVY ?
+                    _mm256_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14,
+                        1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14) :
+                    _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15,
+                        0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15); // to get yyyyyyyyuuuuvvvvyyyyyyyyuuuuvvvv
                 __m256i yyyyyyyyuuuuvvvv0 = _mm256_shuffle_epi8(s0, evens_odd1s_odd3s);
                 __m256i yyyyyyyyuuuuvvvv8 = _mm256_shuffle_epi8(s1, evens_odd1s_odd3s);
 
@@ -218,11 +225,11 @@
                         // Shuffle rgb triples to the start and end of each register
                         __m128i bgr0 = _mm_shuffle_epi8(rgba0, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
                         __m128i bgr1 = _mm_shuffle_epi8(rgba1, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i bgr2 = _mm_shuffle_epi8(rgba2, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 1));
+                        __m128i bgr2 = _mm_shuffle_epi8(rgba2, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
                         __m128i bgr3 = _mm_shuffle_epi8(rgba3, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
                         __m128i bgr4 = _mm_shuffle_epi8(rgba4, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
                         __m128i bgr5 = _mm_shuffle_epi8(rgba5, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i bgr6 = _mm_shuffle_epi8(rgba6, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 1));
+                        __m128i bgr6 = _mm_shuffle_epi8(rgba6, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
                         __m128i bgr7 = _mm_shuffle_epi8(rgba7, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
 
                         __m128i a1 = _mm_alignr_epi8(bgr1, bgr0, 4);
@@ -250,32 +257,38 @@
             }
         }
 
-        void unpack_yuy2_avx_y8(byte * const d[], const byte * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_Y8>(d, s, n);
-        }
-        void unpack_yuy2_avx_y16(byte * const d[], const byte * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_Y16>(d, s, n);
-        }
-        void unpack_yuy2_avx_rgb8(byte * const d[], const byte * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_RGB8>(d, s, n);
-        }
-        void unpack_yuy2_avx_rgba8(byte * const d[], const byte * s, int n)
-        {
-            unpack_yuy2<RS2_FORMAT_RGBA8>(d, s, n);
-        }
-        void unpack_yuy2_avx_bgr8(byte * const d[], const byte * s, int n)
+        unpack_kernel get_yuy2_avx2_kernel(rs2_format dst_format)
         {
-            unpack_yuy2<RS2_FORMAT_BGR8>(d, s, n);
+            switch (dst_format)
+            {
+            case RS2_FORMAT_Y8: return unpack_yuy2_avx2<RS2_FORMAT_Y8, false>;
+            case RS2_FORMAT_Y16: return unpack_yuy2_avx2<RS2_FORMAT_Y16, false>;
+            case RS2_FORMAT_RGB8: return unpack_yuy2_avx2<RS2_FORMAT_RGB8, false>;
+            case RS2_FORMAT_RGBA8: return unpack_yuy2_avx2<RS2_FORMAT_RGBA8, false>;
+            case RS2_FORMAT_BGR8: return unpack_yuy2_avx2<RS2_FORMAT_BGR8, false>;
+            case RS2_FORMAT_BGRA8: return unpack_yuy2_avx2<RS2_FORMAT_BGRA8, false>;
+            default: return nullptr;
+            }
         }
-        void unpack_yuy2_avx_bgra8(byte * const d[], const byte * s, int n)
+
+        unpack_kernel get_uyvy_avx2_kernel(rs2_format dst_format)
         {
-            unpack_yuy2<RS2_FORMAT_BGRA8>(d, s, n);
+            switch (dst_format)
+            {
+            case RS2_FORMAT_RGB8: return unpack_yuy2_avx2<RS2_FORMAT_RGB8, true>;
+            case RS2_FORMAT_RGBA8: return unpack_yuy2_avx2<RS2_FORMAT_RGBA8, true>;
+            case RS2_FORMAT_BGR8: return unpack_yuy2_avx2<RS2_FORMAT_BGR8, true>;
+            case RS2_FORMAT_BGRA8: return unpack_yuy2_avx2<RS2_FORMAT_BGRA8, true>;
+            default: return nullptr;
+            }
         }
     }
 
     #pragma pack(pop)
-    #endif
+#else
+    namespace librealsense
+    {
+        unpack_kernel get_yuy2_avx2_kernel(rs2_format) { return nullptr; }
+        unpack_kernel get_uyvy_avx2_kernel(rs2_format) { return nullptr; }
+    }
 #endif
@@ -5,20 +5,28 @@
 #ifndef LIBREALSENSE_IMAGE_AVX_H
 #define LIBREALSENSE_IMAGE_AVX_H
 
-#include "types.h"
+// Only plain C declarations are included here: the implementation files are compiled with AVX2 / AVX-512
+// code generation, and any inline C++ function instantiated there could be picked by the linker for the
+// whole library, crashing CPUs without these instruction sets
+#include "../include/librealsense2/h/rs_sensor.h"
+#include <stdint.h>
 
 namespace librealsense
 {
-#ifndef ANDROID
-    #if defined(__SSSE3__) && defined(__AVX2__)
-    void unpack_yuy2_avx_y8(byte * const d[], const byte * s, int n);
-    void unpack_yuy2_avx_y16(byte * const d[], const byte * s, int n);
-    void unpack_yuy2_avx_rgb8(byte * const d[], const byte * s, int n);
-    void unpack_yuy2_avx_rgba8(byte * const d[], const byte * s, int n);
-    void unpack_yuy2_avx_bgr8(byte * const d[], const byte * s, int n);
-    void unpack_yuy2_avx_bgra8(byte * const d[], const byte * s, int n);
-    #endif
-#endif
+    typedef uint8_t byte;
+
+    // Unpacks n pixels, n being a multiple of the kernel's block size
+    typedef void(*unpack_kernel)(byte * const d[], const byte * s, int n);
+
+    const int avx2_block_pixels = 32;
+    const int avx512_block_pixels = 64;
+
+    // The kernels are selected at runtime - each getter returns nullptr when the library was built
+    // without the respective instruction set, or the target format is not supported
+    unpack_kernel get_yuy2_avx2_kernel(rs2_format dst_format);
+    unpack_kernel get_uyvy_avx2_kernel(rs2_format dst_format);
+    unpack_kernel get_yuy2_avx512_kernel(rs2_format dst_format);
+    unpack_kernel get_uyvy_avx512_kernel(rs2_format dst_format);
 }
 
 #endif
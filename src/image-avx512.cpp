@@ -0,0 +1,188 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "image-avx.h"
+
+#include <assert.h>
+
+#if !defined(ANDROID) && defined(__AVX512F__) && defined(__AVX512BW__)
+    #include <immintrin.h>
+
+    namespace librealsense
+    {
+        // Byte shuffles and alignments operate within 128-bit lanes, so every lane runs the SSSE3 algorithm
+        // on its own group of 16 pixels. The loads deinterleave the source so that lane k of both registers
+        // belongs to group k, and the stores transpose the lanes back to pixel order.
+        #define LANE_MASK(...) _mm512_broadcast_i32x4(_mm_setr_epi8(__VA_ARGS__))
+
+        // Unpacks YUY2 (or UYVY when the UYVY parameter is set), 64 pixels per iteration
+        template<rs2_format FORMAT, bool UYVY> void unpack_yuy2_avx512(byte * const d[], const byte * s, int n)
+        {
+            assert(n % avx512_block_pixels == 0);
+
+            auto src = reinterpret_cast<const __m512i *>(s);
+            auto dst = reinterpret_cast<__m512i *>(d[0]);
+
+            #pragma omp parallel for
+            for (int i = 0; i < n / 64; i++)
+            {
+                const __m512i zero = _mm512_setzero_si512();
+                const __m512i n100 = _mm512_set1_epi16(100 << 4);
+                const __m512i n208 = _mm512_set1_epi16(208 << 4);
+                const __m512i n298 = _mm512_set1_epi16(298 << 4);
+                const __m512i n409 = _mm512_set1_epi16(409 << 4);
+                const __m512i n516 = _mm512_set1_epi16(516 << 4);
+                const __m512i evens_odds = LANE_MASK(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+                const __m512i odds_evens = LANE_MASK(1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14);
+
+                // Load 64 pixels as 8 groups of 8, even groups into s0 and odd groups into s1
+                __m512i l0 = _mm512_loadu_si512(&src[i * 2]);
+                __m512i l1 = _mm512_loadu_si512(&src[i * 2 + 1]);
+                __m512i s0 = _mm512_permutex2var_epi64(l0, _mm512_setr_epi64(0, 1, 4, 5, 8, 9, 12, 13), l1);
+                __m512i s1 = _mm512_permutex2var_epi64(l0, _mm512_setr_epi64(2, 3, 6, 7, 10, 11, 14, 15), l1);
+
+                if (FORMAT == RS2_FORMAT_Y8)
+                {
+                    // Align all Y components, lane k holds pixels 16k..16k+15 so 64 pixels (64 bytes) are stored at once
+                    __m512i y0 = _mm512_shuffle_epi8(s0, UYVY ? evens_odds : odds_evens);
+                    __m512i y1 = _mm512_shuffle_epi8(s1, UYVY ? odds_evens : evens_odds);
+                    _mm512_storeu_si512(&dst[i], _mm512_alignr_epi8(y1, y0, 8));
+                    continue;
+                }
+
+                // Shuffle all Y components to the low order bytes of each lane, and all U/V components to the high order bytes
+                const __m512i evens_odd1s_odd3s = UYVY ?
+                    LANE_MASK(1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14) :
+                    LANE_MASK(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15); // to get yyyyyyyyuuuuvvvv
+                __m512i yyyyyyyyuuuuvvvv0 = _mm512_shuffle_epi8(s0, evens_odd1s_odd3s);
+                __m512i yyyyyyyyuuuuvvvv8 = _mm512_shuffle_epi8(s1, evens_odd1s_odd3s);
+
+                // Retrieve all Y components as 16-bit values (8 components per lane)
+                __m512i y16__0_7 = _mm512_unpacklo_epi8(yyyyyyyyuuuuvvvv0, zero);
+                __m512i y16__8_F = _mm512_unpacklo_epi8(yyyyyyyyuuuuvvvv8, zero);
+
+                if (FORMAT == RS2_FORMAT_Y16)
+                {
+                    // Interleave the lanes of both halves and output 64 pixels (128 bytes) at once
+                    __m512i y0 = _mm512_slli_epi16(y16__0_7, 8);
+                    __m512i y1 = _mm512_slli_epi16(y16__8_F, 8);
+                    _mm512_storeu_si512(&dst[i * 2], _mm512_permutex2var_epi64(y0, _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11), y1));
+                    _mm512_storeu_si512(&dst[i * 2 + 1], _mm512_permutex2var_epi64(y0, _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15), y1));
+                    continue;
+                }
+
+                // Retrieve all U and V components as 16-bit values (8 components per lane)
+                __m512i uv = _mm512_unpackhi_epi32(yyyyyyyyuuuuvvvv0, yyyyyyyyuuuuvvvv8); // uuuuuuuuvvvvvvvv
+                __m512i u = _mm512_unpacklo_epi8(uv, uv);                                 // u's duplicated
+                __m512i v = _mm512_unpackhi_epi8(uv, uv);
+                __m512i u16__0_7 = _mm512_unpacklo_epi8(u, zero);
+                __m512i u16__8_F = _mm512_unpackhi_epi8(u, zero);
+                __m512i v16__0_7 = _mm512_unpacklo_epi8(v, zero);
+                __m512i v16__8_F = _mm512_unpackhi_epi8(v, zero);
+
+                // Compute R, G, B values for the first 8 pixels of each group
+                __m512i c16__0_7 = _mm512_slli_epi16(_mm512_subs_epi16(y16__0_7, _mm512_set1_epi16(16)), 4);
+                __m512i d16__0_7 = _mm512_slli_epi16(_mm512_subs_epi16(u16__0_7, _mm512_set1_epi16(128)), 4);
+                __m512i e16__0_7 = _mm512_slli_epi16(_mm512_subs_epi16(v16__0_7, _mm512_set1_epi16(128)), 4);
+                __m512i r16__0_7 = _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(zero, _mm512_add_epi16(_mm512_mulhi_epi16(c16__0_7, n298), _mm512_mulhi_epi16(e16__0_7, n409))));                                                 // (298 * c + 409 * e + 128)
+                __m512i g16__0_7 = _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(zero, _mm512_sub_epi16(_mm512_sub_epi16(_mm512_mulhi_epi16(c16__0_7, n298), _mm512_mulhi_epi16(d16__0_7, n100)), _mm512_mulhi_epi16(e16__0_7, n208)))); // (298 * c - 100 * d - 208 * e + 128)
+                __m512i b16__0_7 = _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(zero, _mm512_add_epi16(_mm512_mulhi_epi16(c16__0_7, n298), _mm512_mulhi_epi16(d16__0_7, n516))));                                                 // (298 * c + 516 * d + 128)
+
+                // Compute R, G, B values for the second 8 pixels of each group
+                __m512i c16__8_F = _mm512_slli_epi16(_mm512_subs_epi16(y16__8_F, _mm512_set1_epi16(16)), 4);
+                __m512i d16__8_F = _mm512_slli_epi16(_mm512_subs_epi16(u16__8_F, _mm512_set1_epi16(128)), 4);
+                __m512i e16__8_F = _mm512_slli_epi16(_mm512_subs_epi16(v16__8_F, _mm512_set1_epi16(128)), 4);
+                __m512i r16__8_F = _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(zero, _mm512_add_epi16(_mm512_mulhi_epi16(c16__8_F, n298), _mm512_mulhi_epi16(e16__8_F, n409))));
+                __m512i g16__8_F = _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(zero, _mm512_sub_epi16(_mm512_sub_epi16(_mm512_mulhi_epi16(c16__8_F, n298), _mm512_mulhi_epi16(d16__8_F, n100)), _mm512_mulhi_epi16(e16__8_F, n208))));
+                __m512i b16__8_F = _mm512_min_epi16(_mm512_set1_epi16(255), _mm512_max_epi16(zero, _mm512_add_epi16(_mm512_mulhi_epi16(c16__8_F, n298), _mm512_mulhi_epi16(d16__8_F, n516))));
+
+                // Both orders share the same code, only the first and the third channels are swapped
+                const bool rgb_order = (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8);
+                __m512i x16__0_7 = rgb_order ? r16__0_7 : b16__0_7;
+                __m512i z16__0_7 = rgb_order ? b16__0_7 : r16__0_7;
+                __m512i x16__8_F = rgb_order ? r16__8_F : b16__8_F;
+                __m512i z16__8_F = rgb_order ? b16__8_F : r16__8_F;
+
+                // Shuffle separate channel values into four registers storing four pixels per lane in (X, G, Z, A) order
+                __m512i xg8__0_7 = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(x16__0_7, evens_odds), _mm512_shuffle_epi8(g16__0_7, evens_odds));
+                __m512i za8__0_7 = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(z16__0_7, evens_odds), _mm512_set1_epi8(-1));
+                __m512i xgza_0_3 = _mm512_unpacklo_epi16(xg8__0_7, za8__0_7);
+                __m512i xgza_4_7 = _mm512_unpackhi_epi16(xg8__0_7, za8__0_7);
+
+                __m512i xg8__8_F = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(x16__8_F, evens_odds), _mm512_shuffle_epi8(g16__8_F, evens_odds));
+                __m512i za8__8_F = _mm512_unpacklo_epi8(_mm512_shuffle_epi8(z16__8_F, evens_odds), _mm512_set1_epi8(-1));
+                __m512i xgza_8_B = _mm512_unpacklo_epi16(xg8__8_F, za8__8_F);
+                __m512i xgza_C_F = _mm512_unpackhi_epi16(xg8__8_F, za8__8_F);
+
+                if (FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8)
+                {
+                    // Transpose the 4x4 lanes so that each register holds 16 consecutive pixels, store 64 pixels (256 bytes) at once
+                    __m512i t0 = _mm512_shuffle_i64x2(xgza_0_3, xgza_4_7, _MM_SHUFFLE(1, 0, 1, 0));
+                    __m512i t1 = _mm512_shuffle_i64x2(xgza_8_B, xgza_C_F, _MM_SHUFFLE(1, 0, 1, 0));
+                    __m512i t2 = _mm512_shuffle_i64x2(xgza_0_3, xgza_4_7, _MM_SHUFFLE(3, 2, 3, 2));
+                    __m512i t3 = _mm512_shuffle_i64x2(xgza_8_B, xgza_C_F, _MM_SHUFFLE(3, 2, 3, 2));
+                    _mm512_storeu_si512(&dst[i * 4], _mm512_shuffle_i64x2(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+                    _mm512_storeu_si512(&dst[i * 4 + 1], _mm512_shuffle_i64x2(t0, t1, _MM_SHUFFLE(3, 1, 3, 1)));
+                    _mm512_storeu_si512(&dst[i * 4 + 2], _mm512_shuffle_i64x2(t2, t3, _MM_SHUFFLE(2, 0, 2, 0)));
+                    _mm512_storeu_si512(&dst[i * 4 + 3], _mm512_shuffle_i64x2(t2, t3, _MM_SHUFFLE(3, 1, 3, 1)));
+                }
+
+                if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_BGR8)
+                {
+                    // Shuffle triples to the start and end of each lane
+                    __m512i xgz0 = _mm512_shuffle_epi8(xgza_0_3, LANE_MASK(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
+                    __m512i xgz1 = _mm512_shuffle_epi8(xgza_4_7, LANE_MASK(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
+                    __m512i xgz2 = _mm512_shuffle_epi8(xgza_8_B, LANE_MASK(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
+                    __m512i xgz3 = _mm512_shuffle_epi8(xgza_C_F, LANE_MASK(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
+
+                    // Align lanes, lane k of o0..o2 holds the 48 bytes of group k
+                    __m512i o0 = _mm512_alignr_epi8(xgz1, xgz0, 4);
+                    __m512i o1 = _mm512_alignr_epi8(xgz2, xgz1, 8);
+                    __m512i o2 = _mm512_alignr_epi8(xgz3, xgz2, 12);
+
+                    // Gather the 12 lanes in group order and store 64 pixels (192 bytes) at once
+                    __m512i t0 = _mm512_permutex2var_epi64(o0, _mm512_setr_epi64(0, 1, 8, 9, 0, 1, 2, 3), o1);     // o0[0] o1[0] ----- o0[1]
+                    __m512i t1 = _mm512_permutex2var_epi64(o0, _mm512_setr_epi64(10, 11, 0, 1, 4, 5, 12, 13), o1); // o1[1] ----- o0[2] o1[2]
+                    __m512i t2 = _mm512_permutex2var_epi64(o0, _mm512_setr_epi64(0, 1, 6, 7, 14, 15, 0, 1), o1);   // ----- o0[3] o1[3] -----
+                    _mm512_storeu_si512(&dst[i * 3], _mm512_permutex2var_epi64(t0, _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 6, 7), o2));
+                    _mm512_storeu_si512(&dst[i * 3 + 1], _mm512_permutex2var_epi64(t1, _mm512_setr_epi64(0, 1, 10, 11, 4, 5, 6, 7), o2));
+                    _mm512_storeu_si512(&dst[i * 3 + 2], _mm512_permutex2var_epi64(t2, _mm512_setr_epi64(12, 13, 2, 3, 4, 5, 14, 15), o2));
+                }
+            }
+        }
+
+        #undef LANE_MASK
+
+        unpack_kernel get_yuy2_avx512_kernel(rs2_format dst_format)
+        {
+            switch (dst_format)
+            {
+            case RS2_FORMAT_Y8: return unpack_yuy2_avx512<RS2_FORMAT_Y8, false>;
+            case RS2_FORMAT_Y16: return unpack_yuy2_avx512<RS2_FORMAT_Y16, false>;
+            case RS2_FORMAT_RGB8: return unpack_yuy2_avx512<RS2_FORMAT_RGB8, false>;
+            case RS2_FORMAT_RGBA8: return unpack_yuy2_avx512<RS2_FORMAT_RGBA8, false>;
+            case RS2_FORMAT_BGR8: return unpack_yuy2_avx512<RS2_FORMAT_BGR8, false>;
+            case RS2_FORMAT_BGRA8: return unpack_yuy2_avx512<RS2_FORMAT_BGRA8, false>;
+            default: return nullptr;
+            }
+        }
+
+        unpack_kernel get_uyvy_avx512_kernel(rs2_format dst_format)
+        {
+            switch (dst_format)
+            {
+            case RS2_FORMAT_RGB8: return unpack_yuy2_avx512<RS2_FORMAT_RGB8, true>;
+            case RS2_FORMAT_RGBA8: return unpack_yuy2_avx512<RS2_FORMAT_RGBA8, true>;
+            case RS2_FORMAT_BGR8: return unpack_yuy2_avx512<RS2_FORMAT_BGR8, true>;
+            case RS2_FORMAT_BGRA8: return unpack_yuy2_avx512<RS2_FORMAT_BGRA8, true>;
+            default: return nullptr;
+            }
+        }
+    }
+#else
+    namespace librealsense
+    {
+        unpack_kernel get_yuy2_avx512_kernel(rs2_format) { return nullptr; }
+        unpack_kernel get_uyvy_avx512_kernel(rs2_format) { return nullptr; }
+    }
+#endif
@@ -5,6 +5,7 @@
 #include "backend-hid.h"
 #include "backend.h"
 #include "types.h"
+#include "epoll-reactor.h"
 
 #include <thread>
 #include <chrono>
@@ -23,6 +24,7 @@ const size_t HID_DATA_ACTUAL_SIZE = 6;  // bytes
 const std::string IIO_DEVICE_PREFIX("iio:device");
 const std::string IIO_ROOT_PATH("/sys/bus/iio/devices");
 const std::string HID_CUSTOM_PATH("/sys/bus/platform/drivers/hid_sensor_custom");
+const int HID_IDLE_WARNING_MILLISECONDS = 5000;
 
 namespace librealsense
 {
@@ -457,12 +459,45 @@ namespace librealsense
             _inputs.clear();
         }
 
+        // Batched capture, enabled by LRS_HID_WATERMARK=<samples>: the kernel wakes the reader up only once
+        // that many samples were buffered, and the IIO buffers of all sensors are drained by a single
+        // epoll thread, all the pending samples of a sensor in one read(). Returns 0 when disabled.
+        static uint32_t get_hid_watermark()
+        {
+            auto watermark_var = getenv("LRS_HID_WATERMARK");
+            if (!watermark_var)
+                return 0;
+            auto watermark = atoi(watermark_var);
+            if (watermark <= 0)
+                return 0;
+            return std::min(static_cast<uint32_t>(watermark), hid_buf_len);
+        }
+
+        static std::shared_ptr<epoll_reactor> get_hid_reactor()
+        {
+            static std::mutex mtx;
+            static std::weak_ptr<epoll_reactor> instance;
+
+            std::lock_guard<std::mutex> lock(mtx);
+            if (auto res = instance.lock())
+                return res;
+
+            auto res = epoll_reactor::create(1);
+            instance = res;
+            return res;
+        }
+
         // start capturing and polling.
         void iio_hid_sensor::start_capture(hid_callback sensor_callback)
         {
             if (_is_capturing)
                 return;
 
+            // The watermark can only be changed while the buffer is disabled
+            auto watermark = get_hid_watermark();
+            if (watermark)
+                set_watermark(watermark);
+
             set_power(true);
             std::ostringstream iio_read_device_path;
             iio_read_device_path << "/dev/" << IIO_DEVICE_PREFIX << _iio_device_number;
@@ -507,6 +542,26 @@ namespace librealsense
 
             _callback = sensor_callback;
             _is_capturing = true;
+
+            if (watermark)
+            {
+                const uint32_t channel_size = get_channel_size();
+                auto metadata = has_metadata();
+                _raw_data.resize(channel_size * hid_buf_len);
+                _reactor = get_hid_reactor();
+                _reactor->add(_fd, [this, channel_size, metadata]()
+                {
+                    auto read_size = read(_fd, _raw_data.data(), _raw_data.size());
+                    if (read_size > 0)
+                        dispatch_samples(_raw_data.data(), read_size, channel_size, metadata);
+                },
+                [this]()
+                {
+                    LOG_WARNING("iio_hid_sensor: Frames didn't arrived within 5 seconds");
+                }, std::chrono::milliseconds(HID_IDLE_WARNING_MILLISECONDS));
+                return;
+            }
+
             _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
                 const uint32_t channel_size = get_channel_size();
                 size_t raw_data_size = channel_size*hid_buf_len;
@@ -552,46 +607,7 @@ namespace librealsense
                             continue;
                         }
 
-                        // TODO: code refactoring to reduce latency
-                        for (auto i = 0; i < read_size / channel_size; ++i)
-                        {
-                            auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
-                            auto p_raw_data = raw_data.data() + channel_size * i;
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
-
-                            auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
-                            // Populate HID IMU data - Header
-                            metadata_hid_raw meta_data{};
-                            meta_data.header.report_type = md_hid_report_type::hid_report_imu;
-                            meta_data.header.length = hid_header_size + metadata_imu_report_size;
-                            meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
-                            // Payload:
-                            meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
-                            meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
-//                            meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
-//                                                                                            md_hid_imu_attributes::imu_counter_attribute |
-//                                                                                            md_hid_imu_attributes::usb_counter_attribute);
-//                            meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
-//                            meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
-//                            meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
-
-                            sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
-                                            p_raw_data,  metadata? &meta_data : nullptr, now_ts};
-                            //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
-                            if (metadata)
-                            {
-                                //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
-                                //*ts_nsec /=1000;
-                                meta_data.header.timestamp /=1000;
-                            }
-
-//                            for (auto i=0ul; i<channel_size; i++)
-//                                std::cout << std::hex << int(p_raw_data[i]) << " ";
-//                            std::cout << std::dec << std::endl;
-
-                            this->_callback(sens_data);
-                        }
+                        dispatch_samples(raw_data.data(), read_size, channel_size, metadata);
                     }
                     else
                     {
@@ -601,6 +617,50 @@ namespace librealsense
             }));
         }
 
+        void iio_hid_sensor::dispatch_samples(uint8_t* raw_data, size_t read_size, uint32_t channel_size, bool metadata)
+        {
+            // TODO: code refactoring to reduce latency
+            for (auto i = 0; i < read_size / channel_size; ++i)
+            {
+                auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+                auto p_raw_data = raw_data + channel_size * i;
+                sensor_data sens_data{};
+                sens_data.sensor = hid_sensor{get_sensor_name()};
+
+                auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
+                // Populate HID IMU data - Header
+                metadata_hid_raw meta_data{};
+                meta_data.header.report_type = md_hid_report_type::hid_report_imu;
+                meta_data.header.length = hid_header_size + metadata_imu_report_size;
+                meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
+                // Payload:
+                meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
+                meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
+//                meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
+//                                                                                md_hid_imu_attributes::imu_counter_attribute |
+//                                                                                md_hid_imu_attributes::usb_counter_attribute);
+//                meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
+//                meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
+//                meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
+
+                sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
+                                p_raw_data,  metadata? &meta_data : nullptr, now_ts};
+                //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
+                if (metadata)
+                {
+                    //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
+                    //*ts_nsec /=1000;
+                    meta_data.header.timestamp /=1000;
+                }
+
+//                for (auto i=0ul; i<channel_size; i++)
+//                    std::cout << std::hex << int(p_raw_data[i]) << " ";
+//                std::cout << std::dec << std::endl;
+
+                this->_callback(sens_data);
+            }
+        }
+
         void iio_hid_sensor::stop_capture()
         {
             if (!_is_capturing)
@@ -608,8 +668,18 @@ namespace librealsense
 
             _is_capturing = false;
             set_power(false);
-            signal_stop();
-            _hid_thread->join();
+            if (_reactor)
+            {
+                // Restore the default, so that a later capture without batching is woken up by every sample
+                set_watermark(1);
+                _reactor->remove(_fd);
+                _reactor.reset();
+            }
+            else
+            {
+                signal_stop();
+                _hid_thread->join();
+            }
             _callback = nullptr;
             _channels.clear();
 
@@ -683,6 +753,20 @@ namespace librealsense
             },true);
         }
 
+        // Samples buffered by the kernel before a reader is woken up, applied asynchronously along with set_power
+        void iio_hid_sensor::set_watermark(uint32_t samples)
+        {
+            auto path = _iio_device_path + "/buffer/watermark";
+
+            _pm_dispatcher.invoke([path,samples](dispatcher::cancellable_timer /*t*/)
+            {
+                if (!write_fs_attribute(path, samples))
+                {
+                    LOG_WARNING("HID set_watermark " << samples << " failed for " << path);
+                }
+            },true);
+        }
+
         void iio_hid_sensor::signal_stop()
         {
             char buff[1];
@@ -14,6 +14,8 @@ namespace librealsense
     {
         const uint32_t hid_buf_len = 128;
 
+        class epoll_reactor;
+
         struct hid_input_info
         {
             std::string input = "";
@@ -148,9 +150,13 @@ namespace librealsense
 
             void set_frequency(uint32_t frequency);
             void set_power(bool on);
+            void set_watermark(uint32_t samples);
 
             void signal_stop();
 
+            // passes every sample of a read to the callback
+            void dispatch_samples(uint8_t* raw_data, size_t read_size, uint32_t channel_size, bool metadata);
+
             bool has_metadata();
 
             static bool sort_hids(hid_input* first, hid_input* second);
@@ -182,6 +188,8 @@ namespace librealsense
             hid_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
+            std::shared_ptr<epoll_reactor> _reactor;    // Batched capture, replaces _hid_thread
+            std::vector<uint8_t> _raw_data;
             std::unique_ptr<std::thread> _pm_thread;    // Delayed initialization due to power-up sequence
             dispatcher                  _pm_dispatcher; // Asynchronous power management
         };
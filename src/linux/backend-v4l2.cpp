@@ -3,6 +3,8 @@
 
 #include "backend-v4l2.h"
 #include "backend-hid.h"
+#include "epoll-reactor.h"
+#include "udev-device-watcher.h"
 #include "backend.h"
 #include "types.h"
 #include "usb/usb-enumerator.h"
@@ -247,7 +249,8 @@ namespace librealsense
         {
             if (_use_memory_map)
             {
-               if(munmap(_start, _length) < 0)
+               // Only the kernel buffer is mapped, without the metadata appendix counted in _length
+               if(munmap(_start, _original_length) < 0)
                    linux_backend_exception("munmap");
             }
             else
@@ -256,6 +259,26 @@ namespace librealsense
             }
         }
 
+        void buffer::detach_from_kernel()
+        {
+            // The kernel queue is about to be released, the frame holding the buffer must not re-queue it
+            detach_buffer();
+
+            if (!_use_memory_map)
+                return;
+
+            // Frames keep reading the same address, the copy is moved over the kernel pages in one step
+            auto copy = mmap(nullptr, _original_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (copy == MAP_FAILED)
+                throw linux_backend_exception("mmap failed");
+            librealsense::copy(copy, _start, _original_length);
+            if (mremap(copy, _original_length, _original_length, MREMAP_MAYMOVE | MREMAP_FIXED, _start) == MAP_FAILED)
+            {
+                munmap(copy, _original_length);
+                throw linux_backend_exception("mremap failed");
+            }
+        }
+
         void buffer::attach_buffer(const v4l2_buffer& buf)
         {
             std::lock_guard<std::mutex> lock(_mutex);
@@ -438,11 +461,23 @@ namespace librealsense
             {
                 if(errno == EINVAL)
                     LOG_ERROR(dev_name + " does not support memory mapping");
+                else if (!count && errno == EBUSY)
+                    LOG_WARNING(dev_name + " buffers are still mapped, the kernel releases them once they are unmapped");
                 else
                     throw linux_backend_exception("xioctl(VIDIOC_REQBUFS) failed");
             }
         }
 
+        static void detach_borrowed(const std::vector<std::shared_ptr<buffer>>& buffers)
+        {
+            // Frames reference the buffer through the continuation that re-queues it
+            for (auto&& buf : buffers)
+            {
+                if (buf.use_count() > 1)
+                    buf->detach_from_kernel();
+            }
+        }
+
         void v4l_uvc_device::foreach_uvc_device(
                 std::function<void(const uvc_device_info&,
                                    const std::string&)> action)
@@ -655,6 +690,7 @@ namespace librealsense
         v4l_uvc_device::~v4l_uvc_device()
         {
             _is_capturing = false;
+            if (_reactor) _reactor->remove(_fd);
             if (_thread && _thread->joinable()) _thread->join();
             for (auto&& fd : _fds)
             {
@@ -752,7 +788,18 @@ namespace librealsense
                 streamon();
 
                 _is_capturing = true;
-                _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
+
+                // Either share the reactor's workers with all other streams, or poll on a dedicated thread
+                _reactor = epoll_reactor::get_shared();
+                if (_reactor)
+                {
+                    _reactor->add(_fd, [this]() { reactor_poll(); }, [this]() { notify_frames_timeout(); },
+                                  std::chrono::seconds(5));
+                }
+                else
+                {
+                    _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
+                }
             }
         }
 
@@ -767,10 +814,18 @@ namespace librealsense
             _is_started = false;
 
             // Stop nn-demand frames polling
-            signal_stop();
+            if (_reactor)
+            {
+                _reactor->remove(_fd);
+                _reactor.reset();
+            }
+            else
+            {
+                signal_stop();
 
-            _thread->join();
-            _thread.reset();
+                _thread->join();
+                _thread.reset();
+            }
 
             // Notify kernel
             streamoff();
@@ -795,6 +850,10 @@ namespace librealsense
 
             if (_callback)
             {
+                // Frames still holding a buffer would keep it mapped, and kernels before 5.0 refuse to release
+                // a queue with mapped buffers
+                detach_borrowed_buffers();
+
                 // Release allocated buffers
                 allocate_io_buffers(0);
 
@@ -805,6 +864,11 @@ namespace librealsense
             }
         }
 
+        void v4l_uvc_device::detach_borrowed_buffers()
+        {
+            detach_borrowed(_buffers);
+        }
+
         std::string v4l_uvc_device::fourcc_to_string(uint32_t id) const
         {
             uint32_t device_fourcc = id;
@@ -876,121 +940,156 @@ namespace librealsense
                     }
                     else // Check and acquire data buffers from kernel
                     {
-                        bool md_extracted = false;
-                        buffers_mgr buf_mgr(_use_memory_map);
-                        // RAII to handle exceptions
-                        std::unique_ptr<int, std::function<void(int*)> > md_poller(new int(0),
-                            [this,&buf_mgr,&md_extracted,&fds](int* d)
-                            {
-                                if (!md_extracted) acquire_metadata(buf_mgr,fds);
-                                delete d;
-                            });
+                        acquire_frame(fds);
+                    }
+                }
+                else // (val==0)
+                {
+                    notify_frames_timeout();
+                }
+            }
+        }
 
-                        if(FD_ISSET(_fd, &fds))
-                        {
-                            FD_CLR(_fd,&fds);
-                            v4l2_buffer buf = {};
-                            buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
-                            if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
-                            {
-                                LOG_DEBUG_V4L("Dequeued empty buf for fd " << std::dec << _fd);
-                                if(errno == EAGAIN)
-                                    return;
+        void v4l_uvc_device::notify_frames_timeout()
+        {
+            LOG_WARNING("Frames didn't arrived within 5 seconds");
+            librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
 
-                                throw linux_backend_exception(to_string() << "xioctl(VIDIOC_DQBUF) failed for fd: " << _fd);
-                            }
-                            LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
+            _error_handler(n);
+        }
 
-                            auto buffer = _buffers[buf.index];
-                            buf_mgr.handle_buffer(e_video_buf,_fd, buf,buffer);
+        void v4l_uvc_device::acquire_frame(fd_set& fds)
+        {
+            bool md_extracted = false;
+            buffers_mgr buf_mgr(_use_memory_map);
+            // RAII to handle exceptions
+            std::unique_ptr<int, std::function<void(int*)> > md_poller(new int(0),
+                [this,&buf_mgr,&md_extracted,&fds](int* d)
+                {
+                    if (!md_extracted) acquire_metadata(buf_mgr,fds);
+                    delete d;
+                });
 
-                            if (_is_started)
-                            {
-                                if(buf.bytesused == 0)
-                                {
-                                    LOG_INFO("Empty video frame arrived");
-                                    return;
-                                }
+            if(FD_ISSET(_fd, &fds))
+            {
+                FD_CLR(_fd,&fds);
+                v4l2_buffer buf = {};
+                buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+                buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+                {
+                    LOG_DEBUG_V4L("Dequeued empty buf for fd " << std::dec << _fd);
+                    if(errno == EAGAIN)
+                        return;
 
-                                // Relax the required frame size for compressed formats, i.e. MJPG, Z16H
-                                // Drop partial and overflow frames (assumes D4XX metadata only)
-                                bool compressed_format = val_in_range(_profile.format, { 0x4d4a5047U , 0x5a313648U});
-                                bool partial_frame = (!compressed_format && (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE));
-                                bool overflow_frame = (buf.bytesused ==  buffer->get_length_frame_only() + MAX_META_DATA_SIZE);
-                                if (partial_frame || overflow_frame)
-                                {
-                                    auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
-                                    std::stringstream s;
-                                    if (partial_frame)
-                                    {
-                                        s << "Incomplete video frame detected!\nSize " << buf.bytesused
-                                            << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
-                                        if (overflow_frame)
-                                        {
-                                            s << ". Overflow detected: payload size " << buffer->get_length_frame_only();
-                                            LOG_ERROR("Corrupted UVC frame data, underflow and overflow reported:\n" << s.str().c_str());
-                                        }
-                                    }
-                                    else
-                                    {
-                                        if (overflow_frame)
-                                            s << "overflow video frame detected!\nSize " << buf.bytesused
-                                                << ", payload size " << buffer->get_length_frame_only();
-                                    }
-                                    librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
-
-                                    _error_handler(n);
-                                }
-                                else
-                                {
-                                    auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
-                                    timestamp = monotonic_to_realtime(timestamp);
-
-                                    // Read metadata. For metadata note performs a blocking call to ensure video and metadata sync
-                                    acquire_metadata(buf_mgr,fds,compressed_format);
-                                    md_extracted = true;
-
-                                    //if (val > 1)
-                                    //    LOG_INFO("Frame buf ready, md size: " << std::dec << (int)buf_mgr.metadata_size() << " seq. id: " << buf.sequence);
-                                    frame_object fo{ std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only()), buf_mgr.metadata_size(),
-                                        buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
-
-                                    buffer->attach_buffer(buf);
-                                    buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
-
-                                    if (buf_mgr.verify_vd_md_sync())
-                                    {
-                                        //Invoke user callback and enqueue next frame
-                                        _callback(_profile, fo, [buf_mgr]() mutable {
-                                            buf_mgr.request_next_frame();
-                                        });
-                                    }
-                                    else
-                                    {
-                                        LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
-                                    }
-                                }
-                            }
-                            else
+                    throw linux_backend_exception(to_string() << "xioctl(VIDIOC_DQBUF) failed for fd: " << _fd);
+                }
+                LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
+
+                auto buffer = _buffers[buf.index];
+                buf_mgr.handle_buffer(e_video_buf,_fd, buf,buffer);
+
+                if (_is_started)
+                {
+                    if(buf.bytesused == 0)
+                    {
+                        LOG_INFO("Empty video frame arrived");
+                        return;
+                    }
+
+                    // Relax the required frame size for compressed formats, i.e. MJPG, Z16H
+                    // Drop partial and overflow frames (assumes D4XX metadata only)
+                    bool compressed_format = val_in_range(_profile.format, { 0x4d4a5047U , 0x5a313648U});
+                    bool partial_frame = (!compressed_format && (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE));
+                    bool overflow_frame = (buf.bytesused ==  buffer->get_length_frame_only() + MAX_META_DATA_SIZE);
+                    if (partial_frame || overflow_frame)
+                    {
+                        auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
+                        std::stringstream s;
+                        if (partial_frame)
+                        {
+                            s << "Incomplete video frame detected!\nSize " << buf.bytesused
+                                << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
+                            if (overflow_frame)
                             {
-                                LOG_INFO("Video frame arrived in idle mode."); // TODO - verification
+                                s << ". Overflow detected: payload size " << buffer->get_length_frame_only();
+                                LOG_ERROR("Corrupted UVC frame data, underflow and overflow reported:\n" << s.str().c_str());
                             }
                         }
                         else
                         {
-                            LOG_WARNING("FD_ISSET signal false - no data on video node sink");
+                            if (overflow_frame)
+                                s << "overflow video frame detected!\nSize " << buf.bytesused
+                                    << ", payload size " << buffer->get_length_frame_only();
+                        }
+                        librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
+
+                        _error_handler(n);
+                    }
+                    else
+                    {
+                        auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
+                        timestamp = monotonic_to_realtime(timestamp);
+
+                        // Read metadata. For metadata note performs a blocking call to ensure video and metadata sync
+                        acquire_metadata(buf_mgr,fds,compressed_format);
+                        md_extracted = true;
+
+                        //if (val > 1)
+                        //    LOG_INFO("Frame buf ready, md size: " << std::dec << (int)buf_mgr.metadata_size() << " seq. id: " << buf.sequence);
+                        frame_object fo{ std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only()), buf_mgr.metadata_size(),
+                            buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+
+                        buffer->attach_buffer(buf);
+                        buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
+
+                        if (buf_mgr.verify_vd_md_sync())
+                        {
+                            //Invoke user callback and enqueue next frame
+                            _callback(_profile, fo, [buf_mgr]() mutable {
+                                buf_mgr.request_next_frame();
+                            });
+                        }
+                        else
+                        {
+                            LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
                         }
                     }
                 }
-                else // (val==0)
+                else
                 {
-                    LOG_WARNING("Frames didn't arrived within 5 seconds");
-                    librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
-
-                    _error_handler(n);
+                    LOG_INFO("Video frame arrived in idle mode."); // TODO - verification
                 }
             }
+            else
+            {
+                LOG_WARNING("FD_ISSET signal false - no data on video node sink");
+            }
+        }
+
+        void v4l_uvc_device::reactor_poll()
+        {
+            // Invoked by the shared reactor once the video node has a buffer ready
+            fd_set fds{};
+            FD_ZERO(&fds);
+            FD_SET(_fd, &fds);
+
+            try
+            {
+                if (_is_capturing)
+                    acquire_frame(fds);
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR(ex.what());
+
+                // Same as leaving the capture loop: no further frames are delivered until the stream is restarted
+                _reactor->remove(_fd);
+
+                librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_UNKNOWN_ERROR, 0, RS2_LOG_SEVERITY_ERROR, ex.what()};
+
+                _error_handler(n);
+            }
         }
 
         void v4l_uvc_device::acquire_metadata(buffers_mgr & buf_mgr,fd_set &, bool compressed_format)
@@ -1474,6 +1573,13 @@ namespace librealsense
                         LOCAL_V4L2_BUF_TYPE_META_CAPTURE);
         }
 
+        void v4l_uvc_meta_device::detach_borrowed_buffers()
+        {
+            v4l_uvc_device::detach_borrowed_buffers();
+
+            detach_borrowed(_md_buffers);
+        }
+
         void v4l_uvc_meta_device::allocate_io_buffers(size_t buffers)
         {
             v4l_uvc_device::allocate_io_buffers(buffers);
@@ -1647,6 +1753,21 @@ namespace librealsense
             }
         }
 
+        v4l_backend::v4l_backend()
+        {
+            auto mode = getenv("LRS_DEVICE_WATCHER");
+            if (mode && std::string(mode) == "polling")
+                return;
+
+            auto fd = udev_device_watcher::open_uevent_socket();
+            if (fd < 0)
+            {
+                LOG_INFO("uevents are not available, devices will be polled. Error: " << errno);
+                return;
+            }
+            _watcher = std::make_shared<udev_device_watcher>(fd, device_scanners{ scan_uvc_devices, scan_usb_devices, scan_hid_devices });
+        }
+
         std::shared_ptr<uvc_device> v4l_backend::create_uvc_device(uvc_device_info info) const
         {
             auto v4l_uvc_dev = (!info.has_metadata_node) ? std::make_shared<v4l_uvc_device>(info) :
@@ -1656,6 +1777,11 @@ namespace librealsense
         }
 
         std::vector<uvc_device_info> v4l_backend::query_uvc_devices() const
+        {
+            return _watcher ? _watcher->get_devices().uvc_devices : scan_uvc_devices();
+        }
+
+        std::vector<uvc_device_info> v4l_backend::scan_uvc_devices()
         {
             std::vector<uvc_device_info> uvc_nodes;
             v4l_uvc_device::foreach_uvc_device(
@@ -1676,6 +1802,11 @@ namespace librealsense
         }
 
         std::vector<usb_device_info> v4l_backend::query_usb_devices() const
+        {
+            return _watcher ? _watcher->get_devices().usb_devices : scan_usb_devices();
+        }
+
+        std::vector<usb_device_info> v4l_backend::scan_usb_devices()
         {
             auto device_infos = usb_enumerator::query_devices_info();
             // Give the device a chance to restart, if we don't catch
@@ -1693,6 +1824,11 @@ namespace librealsense
         }
 
         std::vector<hid_device_info> v4l_backend::query_hid_devices() const
+        {
+            return _watcher ? _watcher->get_devices().hid_devices : scan_hid_devices();
+        }
+
+        std::vector<hid_device_info> v4l_backend::scan_hid_devices()
         {
             std::vector<hid_device_info> results;
             v4l_hid_device::foreach_hid_device([&](const hid_device_info& hid_dev_info){
@@ -1708,6 +1844,8 @@ namespace librealsense
 
         std::shared_ptr<device_watcher> v4l_backend::create_device_watcher() const
         {
+            if (_watcher)
+                return _watcher;
             return std::make_shared<polling_device_watcher>(this);
         }
 
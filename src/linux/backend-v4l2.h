@@ -81,6 +81,8 @@ namespace librealsense
 {
     namespace platform
     {
+        class epoll_reactor;
+
         class named_mutex
         {
         public:
@@ -130,6 +132,9 @@ namespace librealsense
 
             bool use_memory_map() const { return _use_memory_map; }
 
+            // Replaces the kernel mapping with a private copy at the same address, and cancels the pending re-queue
+            void detach_from_kernel();
+
         private:
             v4l2_buf_type _type;
             uint8_t* _start;
@@ -259,6 +264,8 @@ namespace librealsense
 
             void poll();
 
+            void reactor_poll();
+
             void set_power_state(power_state state) override;
             power_state get_power_state() const override { return _state; }
 
@@ -280,6 +287,7 @@ namespace librealsense
 
             std::string get_device_location() const override { return _device_path; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
+            bool defers_buffer_requeue() const override { return true; }
 
         protected:
             static uint32_t get_cid(rs2_option option);
@@ -299,6 +307,10 @@ namespace librealsense
             virtual void prepare_capture_buffers() override;
             virtual void stop_data_capture() override;
             virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds, bool compressed_format = false) override;
+            virtual void detach_borrowed_buffers();
+
+            void acquire_frame(fd_set &fds);
+            void notify_frames_timeout();
 
             power_state _state = D3;
             std::string _name = "";
@@ -313,6 +325,7 @@ namespace librealsense
             std::atomic<bool> _is_alive;
             std::atomic<bool> _is_started;
             std::unique_ptr<std::thread> _thread;
+            std::shared_ptr<epoll_reactor> _reactor; // when set, replaces the capture thread
             std::unique_ptr<named_mutex> _named_mtx;
             bool _use_memory_map;
             int _max_fd = 0;                    // specifies the maximal pipe number the polling process will monitor
@@ -343,6 +356,7 @@ namespace librealsense
             void set_format(stream_profile profile);
             void prepare_capture_buffers();
             virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds, bool compressed_format=false);
+            void detach_borrowed_buffers() override;
 
             int _md_fd = -1;
             std::string _md_name = "";
@@ -351,9 +365,13 @@ namespace librealsense
             stream_profile _md_profile;
         };
 
+        class udev_device_watcher;
+
         class v4l_backend : public backend
         {
         public:
+            v4l_backend();
+
             std::shared_ptr<uvc_device> create_uvc_device(uvc_device_info info) const override;
             std::vector<uvc_device_info> query_uvc_devices() const override;
 
@@ -365,6 +383,14 @@ namespace librealsense
 
             std::shared_ptr<time_service> create_time_service() const override;
             std::shared_ptr<device_watcher> create_device_watcher() const override;
+
+        private:
+            static std::vector<uvc_device_info> scan_uvc_devices();
+            static std::vector<usb_device_info> scan_usb_devices();
+            static std::vector<hid_device_info> scan_hid_devices();
+
+            // Keeps the enumeration cached, null when uevents are not available (e.g. in containers)
+            std::shared_ptr<udev_device_watcher> _watcher;
         };
     }
 }
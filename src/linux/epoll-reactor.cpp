@@ -0,0 +1,324 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "epoll-reactor.h"
+#include "types.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Upper bound on how late an idle notification may be delivered
+        static const int idle_check_interval_ms = 250;
+
+        epoll_reactor::epoll_reactor(unsigned threads, std::vector<int> cpus)
+            : _epoll_fd(-1), _wake_fd(-1), _alive(true), _checking_idle(false), _cpus(std::move(cpus))
+        {
+            if (!threads)
+                throw invalid_value_exception("epoll_reactor requires at least one worker thread");
+
+            _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if (_epoll_fd < 0)
+                throw linux_backend_exception("epoll_create1 failed");
+
+            _wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (_wake_fd < 0)
+            {
+                ::close(_epoll_fd);
+                throw linux_backend_exception("eventfd failed");
+            }
+
+            // The wake-up descriptor is level-triggered and never drained, so once signalled
+            // it releases every worker blocked in epoll_wait
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.fd = _wake_fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wake_fd, &ev) < 0)
+            {
+                ::close(_wake_fd);
+                ::close(_epoll_fd);
+                throw linux_backend_exception("epoll_ctl failed to register the wake-up descriptor");
+            }
+
+            for (unsigned i = 0; i < threads; ++i)
+                _workers.emplace_back([this, i]() { worker(i); });
+        }
+
+        epoll_reactor::~epoll_reactor()
+        {
+            _alive = false;
+            uint64_t one = 1;
+            if (write(_wake_fd, &one, sizeof(one)) < 0)
+                LOG_ERROR("epoll_reactor could not signal its workers to stop");
+
+            // create() guarantees the destructor never runs on a worker
+            for (auto&& t : _workers)
+            {
+                if (t.joinable())
+                    t.join();
+            }
+
+            ::close(_wake_fd);
+            ::close(_epoll_fd);
+        }
+
+        std::shared_ptr<epoll_reactor> epoll_reactor::create(unsigned threads, std::vector<int> cpus)
+        {
+            return std::shared_ptr<epoll_reactor>(new epoll_reactor(threads, std::move(cpus)), [](epoll_reactor* r)
+            {
+                // A worker cannot join itself, and the handler it is running still uses the reactor
+                // once it returns, so leave the destruction to another thread
+                if (r->is_worker_thread())
+                    std::thread([r]() { delete r; }).detach();
+                else
+                    delete r;
+            });
+        }
+
+        bool epoll_reactor::is_worker_thread() const
+        {
+            for (auto&& t : _workers)
+            {
+                if (t.get_id() == std::this_thread::get_id())
+                    return true;
+            }
+            return false;
+        }
+
+        void epoll_reactor::add(int fd, handler on_ready, handler on_idle, std::chrono::milliseconds idle_timeout)
+        {
+            auto e = std::make_shared<entry>();
+            e->fd = fd;
+            e->on_ready = std::move(on_ready);
+            e->on_idle = std::move(on_idle);
+            e->idle_timeout = idle_timeout;
+            e->last_event = std::chrono::steady_clock::now();
+
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (_entries.find(fd) != _entries.end())
+                throw wrong_api_call_sequence_exception(to_string() << "fd " << fd << " is already registered with the reactor");
+
+            _entries[fd] = e;
+
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLONESHOT;
+            ev.data.fd = fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+            {
+                _entries.erase(fd);
+                throw linux_backend_exception(to_string() << "epoll_ctl failed to register fd " << fd);
+            }
+        }
+
+        void epoll_reactor::remove(int fd)
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            auto it = _entries.find(fd);
+            if (it == _entries.end())
+                return;
+
+            auto e = it->second;
+            e->removed = true;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr) < 0)
+                LOG_WARNING("epoll_ctl failed to unregister fd " << fd);
+
+            _cv.wait(lock, [&]() { return !e->in_flight || e->owner == std::this_thread::get_id(); });
+            _entries.erase(fd);
+        }
+
+        void epoll_reactor::rearm(int fd)
+        {
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLONESHOT;
+            ev.data.fd = fd;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, fd, &ev) < 0)
+                LOG_WARNING("epoll_ctl failed to re-arm fd " << fd);
+        }
+
+        void epoll_reactor::dispatch(int fd)
+        {
+            std::shared_ptr<entry> e;
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                auto it = _entries.find(fd);
+                // The descriptor may have been removed after epoll_wait reported it
+                if (it == _entries.end() || it->second->removed || it->second->in_flight)
+                    return;
+                e = it->second;
+                e->in_flight = true;
+                e->owner = std::this_thread::get_id();
+            }
+
+            try
+            {
+                e->on_ready();
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR("epoll_reactor handler of fd " << fd << " failed: " << ex.what());
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                e->in_flight = false;
+                e->owner = std::thread::id();
+                e->last_event = std::chrono::steady_clock::now();
+                if (!e->removed)
+                    rearm(fd);
+            }
+            _cv.notify_all();
+        }
+
+        void epoll_reactor::check_idle()
+        {
+            // A single worker sweeps at a time, the rest go back to serving descriptors
+            if (_checking_idle.exchange(true))
+                return;
+
+            auto now = std::chrono::steady_clock::now();
+            std::vector<std::shared_ptr<entry>> idle;
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                for (auto&& kvp : _entries)
+                {
+                    auto&& e = kvp.second;
+                    if (e->on_idle && !e->removed && !e->in_flight && now - e->last_event > e->idle_timeout)
+                    {
+                        e->last_event = now;
+                        e->in_flight = true;
+                        e->owner = std::this_thread::get_id();
+                        idle.push_back(e);
+                    }
+                }
+            }
+
+            for (auto&& e : idle)
+            {
+                try
+                {
+                    e->on_idle();
+                }
+                catch (const std::exception& ex)
+                {
+                    LOG_ERROR("epoll_reactor idle handler failed: " << ex.what());
+                }
+
+                std::lock_guard<std::mutex> lock(_mtx);
+                e->in_flight = false;
+                e->owner = std::thread::id();
+                // Readiness reported while the idle handler was running was dropped by dispatch
+                if (!e->removed)
+                    rearm(e->fd);
+            }
+            if (idle.size())
+                _cv.notify_all();
+
+            _checking_idle = false;
+        }
+
+        void epoll_reactor::worker(unsigned index)
+        {
+            if (_cpus.size())
+            {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(_cpus[index % _cpus.size()], &set);
+                if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+                    LOG_WARNING("epoll_reactor could not pin worker " << index << " to CPU " << _cpus[index % _cpus.size()]);
+            }
+
+            auto last_idle_check = std::chrono::steady_clock::now();
+            while (_alive)
+            {
+                epoll_event ev{};
+                // One event per wake-up spreads ready descriptors evenly across the workers
+                auto n = epoll_wait(_epoll_fd, &ev, 1, idle_check_interval_ms);
+                if (n < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    LOG_ERROR("epoll_wait failed, errno " << errno << ", reactor worker " << index << " exits");
+                    break;
+                }
+
+                if (!_alive)
+                    break;
+
+                if (n > 0 && ev.data.fd != _wake_fd)
+                    dispatch(ev.data.fd);
+
+                auto now = std::chrono::steady_clock::now();
+                if (now - last_idle_check >= std::chrono::milliseconds(idle_check_interval_ms))
+                {
+                    last_idle_check = now;
+                    check_idle();
+                }
+            }
+        }
+
+        static std::vector<int> parse_cpu_list(const char* str)
+        {
+            // Comma separated CPU indices and ranges, e.g. "2,3" or "4-7"
+            std::vector<int> res;
+            std::stringstream ss(str);
+            std::string token;
+            while (std::getline(ss, token, ','))
+            {
+                auto dash = token.find('-');
+                try
+                {
+                    if (dash == std::string::npos)
+                        res.push_back(std::stoi(token));
+                    else
+                        for (int i = std::stoi(token.substr(0, dash)); i <= std::stoi(token.substr(dash + 1)); ++i)
+                            res.push_back(i);
+                }
+                catch (...)
+                {
+                    LOG_WARNING("Ignoring malformed CPU list entry \"" << token << "\"");
+                }
+            }
+            return res;
+        }
+
+        std::shared_ptr<epoll_reactor> epoll_reactor::get_shared()
+        {
+            static std::mutex mtx;
+            static std::weak_ptr<epoll_reactor> instance;
+
+            std::lock_guard<std::mutex> lock(mtx);
+            if (auto res = instance.lock())
+                return res;
+
+            auto threads_var = getenv("LRS_V4L2_REACTOR_THREADS");
+            if (!threads_var)
+                return nullptr;
+
+            int threads = atoi(threads_var);
+            if (threads < 0)
+                threads = std::thread::hardware_concurrency();
+            if (threads <= 0)
+                return nullptr;
+
+            std::vector<int> cpus;
+            if (auto cpus_var = getenv("LRS_V4L2_REACTOR_CPUS"))
+                cpus = parse_cpu_list(cpus_var);
+
+            LOG_INFO("V4L2 capture uses a shared epoll reactor with " << threads << " worker threads");
+            auto res = create(static_cast<unsigned>(threads), cpus);
+            instance = res;
+            return res;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        /*
+            Dispatches readiness of many file descriptors from a small pool of worker threads sharing
+            a single epoll instance. Descriptors are armed one-shot, so a handler never runs concurrently
+            with itself, while handlers of different descriptors run in parallel on different workers.
+            Each registration may also provide an idle handler, invoked when the descriptor was not ready
+            for longer than the requested timeout.
+        */
+        class epoll_reactor
+        {
+        public:
+            typedef std::function<void()> handler;
+
+            // Number of workers and the optional list of CPUs to pin them to (round-robin).
+            // The last reference may be dropped from within a handler, in which case the reactor
+            // is destroyed on a separate thread once the handler returns
+            static std::shared_ptr<epoll_reactor> create(unsigned threads, std::vector<int> cpus = {});
+            ~epoll_reactor();
+
+            epoll_reactor(const epoll_reactor&) = delete;
+            epoll_reactor& operator=(const epoll_reactor&) = delete;
+
+            void add(int fd, handler on_ready, handler on_idle, std::chrono::milliseconds idle_timeout);
+
+            // Once remove returns, no handler of this descriptor is running or will be invoked
+            // (unless called from within the descriptor's own handler, which is allowed)
+            void remove(int fd);
+
+            unsigned get_threads_count() const { return static_cast<unsigned>(_workers.size()); }
+
+            // Shared reactor configured through the LRS_V4L2_REACTOR_THREADS (worker count, -1 for one per core)
+            // and LRS_V4L2_REACTOR_CPUS (e.g. "2,3" or "4-7") environment variables.
+            // Returns nullptr when the reactor mode is not enabled.
+            static std::shared_ptr<epoll_reactor> get_shared();
+
+        private:
+            epoll_reactor(unsigned threads, std::vector<int> cpus);
+
+            bool is_worker_thread() const;
+
+            struct entry
+            {
+                int fd = -1;
+                handler on_ready;
+                handler on_idle;
+                std::chrono::milliseconds idle_timeout;
+                std::chrono::steady_clock::time_point last_event;
+                bool in_flight = false;
+                bool removed = false;
+                std::thread::id owner;
+            };
+
+            void worker(unsigned index);
+            void dispatch(int fd);
+            void check_idle();
+            void rearm(int fd);
+
+            int _epoll_fd;
+            int _wake_fd;
+            std::atomic<bool> _alive;
+            std::atomic<bool> _checking_idle;
+            std::mutex _mtx;
+            std::condition_variable _cv;
+            std::map<int, std::shared_ptr<entry>> _entries;
+            std::vector<int> _cpus;
+            std::vector<std::thread> _workers;
+        };
+    }
+}
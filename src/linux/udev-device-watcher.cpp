@@ -0,0 +1,309 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "udev-device-watcher.h"
+#include "types.h"
+
+#include <cstring>
+
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Multicast groups of NETLINK_KOBJECT_UEVENT
+        static const unsigned kernel_uevent_group = 1;
+        static const unsigned udev_uevent_group = 2;
+
+        // Hot-plugging a camera produces a burst of events, the rescan is also bounded when they keep coming
+        static const int max_settle_time_ms = 1000;
+
+        static const size_t uevent_buffer_size = 8192;
+
+        bool parse_uevent(const char* data, size_t size, uevent& ev)
+        {
+            ev = uevent();
+
+            const char* properties = data;
+            size_t properties_size = size;
+
+            static const char udev_prefix[] = "libudev";
+            if (size >= sizeof(udev_prefix) && !memcmp(data, udev_prefix, sizeof(udev_prefix)))
+            {
+                // prefix[8], magic, header_size, properties_off, properties_len, ...
+                const size_t offsets_pos = sizeof(udev_prefix) + 2 * sizeof(uint32_t);
+                if (size < offsets_pos + 2 * sizeof(uint32_t))
+                    return false;
+
+                uint32_t properties_off, properties_len;
+                memcpy(&properties_off, data + offsets_pos, sizeof(uint32_t));
+                memcpy(&properties_len, data + offsets_pos + sizeof(uint32_t), sizeof(uint32_t));
+                if (properties_off > size || properties_len > size - properties_off)
+                    return false;
+
+                properties = data + properties_off;
+                properties_size = properties_len;
+            }
+            else
+            {
+                // The kernel message starts with "<action>@<devpath>", the same information follows as properties
+                auto header_end = static_cast<const char*>(memchr(data, '\0', size));
+                if (!header_end || !memchr(data, '@', header_end - data))
+                    return false;
+
+                properties = header_end + 1;
+                properties_size = size - (properties - data);
+            }
+
+            auto end = properties + properties_size;
+            for (auto p = properties; p < end; )
+            {
+                auto entry_end = static_cast<const char*>(memchr(p, '\0', end - p));
+                if (!entry_end)
+                    entry_end = end;
+
+                std::string entry(p, entry_end);
+                auto eq = entry.find('=');
+                if (eq != std::string::npos)
+                {
+                    auto key = entry.substr(0, eq);
+                    if (key == "ACTION")
+                        ev.action = entry.substr(eq + 1);
+                    else if (key == "SUBSYSTEM")
+                        ev.subsystem = entry.substr(eq + 1);
+                    else if (key == "DEVPATH")
+                        ev.devpath = entry.substr(eq + 1);
+                }
+                p = entry_end + 1;
+            }
+
+            return !ev.action.empty() && !ev.subsystem.empty();
+        }
+
+        int get_uevent_scope(const uevent& ev)
+        {
+            if (ev.subsystem == "video4linux")
+                return uevent_scope_uvc;
+            if (ev.subsystem == "usb")
+                return uevent_scope_usb;
+            // IIO motion sensors, and the custom HID sensors (platform devices) that carry the IMU timestamps
+            if (ev.subsystem == "iio" || ev.subsystem == "hid" || ev.devpath.find("HID-SENSOR") != std::string::npos)
+                return uevent_scope_hid;
+            return uevent_scope_none;
+        }
+
+        udev_device_watcher::udev_device_watcher(int uevent_fd, device_scanners scanners, std::chrono::milliseconds settle_time,
+                                                 std::chrono::milliseconds rescan_interval)
+            : _fd(uevent_fd), _stop_fd(-1), _scanners(std::move(scanners)), _settle_time(settle_time),
+              _rescan_interval(rescan_interval)
+        {
+            _stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (_stop_fd < 0)
+            {
+                ::close(_fd);
+                throw linux_backend_exception("eventfd failed");
+            }
+
+            _devices = backend_device_group(_scanners.uvc(), _scanners.usb(), _scanners.hid());
+
+            _thread = std::thread([this]() { monitor(); });
+        }
+
+        udev_device_watcher::~udev_device_watcher()
+        {
+            stop();
+
+            uint64_t one = 1;
+            if (write(_stop_fd, &one, sizeof(one)) < 0)
+                LOG_ERROR("udev_device_watcher could not signal its thread to stop");
+            if (_thread.joinable())
+                _thread.join();
+
+            ::close(_stop_fd);
+            ::close(_fd);
+        }
+
+        void udev_device_watcher::start(device_changed_callback callback)
+        {
+            std::lock_guard<std::mutex> lock(_callback_mutex);
+            _callback = std::move(callback);
+        }
+
+        void udev_device_watcher::stop()
+        {
+            // The callback is invoked under the same lock, so none is running once this returns
+            std::lock_guard<std::mutex> lock(_callback_mutex);
+            _callback = nullptr;
+        }
+
+        backend_device_group udev_device_watcher::get_devices() const
+        {
+            std::lock_guard<std::mutex> lock(_devices_mutex);
+            return _devices;
+        }
+
+        int udev_device_watcher::open_uevent_socket()
+        {
+            int fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_KOBJECT_UEVENT);
+            if (fd < 0)
+                return -1;
+
+            // Events are read in bursts, a larger buffer makes overruns less likely
+            int buffer_size = 1024 * 1024;
+            setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buffer_size, sizeof(buffer_size));
+
+            // The kernel events arrive first, but the device nodes may still be inaccessible until udevd applies
+            // its rules - the events it re-broadcasts afterwards trigger another rescan
+            sockaddr_nl addr{};
+            addr.nl_family = AF_NETLINK;
+            addr.nl_groups = kernel_uevent_group | udev_uevent_group;
+            if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+            {
+                ::close(fd);
+                return -1;
+            }
+            return fd;
+        }
+
+        // Drains the pending events and returns the scope they affect
+        int udev_device_watcher::receive_events()
+        {
+            int scope = uevent_scope_none;
+            char buffer[uevent_buffer_size];
+            while (true)
+            {
+                auto size = recv(_fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+                if (size < 0)
+                {
+                    // Events were lost, anything may have changed
+                    if (errno == ENOBUFS)
+                    {
+                        LOG_WARNING("uevent socket overrun, rescanning all devices");
+                        scope |= uevent_scope_all;
+                        continue;
+                    }
+                    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                        LOG_WARNING("Failed to receive uevent, error: " << errno);
+                    break;
+                }
+
+                uevent ev;
+                if (parse_uevent(buffer, size, ev))
+                {
+                    auto ev_scope = get_uevent_scope(ev);
+                    if (ev_scope != uevent_scope_none)
+                        LOG_DEBUG("uevent " << ev.action << " " << ev.subsystem << " " << ev.devpath);
+                    scope |= ev_scope;
+                }
+            }
+            return scope;
+        }
+
+        void udev_device_watcher::monitor()
+        {
+            using namespace std::chrono;
+
+            int pending = uevent_scope_none;
+            steady_clock::time_point first_event, last_event;
+            // Rescans until the first uevent proves that they are delivered
+            bool events_delivered = false;
+            auto next_rescan = steady_clock::now() + _rescan_interval;
+
+            while (true)
+            {
+                int timeout = -1;
+                if (pending || !events_delivered)
+                {
+                    auto now = steady_clock::now();
+                    auto deadline = pending ? std::min(last_event + _settle_time, first_event + milliseconds(max_settle_time_ms))
+                                            : next_rescan;
+                    timeout = static_cast<int>(std::max<int64_t>(0, duration_cast<milliseconds>(deadline - now).count()));
+                }
+
+                pollfd fds[2] = { { _fd, POLLIN, 0 }, { _stop_fd, POLLIN, 0 } };
+                auto res = poll(fds, 2, timeout);
+                if (res < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    LOG_ERROR("udev_device_watcher poll failed, error: " << errno);
+                    return;
+                }
+
+                if (fds[1].revents)
+                    return;
+
+                if (fds[0].revents & POLLIN)
+                {
+                    if (!events_delivered)
+                        LOG_DEBUG("uevents are delivered, devices are no longer rescanned periodically");
+                    events_delivered = true;
+                    auto scope = receive_events();
+                    if (scope)
+                    {
+                        last_event = steady_clock::now();
+                        if (!pending)
+                            first_event = last_event;
+                        pending |= scope;
+                    }
+                }
+
+                if (pending)
+                {
+                    auto now = steady_clock::now();
+                    if (now >= last_event + _settle_time || now >= first_event + milliseconds(max_settle_time_ms))
+                    {
+                        rescan(pending);
+                        pending = uevent_scope_none;
+                    }
+                }
+                else if (!events_delivered && steady_clock::now() >= next_rescan)
+                {
+                    rescan(uevent_scope_all);
+                    next_rescan = steady_clock::now() + _rescan_interval;
+                }
+            }
+        }
+
+        void udev_device_watcher::rescan(int scope)
+        {
+            auto curr = get_devices();
+            try
+            {
+                if (scope & uevent_scope_uvc)
+                    curr.uvc_devices = _scanners.uvc();
+                if (scope & uevent_scope_usb)
+                    curr.usb_devices = _scanners.usb();
+                if (scope & uevent_scope_hid)
+                    curr.hid_devices = _scanners.hid();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Device rescan failed: " << e.what());
+                return;
+            }
+
+            backend_device_group old;
+            {
+                std::lock_guard<std::mutex> lock(_devices_mutex);
+                old = _devices;
+                _devices = curr;
+            }
+
+            if (list_changed(old.uvc_devices, curr.uvc_devices) ||
+                list_changed(old.usb_devices, curr.usb_devices) ||
+                list_changed(old.hid_devices, curr.hid_devices))
+            {
+                std::lock_guard<std::mutex> lock(_callback_mutex);
+                if (_callback)
+                    _callback(old, curr);
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "backend.h"
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        struct uevent
+        {
+            std::string action;     // add, remove, change, bind, ...
+            std::string subsystem;  // video4linux, usb, iio, hid, ...
+            std::string devpath;    // under /sys
+        };
+
+        // Parses a uevent datagram, either as sent by the kernel ("<action>@<devpath>\0KEY=VALUE\0...")
+        // or as re-broadcast by udevd once its rules were applied ("libudev" header followed by KEY=VALUE\0...)
+        bool parse_uevent(const char* data, size_t size, uevent& ev);
+
+        // The parts of the device enumeration a uevent may affect
+        enum uevent_scope
+        {
+            uevent_scope_none = 0,
+            uevent_scope_uvc  = 1 << 0,
+            uevent_scope_usb  = 1 << 1,
+            uevent_scope_hid  = 1 << 2,
+            uevent_scope_all  = uevent_scope_uvc | uevent_scope_usb | uevent_scope_hid
+        };
+        int get_uevent_scope(const uevent& ev);
+
+        struct device_scanners
+        {
+            std::function<std::vector<uvc_device_info>()> uvc;
+            std::function<std::vector<usb_device_info>()> usb;
+            std::function<std::vector<hid_device_info>()> hid;
+        };
+
+        /*
+            Device watcher driven by uevents rather than by periodic polling, that also caches the device
+            enumeration. The devices are scanned once on construction, and afterwards only the part of the
+            enumeration affected by incoming events is rescanned - after the burst of events a hot-plug
+            produces has settled. The cache is kept up to date whether the watcher was started or not,
+            so that queries are answered without touching sysfs.
+            A socket may open fine and still receive nothing, e.g. in a container without the host network
+            namespace. Until the first uevent arrives, all devices are therefore also rescanned at the rate of
+            the polling watcher.
+        */
+        class udev_device_watcher : public device_watcher
+        {
+        public:
+            // Takes ownership of uevent_fd, a datagram socket delivering uevents - the netlink socket returned
+            // by open_uevent_socket(), or any other socket in tests
+            udev_device_watcher(int uevent_fd, device_scanners scanners,
+                                std::chrono::milliseconds settle_time = std::chrono::milliseconds(100),
+                                std::chrono::milliseconds rescan_interval = std::chrono::milliseconds(5000));
+            ~udev_device_watcher();
+
+            udev_device_watcher(const udev_device_watcher&) = delete;
+            udev_device_watcher& operator=(const udev_device_watcher&) = delete;
+
+            void start(device_changed_callback callback) override;
+            void stop() override;
+
+            backend_device_group get_devices() const;
+
+            // NETLINK_KOBJECT_UEVENT socket subscribed to both kernel and udev events, -1 when unavailable
+            static int open_uevent_socket();
+
+        private:
+            void monitor();
+            int receive_events();
+            void rescan(int scope);
+
+            int _fd;
+            int _stop_fd;
+            device_scanners _scanners;
+            std::chrono::milliseconds _settle_time;
+            std::chrono::milliseconds _rescan_interval;
+
+            mutable std::mutex _devices_mutex;
+            backend_device_group _devices;
+
+            std::mutex _callback_mutex;
+            device_changed_callback _callback;
+
+            std::thread _thread;
+        };
+    }
+}
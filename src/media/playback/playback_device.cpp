@@ -623,6 +623,67 @@ uint64_t playback_device::get_position() const
 {
     return m_prev_timestamp.count();
 }
+device_serializer::stream_identifier playback_device::get_stream_identifier(const stream_profile_interface& profile) const
+{
+    for (auto&& sensor : m_sensors)
+    {
+        for (auto&& sensor_profile : sensor.second->get_stream_profiles())
+        {
+            if (sensor_profile->get_unique_id() == profile.get_unique_id())
+            {
+                return { get_device_index(), sensor.first, sensor_profile->get_stream_type(), static_cast<uint32_t>(sensor_profile->get_stream_index()) };
+            }
+        }
+    }
+    throw invalid_value_exception(to_string() << "Stream profile " << profile.get_stream_type() << " " << profile.get_stream_index() << " is not one of the recorded streams");
+}
+
+// The reader is not thread safe, random access requests are served by the reading thread in between frames
+template <class T>
+T playback_device::read_synchronously(std::function<T()> action)
+{
+    T result{};
+    std::exception_ptr error;
+    (*m_read_thread)->invoke_and_wait([&](dispatcher::cancellable_timer c)
+    {
+        try
+        {
+            result = action();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }, []() { return false; });
+    if (error)
+        std::rethrow_exception(error);
+    return result;
+}
+
+size_t playback_device::get_frames_count(const stream_profile_interface& profile)
+{
+    auto stream_id = get_stream_identifier(profile);
+    return read_synchronously<size_t>([this, stream_id]() { return m_reader->query_frames_count(stream_id); });
+}
+
+frame_holder playback_device::get_frame(const stream_profile_interface& profile, size_t index)
+{
+    auto stream_id = get_stream_identifier(profile);
+    auto data = read_synchronously<std::shared_ptr<serialized_frame>>([this, stream_id, index]() { return m_reader->read_frame(stream_id, index); });
+    if (!data->frame)
+    {
+        throw io_exception(to_string() << "Frame " << index << " of stream " << stream_id << " could not be read");
+    }
+    m_sensors.at(stream_id.sensor_index)->attach_frame(data->frame);
+    return std::move(data->frame);
+}
+
+size_t playback_device::find_frame(const stream_profile_interface& profile, unsigned long long frame_number)
+{
+    auto stream_id = get_stream_identifier(profile);
+    return read_synchronously<size_t>([this, stream_id, frame_number]() { return m_reader->find_frame(stream_id, frame_number); });
+}
+
 void playback_device::catch_up()
 {
     m_base_timestamp = std::chrono::microseconds(0);
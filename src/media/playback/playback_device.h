@@ -42,6 +42,9 @@ namespace librealsense
         bool is_real_time() const;
         const std::string& get_file_name() const;
         uint64_t get_position() const;
+        size_t get_frames_count(const stream_profile_interface& profile);
+        frame_holder get_frame(const stream_profile_interface& profile, size_t index);
+        size_t find_frame(const stream_profile_interface& profile, unsigned long long frame_number);
         signal<playback_device, rs2_playback_status> playback_status_changed;
         platform::backend_device_group get_device_data() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
@@ -73,6 +76,8 @@ namespace librealsense
         void register_extrinsics(const device_serializer::device_snapshot& device_description);
         void update_extensions(const device_serializer::device_snapshot& device_description);
         bool prefetch_done();
+        device_serializer::stream_identifier get_stream_identifier(const stream_profile_interface& profile) const;
+        template <class T> T read_synchronously(std::function<T()> action);
 
     private:
         lazy<std::shared_ptr<dispatcher>> m_read_thread;
@@ -269,6 +269,10 @@ void playback_sensor::set_frames_callback(frame_callback_ptr callback)
 {
     m_user_callback = callback;
 }
+void playback_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+{
+    throw not_implemented_exception("Custom frame allocators are not supported for playback sensors");
+}
 stream_profiles playback_sensor::get_active_streams() const
 {
     std::lock_guard<std::mutex> lock(m_active_profile_mutex);
@@ -45,6 +45,7 @@ namespace librealsense
         void update(const device_serializer::sensor_snapshot& sensor_snapshot);
         frame_callback_ptr get_frames_callback() const override;
         void set_frames_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         stream_profiles get_active_streams() const override;
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
@@ -90,6 +91,16 @@ namespace librealsense
         const unsigned int _default_queue_size;
 
     public:
+        // Makes a frame read from the file belong to this sensor and to its stream profile
+        void attach_frame(frame_holder& frame)
+        {
+            frame->get_owner()->set_sensor(shared_from_this());
+            auto type = frame->get_stream()->get_stream_type();
+            auto index = static_cast<uint32_t>(frame->get_stream()->get_stream_index());
+            frame->set_stream(m_streams[std::make_pair(type, index)]);
+            frame->set_sensor(shared_from_this());
+        }
+
         //handle frame use 3 lambda functions that determines if and when a frame should be published.
         //calc_sleep - calculates the duration that the sensor should wait before publishing the frame,
         // the start point for this calculation is the last playback resume.
@@ -105,11 +116,7 @@ namespace librealsense
             }
             if (m_is_started)
             {
-                frame->get_owner()->set_sensor(shared_from_this());
-                auto type = frame->get_stream()->get_stream_type();
-                auto index = static_cast<uint32_t>(frame->get_stream()->get_stream_index());
-                frame->set_stream(m_streams[std::make_pair(type, index)]);
-                frame->set_sensor(shared_from_this());
+                attach_frame(frame);
                 auto stream_id = frame.frame->get_stream()->get_unique_id();
                 //TODO: Ziv, remove usage of shared_ptr when frame_holder is cpoyable
                 auto pf = std::make_shared<frame_holder>(std::move(frame));
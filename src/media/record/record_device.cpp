@@ -13,7 +13,14 @@ librealsense::record_device::record_device(std::shared_ptr<librealsense::device_
                                       std::shared_ptr<librealsense::device_serializer::writer> serializer):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
     m_is_recording(true),
-    m_record_pause_time(0)
+    m_record_pause_time(0),
+    m_cached_data_size(0),
+    m_max_cached_data_size(MAX_CACHED_DATA_SIZE),
+    m_peak_cached_data_size(0),
+    m_queue_policy(queue_policy::drop),
+    m_is_closing(false),
+    m_dropped_frames(0),
+    m_total_dropped_frames(0)
 {
     if (device == nullptr)
     {
@@ -25,6 +32,19 @@ librealsense::record_device::record_device(std::shared_ptr<librealsense::device_
         throw invalid_value_exception("serializer is null");
     }
 
+    if (auto budget_var = getenv("LRS_RECORD_QUEUE_MB"))
+    {
+        m_max_cached_data_size = static_cast<uint64_t>(std::max(atoi(budget_var), 1)) << 20;
+    }
+    if (auto policy_var = getenv("LRS_RECORD_QUEUE_POLICY"))
+    {
+        std::string policy(policy_var);
+        if (policy == "block")
+            m_queue_policy = queue_policy::block;
+        else if (policy != "drop")
+            LOG_WARNING("Unknown LRS_RECORD_QUEUE_POLICY \"" << policy << "\", frames are dropped when the recording falls behind");
+    }
+
     m_device = device;
     m_ros_writer = serializer;
     (*m_write_thread)->start(); //Start thread before creating the sensors (since they might write right away)
@@ -41,8 +61,9 @@ std::vector<std::shared_ptr<librealsense::record_sensor>> librealsense::record_d
         auto recording_sensor = std::make_shared<librealsense::record_sensor>(*this, live_sensor);
         m_on_notification_token = recording_sensor->on_notification += [this, recording_sensor, sensor_index](const notification& n) { write_notification(sensor_index, n); };
         auto on_error = [recording_sensor](const std::string& s) {recording_sensor->stop_with_error(s); };
-        m_on_frame_token = recording_sensor->on_frame += [this, recording_sensor, sensor_index, on_error](frame_holder f) { 
-            write_data(sensor_index, std::move(f), on_error);
+        auto on_warning = [recording_sensor](const std::string& s) {recording_sensor->raise_recording_warning(s); };
+        m_on_frame_token = recording_sensor->on_frame += [this, recording_sensor, sensor_index, on_error, on_warning](frame_holder f) { 
+            write_data(sensor_index, std::move(f), on_error, on_warning);
         };
         m_on_extension_change_token = recording_sensor->on_extension_change += [this, recording_sensor, sensor_index, on_error](rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot) { write_sensor_extension_snapshot(sensor_index, ext, snapshot, on_error); };
         recording_sensor->init(); //Calling init AFTER register to the above events
@@ -60,11 +81,22 @@ librealsense::record_device::~record_device()
         s->on_extension_change -= m_on_extension_change_token;
         s->disable_recording();
     }
+    {
+        // Release the sensors waiting for room in the queue
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        m_is_closing = true;
+        m_cache_cv.notify_all();
+    }
     if ((*m_write_thread)->flush() == false)
     {
         LOG_ERROR("Error - timeout waiting for flush, possible deadlock detected");
     }
     (*m_write_thread)->stop();
+    if (m_total_dropped_frames > 0)
+    {
+        LOG_WARNING("Recorder dropped " << m_total_dropped_frames << " frames, the recording could not keep up");
+    }
+    LOG_INFO("Recorder queue peaked at " << (m_peak_cached_data_size >> 20) << " MB out of " << (m_max_cached_data_size >> 20) << " MB");
     //Just in case someone still holds a reference to the sensors,
     // we make sure that they will not try to record anything
     m_sensors.clear();
@@ -113,7 +145,7 @@ std::chrono::nanoseconds librealsense::record_device::get_capture_time() const
     return (now - m_capture_time_base) - m_record_pause_time;
 }
 
-void librealsense::record_device::write_data(size_t sensor_index, librealsense::frame_holder frame, std::function<void(std::string const&)> on_error)
+void librealsense::record_device::write_data(size_t sensor_index, librealsense::frame_holder frame, std::function<void(std::string const&)> on_error, std::function<void(std::string const&)> on_warning)
 {
     //write_data is called from the sensors, when the live sensor raises a frame
 
@@ -124,51 +156,103 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         initialize_recording();
     });
 
-    //TODO: restore: uint64_t data_size = frame.frame->get_frame_data_size();
-    uint64_t cached_data_size = m_cached_data_size; //TODO: restore: (+ data_size)
-    if (cached_data_size > MAX_CACHED_DATA_SIZE)
+    uint64_t data_size = frame ? static_cast<uint64_t>(std::max(frame.frame->get_frame_data_size(), 0)) : 0;
+    if (!reserve_cached_data(data_size, on_warning))
     {
-        LOG_WARNING("Recorder reached maximum cache size, frame dropped");
-        on_error("Recorder reached maximum cache size, frame dropped");
         return;
     }
 
-    m_cached_data_size = cached_data_size;
     auto capture_time = get_capture_time();
     //TODO: remove usage of shared pointer when frame_holder is copyable
     auto frame_holder_ptr = std::make_shared<frame_holder>();
     *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
-        if (m_is_recording == false)
-        {
-            return; //Recording is paused
-        }
-        std::call_once(m_first_frame_flag, [&]()
+    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time, data_size, on_error](dispatcher::cancellable_timer t) {
+        if (m_is_recording) //Otherwise recording is paused
         {
+            std::call_once(m_first_frame_flag, [&]()
+            {
+                try
+                {
+                    write_header();
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Failed to write header. " << e.what());
+                    on_error(to_string() << "Failed to write header. " << e.what());
+                }
+            });
+
             try
             {
-                write_header();
+                const uint32_t device_index = 0;
+                auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
+                auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
+                m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
             }
-            catch (const std::exception& e)
+            catch(std::exception& e)
             {
-                LOG_ERROR("Failed to write header. " << e.what());
-                on_error(to_string() << "Failed to write header. " << e.what());
+                on_error(to_string() << "Failed to write frame. " << e.what());
             }
-        });
+        }
+        *frame_holder_ptr = {};
+        release_cached_data(data_size);
+    });
+}
 
-        try
+// Accounts for a frame about to be queued for writing, applying the queue policy when the memory budget is exceeded.
+// A frame is always accepted into an empty queue, whatever its size.
+bool librealsense::record_device::reserve_cached_data(uint64_t data_size, std::function<void(std::string const&)> on_warning)
+{
+    std::string warning;
+    bool accepted = false;
+    {
+        std::unique_lock<std::mutex> lock(m_cache_mutex);
+        auto fits = [&]() { return m_cached_data_size == 0 || m_cached_data_size + data_size <= m_max_cached_data_size; };
+        if (m_queue_policy == queue_policy::block)
         {
-            const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+            m_cache_cv.wait(lock, [&]() { return m_is_closing || fits(); });
         }
-        catch(std::exception& e)
+        if (m_is_closing)
         {
-            on_error(to_string() << "Failed to write frame. " << e.what());
+            return false;
         }
-    });
+
+        if (!fits())
+        {
+            // Reported once when the recording starts falling behind, and once more when it catches up
+            if (m_dropped_frames++ == 0)
+            {
+                warning = to_string() << "Recorder queue is full (" << (m_max_cached_data_size >> 20) << " MB), dropping frames";
+                LOG_WARNING(warning);
+            }
+            m_total_dropped_frames++;
+        }
+        else
+        {
+            if (m_dropped_frames > 0)
+            {
+                warning = to_string() << "Recorder caught up after dropping " << m_dropped_frames << " frames";
+                LOG_WARNING(warning);
+                m_dropped_frames = 0;
+            }
+            m_cached_data_size += data_size;
+            m_peak_cached_data_size = std::max(m_peak_cached_data_size, m_cached_data_size);
+            accepted = true;
+        }
+    }
+
+    if (!warning.empty())
+    {
+        on_warning(warning);
+    }
+    return accepted;
+}
+
+void librealsense::record_device::release_cached_data(uint64_t data_size)
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    m_cached_data_size -= data_size;
+    m_cache_cv.notify_all();
 }
 
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
@@ -20,6 +20,13 @@ namespace librealsense
     public:
         static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS
 
+        // What happens to frames arriving while the frames waiting to be written exceed the memory budget
+        enum class queue_policy
+        {
+            drop,   // the frame is dropped
+            block   // the sensor waits until there is room, holding back the frames of the device
+        };
+
         record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer);
         virtual ~record_device();
 
@@ -54,7 +61,9 @@ namespace librealsense
 
         void write_header();
         std::chrono::nanoseconds get_capture_time() const;
-        void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error);
+        void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error, std::function<void(std::string const&)> on_warning);
+        bool reserve_cached_data(uint64_t data_size, std::function<void(std::string const&)> on_warning);
+        void release_cached_data(uint64_t data_size);
         void write_sensor_extension_snapshot(size_t sensor_index, rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot, std::function<void(std::string const&)> on_error);
         void write_notification(size_t sensor_index, const notification& n);
         std::vector<std::shared_ptr<record_sensor>> create_record_sensors(std::shared_ptr<device_interface> m_device);
@@ -76,7 +85,16 @@ namespace librealsense
         int m_on_notification_token;
         int m_on_frame_token;
         int m_on_extension_change_token;
+
+        std::mutex m_cache_mutex;
+        std::condition_variable m_cache_cv;
         uint64_t m_cached_data_size;
+        uint64_t m_max_cached_data_size;
+        uint64_t m_peak_cached_data_size;
+        queue_policy m_queue_policy;
+        bool m_is_closing;
+        uint64_t m_dropped_frames;
+        uint64_t m_total_dropped_frames;
         std::once_flag m_first_call_flag;
         void initialize_recording();
         void stop_gracefully(to_string error_msg);
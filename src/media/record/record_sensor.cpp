@@ -197,6 +197,11 @@ void record_sensor::set_frames_callback(frame_callback_ptr callback)
     m_frame_callback = callback;
 }
 
+void record_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+{
+    m_sensor.set_frame_allocator(allocator); //route to base sensor
+}
+
 stream_profiles record_sensor::get_active_streams() const
 {
     return m_sensor.get_active_streams();
@@ -237,6 +242,16 @@ void record_sensor::stop_with_error(const std::string& error_msg)
     }
 }
 
+void record_sensor::raise_recording_warning(const std::string& message)
+{
+    if (m_user_notification_callback)
+    {
+        notification noti(RS2_NOTIFICATION_CATEGORY_UNKNOWN_ERROR, 0, RS2_LOG_SEVERITY_WARN, message);
+        rs2_notification rs2_noti(&noti);
+        m_user_notification_callback->on_notification(&rs2_noti);
+    }
+}
+
 void record_sensor::disable_recording()
 {
     m_is_recording = false;
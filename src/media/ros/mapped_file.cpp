@@ -0,0 +1,83 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "mapped_file.h"
+#include "types.h"
+
+#include <limits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace librealsense
+{
+#ifdef _WIN32
+    mapped_file::mapped_file(const std::string& path)
+        : _data(nullptr), _size(0)
+    {
+        auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw io_exception(to_string() << "Failed to open " << path << ", error: " << GetLastError());
+
+        LARGE_INTEGER size;
+        HANDLE mapping = nullptr;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0 &&
+            static_cast<uint64_t>(size.QuadPart) <= std::numeric_limits<size_t>::max())
+        {
+            mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        }
+        auto error = GetLastError();
+        CloseHandle(file);
+        if (!mapping)
+            throw io_exception(to_string() << "Failed to map " << path << ", error: " << error);
+
+        // The view keeps the mapping alive
+        _data = static_cast<uint8_t*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+        error = GetLastError();
+        CloseHandle(mapping);
+        if (!_data)
+            throw io_exception(to_string() << "Failed to map " << path << ", error: " << error);
+        _size = static_cast<uint64_t>(size.QuadPart);
+    }
+
+    mapped_file::~mapped_file()
+    {
+        UnmapViewOfFile(_data);
+    }
+#else
+    mapped_file::mapped_file(const std::string& path)
+        : _data(nullptr), _size(0)
+    {
+        auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw io_exception(to_string() << "Failed to open " << path << ", error: " << errno);
+
+        struct stat st;
+        void* data = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0 &&
+            static_cast<uint64_t>(st.st_size) <= std::numeric_limits<size_t>::max())
+        {
+            data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        }
+        auto error = errno;
+        // The mapping keeps the file alive
+        ::close(fd);
+        if (data == MAP_FAILED)
+            throw io_exception(to_string() << "Failed to map " << path << ", error: " << error);
+
+        _data = static_cast<uint8_t*>(data);
+        _size = static_cast<uint64_t>(st.st_size);
+    }
+
+    mapped_file::~mapped_file()
+    {
+        munmap(_data, static_cast<size_t>(_size));
+    }
+#endif
+}
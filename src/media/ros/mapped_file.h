@@ -0,0 +1,32 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace librealsense
+{
+    /*
+        A whole file mapped into memory, read only. Pages are loaded on first access and served from the page cache,
+        so that they are shared with other readers of the file and survive between passes over it.
+        The mapping is private: writing to it affects neither the file nor other mappings.
+    */
+    class mapped_file
+    {
+    public:
+        // Throws io_exception when the file cannot be mapped
+        explicit mapped_file(const std::string& path);
+        ~mapped_file();
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        uint8_t* data() const { return _data; }
+        uint64_t size() const { return _size; }
+
+    private:
+        uint8_t* _data;
+        uint64_t _size;
+    };
+}
@@ -13,6 +13,7 @@
 #include "std_msgs/Float32.h"
 #include "std_msgs/Float32MultiArray.h"
 #include "std_msgs/String.h"
+#include "std_msgs/UInt8MultiArray.h"
 #include "realsense_msgs/StreamInfo.h"
 #include "realsense_msgs/ImuIntrinsic.h"
 #include "realsense_msgs/Notification.h"
@@ -34,7 +35,9 @@ enum ros_file_versions
 {
     ROS_FILE_VERSION_2 = 2u,
     ROS_FILE_VERSION_3 = 3u,
-    ROS_FILE_WITH_RECOMMENDED_PROCESSING_BLOCKS = 4u
+    ROS_FILE_WITH_RECOMMENDED_PROCESSING_BLOCKS = 4u,
+    ROS_FILE_WITH_BINARY_METADATA = 5u,
+    ROS_FILE_WITH_FRAME_INDEX = 6u
 };
 
 
@@ -323,6 +326,23 @@ namespace librealsense
             return create_from({ stream_full_prefix(stream_id), stream_to_ros_type(stream_id.stream_type), "metadata" });
         }
 
+        /*version 5 and up*/
+        static std::string frame_binary_metadata_topic(const device_serializer::stream_identifier& stream_id)
+        {
+            return create_from({ stream_full_prefix(stream_id), stream_to_ros_type(stream_id.stream_type), "binary_metadata" });
+        }
+
+        /*version 6 and up*/
+        static std::string frame_index_topic(const device_serializer::stream_identifier& stream_id)
+        {
+            return create_from({ stream_full_prefix(stream_id), stream_to_ros_type(stream_id.stream_type), "index" });
+        }
+
+        static std::string stream_data_topic(const device_serializer::stream_identifier& stream_id)
+        {
+            return stream_id.stream_type == RS2_STREAM_POSE ? pose_transform_topic(stream_id) : frame_data_topic(stream_id);
+        }
+
         static std::string stream_extrinsic_topic(const device_serializer::stream_identifier& stream_id, uint32_t ref_id)
         {
             return create_from({ stream_full_prefix(stream_id), "tf", std::to_string(ref_id) });
@@ -519,13 +539,44 @@ namespace librealsense
         NotificationsQuery() :
             RegexTopicQuery(to_string() << R"RRR(/device_\d+/sensor_\d+/notification/.*)RRR") {}
     };
+    /**
+    * Version 5 and up: all the metadata of a frame is written as a single std_msgs::UInt8MultiArray message, holding
+    * this header followed by metadata_size bytes of (rs2_frame_metadata_value, rs2_metadata_type) pairs, packed,
+    * in the layout of frame_additional_data::metadata_blob
+    */
+#pragma pack(push, 1)
+    struct binary_metadata_header
+    {
+        double   system_time;
+        uint32_t timestamp_domain;
+        uint32_t metadata_size;
+    };
+#pragma pack(pop)
+
+    constexpr size_t binary_metadata_pair_size()
+    {
+        return sizeof(rs2_frame_metadata_value) + sizeof(rs2_metadata_type);
+    }
+
+    /**
+    * Version 6 and up: the frames of every stream are listed, in file order, by a single std_msgs::UInt8MultiArray
+    * message of frame_index_entry records written when the recording is closed
+    */
+#pragma pack(push, 1)
+    struct frame_index_entry
+    {
+        uint64_t timestamp;     // time of the frame message in the file, in nanoseconds
+        uint64_t frame_number;
+    };
+#pragma pack(pop)
+
     /**
     * Incremental number of the RealSense file format version
     * Since we maintain backward compatability, changes to topics/messages are reflected by the version
     */
     constexpr uint32_t get_file_version()
     {
-        return ROS_FILE_WITH_RECOMMENDED_PROCESSING_BLOCKS;
+        return ROS_FILE_WITH_FRAME_INDEX;
     }
 
     constexpr uint32_t get_minimum_supported_file_version()
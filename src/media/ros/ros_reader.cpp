@@ -20,13 +20,48 @@ namespace librealsense
 {
     using namespace device_serializer;
 
+    static const size_t DEFAULT_READ_AHEAD_MB = 256;
+    static const int MAX_READ_AHEAD_THREADS = 64;
+    static const size_t READ_AHEAD_FRAMES_PER_THREAD = 16;
+
+    // Image and IMU data topics - "/device_<d>/sensor_<s>/<stream>_<i>/<image|imu>/data"
+    static bool is_frame_data_topic(const std::string& topic)
+    {
+        static const std::string image_data = to_string() << "/" << ros_topic::ros_image_type_str() << "/data";
+        static const std::string imu_data = to_string() << "/" << ros_topic::ros_imu_type_str() << "/data";
+        auto ends_with = [&topic](const std::string& suffix)
+        {
+            return topic.size() >= suffix.size() && topic.compare(topic.size() - suffix.size(), suffix.size(), suffix) == 0;
+        };
+        return ends_with(image_data) || ends_with(imu_data);
+    }
+
     ros_reader::ros_reader(const std::string& file, const std::shared_ptr<context>& ctx) :
         m_metadata_parser_map(md_constant_parser::create_metadata_parser_map()),
         m_total_duration(0),
         m_file_path(file),
         m_context(ctx),
-        m_version(0)
+        m_version(0),
+        m_map_file(false),
+        m_read_ahead_threads(0),
+        m_read_ahead_budget(DEFAULT_READ_AHEAD_MB << 20),
+        m_read_ahead_next_worker(0),
+        m_read_ahead_size(0)
     {
+        if (auto threads_var = getenv("LRS_PLAYBACK_READ_AHEAD_THREADS"))
+        {
+            auto threads = atoi(threads_var);
+            m_read_ahead_threads = threads < 0 ? static_cast<int>(std::thread::hardware_concurrency()) : std::min(threads, MAX_READ_AHEAD_THREADS);
+        }
+        if (auto budget_var = getenv("LRS_PLAYBACK_READ_AHEAD_MB"))
+        {
+            m_read_ahead_budget = static_cast<size_t>(std::max(atoi(budget_var), 1)) << 20;
+        }
+        if (auto mmap_var = getenv("LRS_PLAYBACK_MMAP"))
+        {
+            m_map_file = atoi(mmap_var) != 0;
+        }
+
         try
         {
             reset(); //Note: calling a virtual function inside c'tor, safe while base function is pure virtual
@@ -39,6 +74,11 @@ namespace librealsense
         }
     }
 
+    ros_reader::~ros_reader()
+    {
+        stop_read_ahead();
+    }
+
     device_snapshot ros_reader::query_device_description(const nanoseconds& time)
     {
         return read_device_description(time);
@@ -46,6 +86,11 @@ namespace librealsense
 
     std::shared_ptr<serialized_data> ros_reader::read_next_data()
     {
+        if (m_samples_view != nullptr && m_read_ahead_threads > 0 && start_read_ahead())
+        {
+            return read_ahead_next_data();
+        }
+
         if (m_samples_view == nullptr || m_samples_itrator == m_samples_view->end())
         {
             LOG_DEBUG("End of file reached");
@@ -54,7 +99,11 @@ namespace librealsense
 
         rosbag::MessageInstance next_msg = *m_samples_itrator;
         ++m_samples_itrator;
+        return create_data(next_msg);
+    }
 
+    std::shared_ptr<serialized_data> ros_reader::create_data(const rosbag::MessageInstance& next_msg)
+    {
         if (next_msg.isType<sensor_msgs::Image>()
             || next_msg.isType<sensor_msgs::Imu>()
             || next_msg.isType<realsense_legacy_msgs::pose>()
@@ -99,7 +148,9 @@ namespace librealsense
         auto seek_time_as_secs = std::chrono::duration_cast<std::chrono::duration<double>>(seek_time);
         auto seek_time_as_rostime = rs2rosinternal::Time(seek_time_as_secs.count());
 
+        cancel_read_ahead();
         m_samples_view.reset(new rosbag::View(m_file, FalseQuery()));
+        m_metadata_cursors.clear();
 
         //Using cached topics here and not querying them (before reseting) since a previous call to seek
         // could have changed the view and some streams that should be streaming were dropped.
@@ -114,6 +165,26 @@ namespace librealsense
     std::vector<std::shared_ptr<serialized_data>> ros_reader::fetch_last_frames(const nanoseconds& seek_time)
     {
         std::vector<std::shared_ptr<serialized_data>> result;
+        if (m_version >= ROS_FILE_WITH_FRAME_INDEX)
+        {
+            // The last frame of every stream is looked up in its index rather than by reading all the frames up to the seek time
+            auto seek_ns = to_rostime(seek_time).toNSec();
+            for (auto&& topic : m_enabled_streams_topics)
+            {
+                if (!is_frame_data_topic(topic))
+                    continue;
+
+                auto stream_id = ros_topic::get_stream_identifier(topic);
+                auto&& index = get_frame_index(stream_id);
+                auto it = std::upper_bound(index.entries.begin(), index.entries.end(), seek_ns,
+                    [](uint64_t t, const frame_index_entry& e) { return t < e.timestamp; });
+                if (it == index.entries.begin())
+                    continue;
+                result.push_back(read_indexed_frame(stream_id, index, std::distance(index.entries.begin(), it) - 1));
+            }
+            return result;
+        }
+
         rosbag::View view(m_file, FalseQuery());
         auto as_rostime = to_rostime(seek_time);
         auto start_time = to_rostime(get_static_file_info_timestamp());
@@ -148,10 +219,13 @@ namespace librealsense
 
     void ros_reader::reset()
     {
+        cancel_read_ahead();
         m_file.close();
+        m_mapped_file.reset();
         m_file.open(m_file_path, rosbag::BagMode::Read);
         m_version = read_file_version(m_file);
         m_samples_view = nullptr;
+        m_metadata_cursors.clear();
         m_frame_source = std::make_shared<frame_source>(m_version == 1 ? 128 : 32);
         m_frame_source->init(m_metadata_parser_map);
         m_initial_device_description = read_device_description(get_static_file_info_timestamp(), true);
@@ -160,6 +234,7 @@ namespace librealsense
     void ros_reader::enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
     {
         rs2rosinternal::Time start_time = rs2rosinternal::TIME_MIN + rs2rosinternal::Duration{ 0, 1 }; //first non 0 timestamp and afterward
+        cancel_read_ahead();
         if (m_samples_view == nullptr) //Starting to stream
         {
             m_samples_view = std::unique_ptr<rosbag::View>(new rosbag::View(m_file, FalseQuery()));
@@ -207,6 +282,7 @@ namespace librealsense
         {
             return;
         }
+        cancel_read_ahead();
         rs2rosinternal::Time curr_time;
         if (m_samples_itrator == m_samples_view->end())
         {
@@ -241,6 +317,120 @@ namespace librealsense
         return m_file_path;
     }
 
+    size_t ros_reader::query_frames_count(const stream_identifier& stream_id)
+    {
+        return get_frame_index(stream_id).entries.size();
+    }
+
+    std::shared_ptr<serialized_frame> ros_reader::read_frame(const stream_identifier& stream_id, size_t index)
+    {
+        auto&& frames = get_frame_index(stream_id);
+        if (index >= frames.entries.size())
+        {
+            throw invalid_value_exception(to_string() << "Frame index " << index << " is out of range, stream " << stream_id << " has " << frames.entries.size() << " frames");
+        }
+        return read_indexed_frame(stream_id, frames, index);
+    }
+
+    size_t ros_reader::find_frame(const stream_identifier& stream_id, unsigned long long frame_number)
+    {
+        auto&& frames = get_frame_index(stream_id);
+        auto it = std::lower_bound(frames.by_frame_number.begin(), frames.by_frame_number.end(), std::make_pair(static_cast<uint64_t>(frame_number), size_t(0)));
+        if (it == frames.by_frame_number.end() || it->first != frame_number)
+        {
+            throw invalid_value_exception(to_string() << "Frame number " << frame_number << " was not recorded in stream " << stream_id);
+        }
+        return it->second;
+    }
+
+    const ros_reader::frame_index& ros_reader::get_frame_index(const stream_identifier& stream_id)
+    {
+        auto it = m_frame_indices.find(stream_id);
+        if (it != m_frame_indices.end())
+            return it->second;
+
+        if (m_version == legacy_file_format::file_version())
+        {
+            throw not_implemented_exception(to_string() << "Random access to frames is not supported for files of version " << m_version);
+        }
+
+        frame_index index;
+        rosbag::View index_view(m_file, rosbag::TopicQuery(ros_topic::frame_index_topic(stream_id)));
+        if (index_view.size() > 0)
+        {
+            auto msg = instantiate_msg<std_msgs::UInt8MultiArray>(*index_view.begin());
+            if (msg->data.size() % sizeof(frame_index_entry) != 0)
+            {
+                throw io_exception(to_string() << "Invalid frame index of stream " << stream_id << " (" << msg->data.size() << " bytes)");
+            }
+            index.entries.resize(msg->data.size() / sizeof(frame_index_entry));
+            if (!index.entries.empty())
+                memcpy(index.entries.data(), msg->data.data(), msg->data.size());
+        }
+        else
+        {
+            LOG_INFO("File has no frame index for stream " << stream_id << ", scanning its frames");
+            index.entries = build_frame_index(stream_id);
+        }
+
+        index.by_frame_number.reserve(index.entries.size());
+        for (size_t i = 0; i < index.entries.size(); ++i)
+        {
+            index.by_frame_number.emplace_back(index.entries[i].frame_number, i);
+        }
+        std::sort(index.by_frame_number.begin(), index.by_frame_number.end());
+
+        return m_frame_indices.emplace(stream_id, std::move(index)).first->second;
+    }
+
+    // Files recorded before version 6, or whose recording was not closed properly
+    std::vector<frame_index_entry> ros_reader::build_frame_index(const stream_identifier& stream_id)
+    {
+        std::vector<frame_index_entry> entries;
+        rosbag::View view(m_file, rosbag::TopicQuery(ros_topic::stream_data_topic(stream_id)));
+        entries.reserve(view.size());
+        for (auto&& msg : view)
+        {
+            uint64_t frame_number = 0;
+            if (msg.isType<sensor_msgs::Image>())
+            {
+                frame_number = instantiate_msg<sensor_msgs::Image>(msg)->header.seq;
+            }
+            else if (msg.isType<sensor_msgs::Imu>())
+            {
+                frame_number = instantiate_msg<sensor_msgs::Imu>(msg)->header.seq;
+            }
+            else
+            {
+                auto frame = create_frame(msg);
+                if (frame->frame)
+                    frame_number = frame->frame->get_frame_number();
+            }
+            entries.push_back({ msg.getTime().toNSec(), frame_number });
+        }
+        return entries;
+    }
+
+    std::shared_ptr<serialized_frame> ros_reader::read_indexed_frame(const stream_identifier& stream_id, const frame_index& index, size_t position)
+    {
+        auto&& entry = index.entries[position];
+        auto time = rs2rosinternal::Time().fromNSec(entry.timestamp);
+
+        // Frames of the same stream sharing a timestamp are told apart by their order
+        auto first_at_time = std::lower_bound(index.entries.begin(), index.entries.end(), entry.timestamp,
+            [](const frame_index_entry& e, uint64_t t) { return e.timestamp < t; });
+        auto skip = position - std::distance(index.entries.begin(), first_at_time);
+
+        rosbag::View view(m_file, rosbag::TopicQuery(ros_topic::stream_data_topic(stream_id)), time, time);
+        auto it = view.begin();
+        for (; it != view.end() && skip > 0; ++it, --skip);
+        if (it == view.end())
+        {
+            throw io_exception(to_string() << "Frame index of stream " << stream_id << " does not match the file, frame " << position << " is missing");
+        }
+        return create_frame(*it);
+    }
+
     std::shared_ptr<serialized_frame> ros_reader::create_frame(const rosbag::MessageInstance& msg)
     {
         auto next_msg_topic = msg.getTopic();
@@ -401,10 +591,285 @@ namespace librealsense
         return remaining;
     }
 
+    bool ros_reader::topic_cursor::seek(const rosbag::Bag& file, const std::string& topic, const rs2rosinternal::Time& t)
+    {
+        if (!view || t < time)
+        {
+            view.reset(new rosbag::View(file, rosbag::TopicQuery(topic), t));
+            it = view->begin();
+        }
+        time = t;
+
+        while (it != view->end() && it->getTime() < t)
+        {
+            ++it;
+        }
+        return it != view->end() && it->getTime() == t;
+    }
+
+    std::shared_ptr<serialized_data> ros_reader::read_frame_at(const std::string& topic, const rs2rosinternal::Time& time)
+    {
+        auto& cursor = m_frame_cursors[topic];
+        if (!cursor.seek(m_file, topic, time))
+        {
+            throw io_exception(to_string() << "Failed to read ahead message of " << topic << " at " << time);
+        }
+        return create_frame(*cursor.it);
+    }
+
+    bool ros_reader::start_read_ahead()
+    {
+        if (!m_read_ahead_workers.empty())
+            return true;
+
+        try
+        {
+            for (int i = 0; i < m_read_ahead_threads; i++)
+            {
+                std::unique_ptr<read_ahead_worker> worker(new read_ahead_worker());
+                worker->reader = std::make_shared<ros_reader>(m_file_path, m_context);
+                m_read_ahead_workers.push_back(std::move(worker));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Failed to start reading ahead, frames are read one at a time. Error: " << e.what());
+            m_read_ahead_workers.clear();
+            m_read_ahead_threads = 0;
+            return false;
+        }
+
+        for (auto&& worker : m_read_ahead_workers)
+        {
+            auto w = worker.get();
+            worker->thread = std::thread([w]() { read_ahead_loop(*w); });
+        }
+        LOG_INFO("Reading " << m_file_path << " ahead on " << m_read_ahead_threads << " threads, up to " << (m_read_ahead_budget >> 20) << " MB");
+        return true;
+    }
+
+    void ros_reader::read_ahead_loop(read_ahead_worker& worker)
+    {
+        while (true)
+        {
+            read_ahead_job job;
+            {
+                std::unique_lock<std::mutex> lock(worker.mutex);
+                worker.cv.wait(lock, [&]() { return worker.stopping || !worker.jobs.empty(); });
+                if (worker.stopping)
+                    return;
+                job = std::move(worker.jobs.front());
+                worker.jobs.pop_front();
+            }
+
+            try
+            {
+                job.result.set_value(worker.reader->read_frame_at(job.topic, job.time));
+            }
+            catch (...)
+            {
+                job.result.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    void ros_reader::fill_read_ahead()
+    {
+        // Frames are handed to the workers in turns, so that none holds more than READ_AHEAD_FRAMES_PER_THREAD
+        // of them - well below what the frame source of its reader can allocate
+        auto max_items = m_read_ahead_workers.size() * READ_AHEAD_FRAMES_PER_THREAD;
+        while (m_samples_itrator != m_samples_view->end() && m_read_ahead.size() < max_items &&
+               (m_read_ahead.empty() || m_read_ahead_size < m_read_ahead_budget))
+        {
+            read_ahead_item item;
+            item.position = m_samples_itrator;
+            item.size = 0;
+            rosbag::MessageInstance msg = *m_samples_itrator;
+            ++m_samples_itrator;
+
+            if (msg.isType<sensor_msgs::Image>()
+                || msg.isType<sensor_msgs::Imu>()
+                || msg.isType<realsense_legacy_msgs::pose>()
+                || msg.isType<geometry_msgs::Transform>())
+            {
+                read_ahead_job job;
+                job.topic = msg.getTopic();
+                job.time = msg.getTime();
+                item.data = job.result.get_future();
+                // Messages stored uncompressed are sized without reading their chunk
+                uint64_t offset;
+                uint32_t size;
+                item.size = msg.getDataPosition(offset, size) ? size : msg.size();
+
+                auto& worker = *m_read_ahead_workers[m_read_ahead_next_worker];
+                m_read_ahead_next_worker = (m_read_ahead_next_worker + 1) % m_read_ahead_workers.size();
+                {
+                    std::lock_guard<std::mutex> lock(worker.mutex);
+                    worker.jobs.push_back(std::move(job));
+                }
+                worker.cv.notify_one();
+            }
+            else
+            {
+                // Options and notifications are small, they are read right away
+                std::promise<std::shared_ptr<serialized_data>> result;
+                try
+                {
+                    result.set_value(create_data(msg));
+                }
+                catch (...)
+                {
+                    result.set_exception(std::current_exception());
+                }
+                item.data = result.get_future();
+            }
+
+            m_read_ahead_size += item.size;
+            m_read_ahead.push_back(std::move(item));
+        }
+    }
+
+    std::shared_ptr<serialized_data> ros_reader::read_ahead_next_data()
+    {
+        fill_read_ahead();
+        if (m_read_ahead.empty())
+        {
+            LOG_DEBUG("End of file reached");
+            return std::make_shared<serialized_end_of_file>();
+        }
+
+        auto item = std::move(m_read_ahead.front());
+        m_read_ahead.pop_front();
+        m_read_ahead_size -= item.size;
+
+        // Keep the workers busy while waiting, and while the caller handles this one
+        fill_read_ahead();
+        return item.data.get();
+    }
+
+    void ros_reader::cancel_read_ahead()
+    {
+        if (!m_read_ahead.empty())
+        {
+            m_samples_itrator = m_read_ahead.front().position;
+        }
+        m_read_ahead.clear();
+        m_read_ahead_size = 0;
+
+        // Jobs already taken are completed, and dropped along with their futures
+        for (auto&& worker : m_read_ahead_workers)
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->jobs.clear();
+        }
+    }
+
+    void ros_reader::stop_read_ahead()
+    {
+        cancel_read_ahead();
+        for (auto&& worker : m_read_ahead_workers)
+        {
+            {
+                std::lock_guard<std::mutex> lock(worker->mutex);
+                worker->stopping = true;
+            }
+            worker->cv.notify_one();
+            if (worker->thread.joinable())
+                worker->thread.join();
+        }
+        m_read_ahead_workers.clear();
+    }
+
+    void ros_reader::get_binary_frame_metadata(const device_serializer::stream_identifier& stream_id,
+        const rosbag::MessageInstance &msg,
+        frame_additional_data& additional_data) const
+    {
+        auto& cursor = m_metadata_cursors[stream_id];
+        if (!cursor.seek(m_file, ros_topic::frame_binary_metadata_topic(stream_id), msg.getTime()))
+        {
+            LOG_DEBUG("No metadata for frame of " << stream_id << " at " << msg.getTime());
+            return;
+        }
+
+        auto md_msg = instantiate_msg<std_msgs::UInt8MultiArray>(*cursor.it);
+        binary_metadata_header header;
+        if (md_msg->data.size() < sizeof(header))
+        {
+            LOG_WARNING("Invalid binary metadata of " << stream_id << ", size " << md_msg->data.size());
+            return;
+        }
+        memcpy(&header, md_msg->data.data(), sizeof(header));
+        if (header.metadata_size > md_msg->data.size() - sizeof(header))
+        {
+            LOG_WARNING("Invalid binary metadata of " << stream_id << ", " << header.metadata_size << " bytes declared");
+            return;
+        }
+
+        additional_data.system_time = header.system_time;
+        additional_data.timestamp_domain = static_cast<rs2_timestamp_domain>(header.timestamp_domain);
+
+        //Pairs that do not fit are dropped, as with the key/value metadata of previous versions
+        auto max_size = additional_data.metadata_blob.size() / binary_metadata_pair_size() * binary_metadata_pair_size();
+        auto size = std::min<size_t>(header.metadata_size, max_size);
+        memcpy(additional_data.metadata_blob.data(), md_msg->data.data() + sizeof(header), size);
+        additional_data.metadata_size = static_cast<uint32_t>(size);
+    }
+
+    bool ros_reader::map_image(const rosbag::MessageInstance& image_data, sensor_msgs::Image& msg, external_frame_buffer& pixels) const
+    {
+        uint64_t offset;
+        uint32_t size;
+        if (!m_map_file || !image_data.isType<sensor_msgs::Image>() || !image_data.getDataPosition(offset, size))
+            return false;
+
+        if (!m_mapped_file)
+        {
+            try
+            {
+                m_mapped_file = std::make_shared<mapped_file>(m_file_path);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Reading " << m_file_path << " without memory mapping: " << e.what());
+                m_map_file = false;
+                return false;
+            }
+        }
+
+        auto mapping = m_mapped_file;
+        if (offset > mapping->size() || size > mapping->size() - offset)
+            return false;
+
+        // Everything but the pixels, which the frame references in the file
+        rs2rosinternal::serialization::IStream stream(mapping->data() + offset, size);
+        stream.next(msg.header);
+        stream.next(msg.height);
+        stream.next(msg.width);
+        stream.next(msg.encoding);
+        stream.next(msg.is_bigendian);
+        stream.next(msg.step);
+        uint32_t data_size;
+        stream.next(data_size);
+        auto data = stream.advance(data_size);
+
+        // The pixels sit at any offset of the file, the SSE processing blocks need them 16 bytes aligned
+        if (reinterpret_cast<uintptr_t>(data) % 16 != 0)
+            return false;
+
+        pixels = external_frame_buffer(data, data_size, frame_continuation([mapping]() {}, data));
+        return true;
+    }
+
     frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data) const
     {
         LOG_DEBUG("Trying to create an image frame from message");
-        auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
+        external_frame_buffer pixels;
+        auto msg = std::make_shared<sensor_msgs::Image>();
+        if (!map_image(image_data, *msg, pixels))
+        {
+            // Created by the bag for this call only, the pixels can be moved to the frame
+            msg = std::const_pointer_cast<sensor_msgs::Image>(instantiate_msg<sensor_msgs::Image>(image_data));
+        }
         frame_additional_data additional_data{};
         std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
         additional_data.timestamp = timestamp_ms.count();
@@ -422,12 +887,19 @@ namespace librealsense
         {
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(image_data.getTopic());
-            auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
+            if (m_version >= ROS_FILE_WITH_BINARY_METADATA)
+            {
+                get_binary_frame_metadata(stream_id, image_data, additional_data);
+            }
+            else
+            {
+                auto info_topic = ros_topic::frame_metadata_topic(stream_id);
+                get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
+            }
         }
 
         frame_interface* frame = m_frame_source->alloc_frame((stream_id.stream_type == RS2_STREAM_DEPTH) ? RS2_EXTENSION_DEPTH_FRAME : RS2_EXTENSION_VIDEO_FRAME,
-            msg->data.size(), additional_data, true);
+            0, additional_data, false);
         if (frame == nullptr)
         {
             LOG_WARNING("Failed to allocate new frame");
@@ -442,7 +914,10 @@ namespace librealsense
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
+        if (pixels)
+            video_frame->external_data = std::move(pixels);
+        else
+            video_frame->data = std::move(msg->data);
         librealsense::frame_holder fh{ video_frame };
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
@@ -472,8 +947,15 @@ namespace librealsense
         {
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(motion_data.getTopic());
-            auto info_topic = ros_topic::frame_metadata_topic(stream_id);
-            get_frame_metadata(m_file, info_topic, stream_id, motion_data, additional_data);
+            if (m_version >= ROS_FILE_WITH_BINARY_METADATA)
+            {
+                get_binary_frame_metadata(stream_id, motion_data, additional_data);
+            }
+            else
+            {
+                auto info_topic = ros_topic::frame_metadata_topic(stream_id);
+                get_frame_metadata(m_file, info_topic, stream_id, motion_data, additional_data);
+            }
         }
 
         frame_interface* frame = m_frame_source->alloc_frame(RS2_EXTENSION_MOTION_FRAME, 3 * sizeof(float), additional_data, true);
@@ -594,7 +1076,12 @@ namespace librealsense
             //Version 2 and above
             stream_id = ros_topic::get_stream_identifier(msg.getTopic());
             auto info_topic = ros_topic::frame_metadata_topic(stream_id);
+            //The pose specific values are kept as key/value pairs in all versions
             auto remaining = get_frame_metadata(m_file, info_topic, stream_id, msg, additional_data);
+            if (m_version >= ROS_FILE_WITH_BINARY_METADATA)
+            {
+                get_binary_frame_metadata(stream_id, msg, additional_data);
+            }
             for (auto&& kvp : remaining)
             {
                 if (kvp.first == MAPPER_CONFIDENCE_MD_STR)
@@ -2,9 +2,15 @@
 // Copyright(c) 2017 Intel Corporation. All Rights Reserved.
 
 #pragma once
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
 #include <core/serialization.h>
 #include "rosbag/view.h"
 #include "ros_file_format.h"
+#include "mapped_file.h"
 
 namespace librealsense
 {
@@ -14,6 +20,7 @@ namespace librealsense
     {
     public:
         ros_reader(const std::string& file, const std::shared_ptr<context>& ctx);
+        ~ros_reader();
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
         void seek_to_time(const nanoseconds& seek_time) override;
@@ -23,6 +30,9 @@ namespace librealsense
         virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         const std::string& get_file_name() const override;
+        size_t query_frames_count(const stream_identifier& stream_id) override;
+        std::shared_ptr<serialized_frame> read_frame(const stream_identifier& stream_id, size_t index) override;
+        size_t find_frame(const stream_identifier& stream_id, unsigned long long frame_number) override;
 
     private:
 
@@ -41,6 +51,7 @@ namespace librealsense
             return msg_instnance_ptr;
         }
 
+        std::shared_ptr<serialized_data> create_data(const rosbag::MessageInstance& msg);
         std::shared_ptr<serialized_frame> create_frame(const rosbag::MessageInstance& msg);
         static nanoseconds get_file_duration(const rosbag::Bag& file, uint32_t version);
         static void get_legacy_frame_metadata(const rosbag::Bag& bag,
@@ -68,7 +79,11 @@ namespace librealsense
             const device_serializer::stream_identifier& stream_id,
             const rosbag::MessageInstance &msg,
             frame_additional_data& additional_data);
+        void get_binary_frame_metadata(const device_serializer::stream_identifier& stream_id,
+            const rosbag::MessageInstance &msg,
+            frame_additional_data& additional_data) const;
         frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const;
+        bool map_image(const rosbag::MessageInstance& image_data, sensor_msgs::Image& msg, external_frame_buffer& pixels) const;
         frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const;
         static inline float3 to_float3(const geometry_msgs::Vector3& v);
         static inline float4 to_float4(const geometry_msgs::Quaternion& q);
@@ -143,5 +158,83 @@ namespace librealsense
         std::vector<std::string>                m_enabled_streams_topics;
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
+
+        // Images stored uncompressed are referenced by their frames in a mapping of the file, instead of being copied
+        mutable bool                            m_map_file;
+        mutable std::shared_ptr<mapped_file>    m_mapped_file;
+
+        // Follows the messages of a single topic as they are read in order, instead of querying the file for every one.
+        // Starts over when asked for an earlier message.
+        struct topic_cursor
+        {
+            std::unique_ptr<rosbag::View> view;
+            rosbag::View::iterator it;
+            rs2rosinternal::Time time;
+
+            // Returns false when the topic has no message at the given time
+            bool seek(const rosbag::Bag& file, const std::string& topic, const rs2rosinternal::Time& time);
+        };
+        mutable std::map<device_serializer::stream_identifier, topic_cursor> m_metadata_cursors;
+
+        /*
+            Read-ahead: frames ahead of the samples iterator are decoded on worker threads, each reading the file through
+            a reader of its own, while the caller handles the current one. Frames are delivered in file order, and
+            the iterator is rewound to the first one not delivered whenever the samples view is about to change.
+        */
+        struct read_ahead_item
+        {
+            rosbag::View::iterator position;        // the iterator before this message
+            std::future<std::shared_ptr<serialized_data>> data;
+            size_t size;
+        };
+
+        struct read_ahead_job
+        {
+            std::string topic;
+            rs2rosinternal::Time time;
+            std::promise<std::shared_ptr<serialized_data>> result;
+        };
+
+        struct read_ahead_worker
+        {
+            std::shared_ptr<ros_reader> reader;
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<read_ahead_job> jobs;
+            bool stopping = false;
+            std::thread thread;
+        };
+
+        /*
+            Frame index: the frames of a stream in file order, loaded on first use from the index written when the
+            recording was closed, or built once by scanning the stream when the file has none. A frame is then read
+            directly at its time, which rosbag resolves to a chunk in O(log n).
+        */
+        struct frame_index
+        {
+            std::vector<frame_index_entry> entries;
+            std::vector<std::pair<uint64_t, size_t>> by_frame_number;   // (frame number, position), sorted
+        };
+
+        const frame_index& get_frame_index(const stream_identifier& stream_id);
+        std::vector<frame_index_entry> build_frame_index(const stream_identifier& stream_id);
+        std::shared_ptr<serialized_frame> read_indexed_frame(const stream_identifier& stream_id, const frame_index& index, size_t position);
+
+        std::shared_ptr<serialized_data> read_frame_at(const std::string& topic, const rs2rosinternal::Time& time);
+        std::shared_ptr<serialized_data> read_ahead_next_data();
+        bool start_read_ahead();
+        void fill_read_ahead();
+        void cancel_read_ahead();
+        void stop_read_ahead();
+        static void read_ahead_loop(read_ahead_worker& worker);
+
+        int                                     m_read_ahead_threads;
+        size_t                                  m_read_ahead_budget;
+        std::vector<std::unique_ptr<read_ahead_worker>> m_read_ahead_workers;
+        size_t                                  m_read_ahead_next_worker;
+        std::deque<read_ahead_item>             m_read_ahead;
+        size_t                                  m_read_ahead_size;
+        std::map<std::string, topic_cursor>     m_frame_cursors;
+        std::map<stream_identifier, frame_index> m_frame_indices;
     };
 }
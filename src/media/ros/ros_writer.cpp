@@ -17,6 +17,9 @@ namespace librealsense
 {
     using namespace device_serializer;
 
+    static const int MAX_COMPRESSION_THREADS = 16;
+    static const int DEFAULT_COMPRESSION_THREADS = 4;
+
     ros_writer::ros_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
     {
         LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
@@ -24,10 +27,38 @@ namespace librealsense
         if (compress_while_record)
         {
             m_bag.setCompression(rosbag::CompressionType::LZ4);
+
+            // Chunks are compressed on other cores than the one writing the frames, when there are any
+            int cores = static_cast<int>(std::thread::hardware_concurrency());
+            int threads = std::min(cores - 1, DEFAULT_COMPRESSION_THREADS);
+            if (auto threads_var = getenv("LRS_RECORD_COMPRESSION_THREADS"))
+            {
+                threads = atoi(threads_var);
+                threads = threads < 0 ? cores : std::min(threads, MAX_COMPRESSION_THREADS);
+            }
+            if (threads > 0)
+            {
+                LOG_INFO("Compressing the recording on " << threads << " threads");
+                m_bag.setCompressionThreads(static_cast<uint32_t>(threads));
+            }
         }
         write_file_version();
     }
 
+    ros_writer::~ros_writer()
+    {
+        try
+        {
+            write_frame_indices();
+            // Closed here rather than by the destructor of the bag, so that errors writing the remaining chunks are reported
+            m_bag.close();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Failed to complete the recording of " << m_file_path << ". Exception: " << e.what());
+        }
+    }
+
     void ros_writer::write_device_description(const librealsense::device_snapshot& device_description)
     {
         for (auto&& device_extension_snapshot : device_description.get_device_extensions_snapshots().get_snapshots())
@@ -46,23 +77,24 @@ namespace librealsense
 
     void ros_writer::write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
+        auto frame_number = frame->get_frame_number();
         if (Is<video_frame>(frame.frame))
         {
             write_video_frame(stream_id, timestamp, std::move(frame));
-            return;
         }
-
-        if (Is<motion_frame>(frame.frame))
+        else if (Is<motion_frame>(frame.frame))
         {
             write_motion_frame(stream_id, timestamp, std::move(frame));
-            return;
         }
-
-        if (Is<pose_frame>(frame.frame))
+        else if (Is<pose_frame>(frame.frame))
         {
             write_pose_frame(stream_id, timestamp, std::move(frame));
+        }
+        else
+        {
             return;
         }
+        m_frame_indices[stream_id].push_back({ to_rostime(timestamp).toNSec(), frame_number });
     }
 
     void ros_writer::write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot)
@@ -87,31 +119,45 @@ namespace librealsense
         write_message(ros_topic::file_version_topic(), get_static_file_info_timestamp(), msg);
     }
 
-    void ros_writer::write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame)
+    void ros_writer::write_frame_indices()
     {
-        auto metadata_topic = ros_topic::frame_metadata_topic(stream_id);
-        diagnostic_msgs::KeyValue system_time;
-        system_time.key = SYSTEM_TIME_MD_STR;
-        system_time.value = std::to_string(frame->get_frame_system_time());
-        write_message(metadata_topic, timestamp, system_time);
-
-        diagnostic_msgs::KeyValue timestamp_domain;
-        timestamp_domain.key = TIMESTAMP_DOMAIN_MD_STR;
-        timestamp_domain.value = librealsense::get_string(frame->get_frame_timestamp_domain());
-        write_message(metadata_topic, timestamp, timestamp_domain);
-
-        for (int i = 0; i < static_cast<rs2_frame_metadata_value>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); i++)
+        for (auto&& index : m_frame_indices)
         {
-            rs2_frame_metadata_value type = static_cast<rs2_frame_metadata_value>(i);
-            if (frame->supports_frame_metadata(type))
-            {
-                auto md = frame->get_frame_metadata(type);
-                diagnostic_msgs::KeyValue md_msg;
-                md_msg.key = librealsense::get_string(type);
-                md_msg.value = std::to_string(md);
-                write_message(metadata_topic, timestamp, md_msg);
-            }
+            // Frames are written in order of arrival, the index follows the order of the file
+            auto& entries = index.second;
+            std::stable_sort(entries.begin(), entries.end(),
+                [](const frame_index_entry& a, const frame_index_entry& b) { return a.timestamp < b.timestamp; });
+
+            std_msgs::UInt8MultiArray msg;
+            msg.data.resize(entries.size() * sizeof(frame_index_entry));
+            memcpy(msg.data.data(), entries.data(), msg.data.size());
+            write_message(ros_topic::frame_index_topic(index.first), get_static_file_info_timestamp(), msg);
         }
+        m_frame_indices.clear();
+    }
+
+    void ros_writer::write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame)
+    {
+        binary_metadata_header header{};
+        header.system_time = frame->get_frame_system_time();
+        header.timestamp_domain = static_cast<uint32_t>(frame->get_frame_timestamp_domain());
+
+        rs2_frame_metadata_value types[rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT];
+        rs2_metadata_type values[rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT];
+        auto count = frame->get_all_frame_metadata(types, values, rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT);
+
+        std_msgs::UInt8MultiArray md_msg;
+        md_msg.data.resize(sizeof(header) + count * binary_metadata_pair_size());
+        auto md = md_msg.data.data() + sizeof(header);
+        for (int i = 0; i < count; i++)
+        {
+            memcpy(md + header.metadata_size, &types[i], sizeof(types[i]));
+            memcpy(md + header.metadata_size + sizeof(types[i]), &values[i], sizeof(values[i]));
+            header.metadata_size += static_cast<uint32_t>(binary_metadata_pair_size());
+        }
+        memcpy(md_msg.data.data(), &header, sizeof(header));
+        md_msg.data.resize(sizeof(header) + header.metadata_size);
+        write_message(ros_topic::frame_binary_metadata_topic(stream_id), timestamp, md_msg);
     }
 
     void ros_writer::write_extrinsics(const stream_identifier& stream_id, frame_interface* frame)
@@ -13,6 +13,7 @@ namespace librealsense
     {
     public:
         explicit ros_writer(const std::string& file, bool compress_while_record);
+        ~ros_writer();
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
@@ -21,6 +22,7 @@ namespace librealsense
 
     private:
         void write_file_version();
+        void write_frame_indices();
         void write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
         void write_extrinsics(const stream_identifier& stream_id, frame_interface* frame);
         realsense_msgs::Notification to_notification_msg(const notification& n);
@@ -77,5 +79,6 @@ namespace librealsense
         std::string m_file_path;
         rosbag::Bag m_bag;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
+        std::map<stream_identifier, std::vector<frame_index_entry>> m_frame_indices;
     };
 }
@@ -11,18 +11,6 @@
 
 namespace librealsense
 {
-/** \brief Metadata fields that are utilized internally by librealsense
-    Provides extention to the r2_frame_metadata list of attributes*/
-    enum frame_metadata_internal
-    {
-        RS2_FRAME_METADATA_HW_TYPE  =   RS2_FRAME_METADATA_COUNT +1 , /**< 8-bit Module type: RS4xx, IVCAM*/
-        RS2_FRAME_METADATA_SKU_ID                                   , /**< 8-bit SKU Id*/
-        RS2_FRAME_METADATA_FORMAT                                   , /**< 16-bit Frame format*/
-        RS2_FRAME_METADATA_WIDTH                                    , /**< 16-bit Frame width. pixels*/
-        RS2_FRAME_METADATA_HEIGHT                                   , /**< 16-bit Frame height. pixels*/
-        RS2_FRAME_METADATA_COUNT
-    };
-
     /**\brief Base class that establishes the interface for retrieving metadata attributes*/
     class md_attribute_parser_base
     {
@@ -30,6 +18,15 @@ namespace librealsense
         virtual rs2_metadata_type get(const frame& frm) const = 0;
         virtual bool supports(const frame& frm) const = 0;
 
+        // Retrieves the attribute if it is available, validating the blob once rather than in both supports() and get()
+        virtual bool try_get(const frame& frm, rs2_metadata_type& value) const
+        {
+            if (!supports(frm))
+                return false;
+            value = get(frm);
+            return true;
+        }
+
         virtual ~md_attribute_parser_base() = default;
     };
 
@@ -59,16 +56,16 @@ namespace librealsense
             for (int i = 0; i < static_cast<int>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); ++i)
             {
                 auto frame_md_type = static_cast<rs2_frame_metadata_value>(i);
-                md_parser_map->insert(std::make_pair(frame_md_type, std::make_shared<md_constant_parser>(frame_md_type)));
+                (*md_parser_map)[frame_md_type] = std::make_shared<md_constant_parser>(frame_md_type);
             }
             return md_parser_map;
         }
-    private:
-        bool try_get(const frame& frm, rs2_metadata_type& result) const
+
+        bool try_get(const frame& frm, rs2_metadata_type& result) const override
         {
             auto pair_size = (sizeof(rs2_frame_metadata_value) + sizeof(rs2_metadata_type));
             const uint8_t* pos = frm.additional_data.metadata_blob.data();
-            while (pos <= frm.additional_data.metadata_blob.data() + frm.additional_data.metadata_blob.size())
+            while (pos + pair_size <= frm.additional_data.metadata_blob.data() + frm.additional_data.metadata_blob.size())
             {
                 const rs2_frame_metadata_value* type = reinterpret_cast<const rs2_frame_metadata_value*>(pos);
                 pos += sizeof(rs2_frame_metadata_value);
@@ -82,6 +79,8 @@ namespace librealsense
             }
             return false;
         }
+
+    private:
         rs2_frame_metadata_value _type;
     };
 
@@ -135,6 +134,18 @@ namespace librealsense
             return is_attribute_valid(s);
         }
 
+        bool try_get(const librealsense::frame & frm, rs2_metadata_type& value) const override
+        {
+            auto s = reinterpret_cast<const S*>(((const uint8_t*)frm.additional_data.metadata_blob.data()) + _offset);
+
+            if (!is_attribute_valid(s))
+                return false;
+
+            value = static_cast<rs2_metadata_type>((*s).*_md_attribute);
+            if (_modifyer) value = _modifyer(value);
+            return true;
+        }
+
     protected:
 
             bool is_attribute_valid(const S* s) const
@@ -313,6 +324,15 @@ namespace librealsense
         {
             return (_sensor_ts_parser->supports(frm) && _frame_ts_parser->supports(frm));
         };
+
+        bool try_get(const librealsense::frame & frm, rs2_metadata_type& value) const override
+        {
+            rs2_metadata_type frame_ts, sensor_ts;
+            if (!_frame_ts_parser->try_get(frm, frame_ts) || !_sensor_ts_parser->try_get(frm, sensor_ts))
+                return false;
+            value = frame_ts - sensor_ts;
+            return true;
+        }
     };
 
 
@@ -101,6 +101,7 @@ namespace librealsense
 
             std::string get_device_location() const override { return _location; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
+            bool defers_buffer_requeue() const override { return true; }
             IAMVideoProcAmp* get_video_proc() const;
             IAMCameraControl* get_camera_control() const;
 
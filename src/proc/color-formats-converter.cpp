@@ -20,206 +20,256 @@
 
 #if defined (ANDROID) || (defined (__linux__) && !defined (__x86_64__))
 
-bool has_avx() { return false; }
+bool has_avx2() { return false; }
+bool has_avx512() { return false; }
 
 #else
 
 #ifdef _WIN32
 #include <intrin.h>
+#include <immintrin.h>
 #define cpuid(info, x)    __cpuidex(info, x, 0)
+#define xgetbv(x)         _xgetbv(x)
 #else
 #include <cpuid.h>
 void cpuid(int info[4], int info_type) {
     __cpuid_count(info_type, 0, info[0], info[1], info[2], info[3]);
 }
+unsigned long long xgetbv(unsigned int index) {
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return ((unsigned long long)edx << 32) | eax;
+}
 #endif
 
-bool has_avx()
+// AVX instructions require the OS to save the extended registers on context switch, not only CPU support
+bool has_avx2()
 {
     int info[4];
     cpuid(info, 0);
-    cpuid(info, 0x80000000);
-    return (info[2] & ((int)1 << 28)) != 0;
+    if (info[0] < 7)
+        return false;
+
+    cpuid(info, 1);
+    bool osxsave = (info[2] & ((int)1 << 27)) != 0;
+    bool avx = (info[2] & ((int)1 << 28)) != 0;
+    if (!osxsave || !avx || (xgetbv(0) & 0x6) != 0x6) // XMM and YMM state
+        return false;
+
+    cpuid(info, 7);
+    return (info[1] & ((int)1 << 5)) != 0;
+}
+
+bool has_avx512()
+{
+    if (!has_avx2())
+        return false;
+
+    int info[4];
+    cpuid(info, 7);
+    bool avx512f = (info[1] & ((int)1 << 16)) != 0;
+    bool avx512bw = (info[1] & ((int)1 << 30)) != 0;
+    return avx512f && avx512bw && (xgetbv(0) & 0xE0) == 0xE0; // opmask and ZMM state
 }
 
 #endif
 
 namespace librealsense 
 {
+    simd_isa get_simd_isa()
+    {
+        static const simd_isa isa = has_avx512() ? simd_isa_avx512 : has_avx2() ? simd_isa_avx2 :
+#if defined __SSSE3__ && ! defined ANDROID
+            simd_isa_ssse3;
+#else
+            simd_isa_none;
+#endif
+        return isa;
+    }
+
+    // Kernels selected for one source/target format pair
+    struct unpack_dispatch
+    {
+        unpack_kernel simd = nullptr;   // AVX2 / AVX-512 kernel, if available in this build
+        int simd_block = 0;             // pixels the simd kernel consumes per iteration
+        unpack_kernel base = nullptr;   // SSSE3 or generic kernel, consumes any multiple of 16 pixels
+    };
+
+    static void unpack_pixels(const unpack_dispatch& kernels, rs2_format dst_format, byte * const d[], const byte * s, int n)
+    {
+        assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
+
+        auto done = 0;
+        if (kernels.simd)
+        {
+            done = n - n % kernels.simd_block;
+            if (done)
+                kernels.simd(d, s, done);
+        }
+        if (done < n)
+        {
+            byte * const rest[] = { d[0] + done * get_image_bpp(dst_format) / 8 };
+            kernels.base(rest, s + done * 2, n - done);
+        }
+    }
+
     /////////////////////////////
     // YUY2 unpacking routines //
     /////////////////////////////
     // This templated function unpacks YUY2 into Y8/Y16/RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
     // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
-    template<rs2_format FORMAT> void unpack_yuy2(byte * const d[], const byte * s, int width, int height, int actual_size)
-    {
-        auto n = width * height;
-        assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
-#ifdef RS2_USE_CUDA
-        rscuda::unpack_yuy2_cuda<FORMAT>(d, s, n);
-        return;
-#endif
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
-#ifdef __AVX2__
+    template<rs2_format FORMAT> void unpack_yuy2_ssse3(byte * const d[], const byte * s, int n)
+    {
+        auto src = reinterpret_cast<const __m128i *>(s);
+        auto dst = reinterpret_cast<__m128i *>(d[0]);
 
-        if (do_avx)
-        {
-            if (FORMAT == RS2_FORMAT_Y8) unpack_yuy2_avx_y8(d, s, n);
-            if (FORMAT == RS2_FORMAT_Y16) unpack_yuy2_avx_y16(d, s, n);
-            if (FORMAT == RS2_FORMAT_RGB8) unpack_yuy2_avx_rgb8(d, s, n);
-            if (FORMAT == RS2_FORMAT_RGBA8) unpack_yuy2_avx_rgba8(d, s, n);
-            if (FORMAT == RS2_FORMAT_BGR8) unpack_yuy2_avx_bgr8(d, s, n);
-            if (FORMAT == RS2_FORMAT_BGRA8) unpack_yuy2_avx_bgra8(d, s, n);
-        }
-        else
-#endif
+#pragma omp parallel for
+        for (int i = 0; i < n / 16; i++)
         {
-            auto src = reinterpret_cast<const __m128i *>(s);
-            auto dst = reinterpret_cast<__m128i *>(d[0]);
+            const __m128i zero = _mm_set1_epi8(0);
+            const __m128i n100 = _mm_set1_epi16(100 << 4);
+            const __m128i n208 = _mm_set1_epi16(208 << 4);
+            const __m128i n298 = _mm_set1_epi16(298 << 4);
+            const __m128i n409 = _mm_set1_epi16(409 << 4);
+            const __m128i n516 = _mm_set1_epi16(516 << 4);
+            const __m128i evens_odds = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
 
-#pragma omp parallel for
-            for (int i = 0; i < n / 16; i++)
+            // Load 8 YUY2 pixels each into two 16-byte registers
+            __m128i s0 = _mm_loadu_si128(&src[i * 2]);
+            __m128i s1 = _mm_loadu_si128(&src[i * 2 + 1]);
+
+            if (FORMAT == RS2_FORMAT_Y8)
             {
-                const __m128i zero = _mm_set1_epi8(0);
-                const __m128i n100 = _mm_set1_epi16(100 << 4);
-                const __m128i n208 = _mm_set1_epi16(208 << 4);
-                const __m128i n298 = _mm_set1_epi16(298 << 4);
-                const __m128i n409 = _mm_set1_epi16(409 << 4);
-                const __m128i n516 = _mm_set1_epi16(516 << 4);
-                const __m128i evens_odds = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
-
-                // Load 8 YUY2 pixels each into two 16-byte registers
-                __m128i s0 = _mm_loadu_si128(&src[i * 2]);
-                __m128i s1 = _mm_loadu_si128(&src[i * 2 + 1]);
-
-                if (FORMAT == RS2_FORMAT_Y8)
-                {
-                    // Align all Y components and output 16 pixels (16 bytes) at once
-                    __m128i y0 = _mm_shuffle_epi8(s0, _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14));
-                    __m128i y1 = _mm_shuffle_epi8(s1, _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
-                    _mm_storeu_si128(&dst[i], _mm_alignr_epi8(y0, y1, 8));
-                    continue;
-                }
+                // Align all Y components and output 16 pixels (16 bytes) at once
+                __m128i y0 = _mm_shuffle_epi8(s0, _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, 10, 12, 14));
+                __m128i y1 = _mm_shuffle_epi8(s1, _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15));
+                _mm_storeu_si128(&dst[i], _mm_alignr_epi8(y1, y0, 8));
+                continue;
+            }
 
-                // Shuffle all Y components to the low order bytes of the register, and all U/V components to the high order bytes
-                const __m128i evens_odd1s_odd3s = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15); // to get yyyyyyyyuuuuvvvv
-                __m128i yyyyyyyyuuuuvvvv0 = _mm_shuffle_epi8(s0, evens_odd1s_odd3s);
-                __m128i yyyyyyyyuuuuvvvv8 = _mm_shuffle_epi8(s1, evens_odd1s_odd3s);
+            // Shuffle all Y components to the low order bytes of the register, and all U/V components to the high order bytes
+            const __m128i evens_odd1s_odd3s = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 5, 9, 13, 3, 7, 11, 15); // to get yyyyyyyyuuuuvvvv
+            __m128i yyyyyyyyuuuuvvvv0 = _mm_shuffle_epi8(s0, evens_odd1s_odd3s);
+            __m128i yyyyyyyyuuuuvvvv8 = _mm_shuffle_epi8(s1, evens_odd1s_odd3s);
+
+            // Retrieve all 16 Y components as 16-bit values (8 components per register))
+            __m128i y16__0_7 = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv0, zero);         // convert to 16 bit
+            __m128i y16__8_F = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv8, zero);         // convert to 16 bit
 
-                // Retrieve all 16 Y components as 16-bit values (8 components per register))
-                __m128i y16__0_7 = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv0, zero);         // convert to 16 bit
-                __m128i y16__8_F = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv8, zero);         // convert to 16 bit
+            if (FORMAT == RS2_FORMAT_Y16)
+            {
+                // Output 16 pixels (32 bytes) at once
+                _mm_storeu_si128(&dst[i * 2], _mm_slli_epi16(y16__0_7, 8));
+                _mm_storeu_si128(&dst[i * 2 + 1], _mm_slli_epi16(y16__8_F, 8));
+                continue;
+            }
 
-                if (FORMAT == RS2_FORMAT_Y16)
+            // Retrieve all 16 U and V components as 16-bit values (8 components per register)
+            __m128i uv = _mm_unpackhi_epi32(yyyyyyyyuuuuvvvv0, yyyyyyyyuuuuvvvv8); // uuuuuuuuvvvvvvvv
+            __m128i u = _mm_unpacklo_epi8(uv, uv);                                 //  uu uu uu uu uu uu uu uu  u's duplicated
+            __m128i v = _mm_unpackhi_epi8(uv, uv);                                 //  vv vv vv vv vv vv vv vv
+            __m128i u16__0_7 = _mm_unpacklo_epi8(u, zero);                         // convert to 16 bit
+            __m128i u16__8_F = _mm_unpackhi_epi8(u, zero);                         // convert to 16 bit
+            __m128i v16__0_7 = _mm_unpacklo_epi8(v, zero);                         // convert to 16 bit
+            __m128i v16__8_F = _mm_unpackhi_epi8(v, zero);                         // convert to 16 bit
+
+                                                                                   // Compute R, G, B values for first 8 pixels
+            __m128i c16__0_7 = _mm_slli_epi16(_mm_subs_epi16(y16__0_7, _mm_set1_epi16(16)), 4);
+            __m128i d16__0_7 = _mm_slli_epi16(_mm_subs_epi16(u16__0_7, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
+            __m128i e16__0_7 = _mm_slli_epi16(_mm_subs_epi16(v16__0_7, _mm_set1_epi16(128)), 4);
+            __m128i r16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(e16__0_7, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
+            __m128i g16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n100)), _mm_mulhi_epi16(e16__0_7, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
+            __m128i b16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
+
+                                                                                                                                                                                                                             // Compute R, G, B values for second 8 pixels
+            __m128i c16__8_F = _mm_slli_epi16(_mm_subs_epi16(y16__8_F, _mm_set1_epi16(16)), 4);
+            __m128i d16__8_F = _mm_slli_epi16(_mm_subs_epi16(u16__8_F, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
+            __m128i e16__8_F = _mm_slli_epi16(_mm_subs_epi16(v16__8_F, _mm_set1_epi16(128)), 4);
+            __m128i r16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(e16__8_F, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
+            __m128i g16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n100)), _mm_mulhi_epi16(e16__8_F, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
+            __m128i b16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
+
+            if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
+            {
+                // Shuffle separate R, G, B values into four registers storing four pixels each in (R, G, B, A) order
+                __m128i rg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                __m128i ba8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_set1_epi8(-1));
+                __m128i rgba_0_3 = _mm_unpacklo_epi16(rg8__0_7, ba8__0_7);
+                __m128i rgba_4_7 = _mm_unpackhi_epi16(rg8__0_7, ba8__0_7);
+
+                __m128i rg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                __m128i ba8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_set1_epi8(-1));
+                __m128i rgba_8_B = _mm_unpacklo_epi16(rg8__8_F, ba8__8_F);
+                __m128i rgba_C_F = _mm_unpackhi_epi16(rg8__8_F, ba8__8_F);
+
+                if (FORMAT == RS2_FORMAT_RGBA8)
                 {
-                    // Output 16 pixels (32 bytes) at once
-                    _mm_storeu_si128(&dst[i * 2], _mm_slli_epi16(y16__0_7, 8));
-                    _mm_storeu_si128(&dst[i * 2 + 1], _mm_slli_epi16(y16__8_F, 8));
-                    continue;
+                    // Store 16 pixels (64 bytes) at once
+                    _mm_storeu_si128(&dst[i * 4], rgba_0_3);
+                    _mm_storeu_si128(&dst[i * 4 + 1], rgba_4_7);
+                    _mm_storeu_si128(&dst[i * 4 + 2], rgba_8_B);
+                    _mm_storeu_si128(&dst[i * 4 + 3], rgba_C_F);
                 }
 
-                // Retrieve all 16 U and V components as 16-bit values (8 components per register)
-                __m128i uv = _mm_unpackhi_epi32(yyyyyyyyuuuuvvvv0, yyyyyyyyuuuuvvvv8); // uuuuuuuuvvvvvvvv
-                __m128i u = _mm_unpacklo_epi8(uv, uv);                                 //  uu uu uu uu uu uu uu uu  u's duplicated
-                __m128i v = _mm_unpackhi_epi8(uv, uv);                                 //  vv vv vv vv vv vv vv vv
-                __m128i u16__0_7 = _mm_unpacklo_epi8(u, zero);                         // convert to 16 bit
-                __m128i u16__8_F = _mm_unpackhi_epi8(u, zero);                         // convert to 16 bit
-                __m128i v16__0_7 = _mm_unpacklo_epi8(v, zero);                         // convert to 16 bit
-                __m128i v16__8_F = _mm_unpackhi_epi8(v, zero);                         // convert to 16 bit
-
-                                                                                       // Compute R, G, B values for first 8 pixels
-                __m128i c16__0_7 = _mm_slli_epi16(_mm_subs_epi16(y16__0_7, _mm_set1_epi16(16)), 4);
-                __m128i d16__0_7 = _mm_slli_epi16(_mm_subs_epi16(u16__0_7, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
-                __m128i e16__0_7 = _mm_slli_epi16(_mm_subs_epi16(v16__0_7, _mm_set1_epi16(128)), 4);
-                __m128i r16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(e16__0_7, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
-                __m128i g16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n100)), _mm_mulhi_epi16(e16__0_7, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
-                __m128i b16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
-
-                                                                                                                                                                                                                                 // Compute R, G, B values for second 8 pixels
-                __m128i c16__8_F = _mm_slli_epi16(_mm_subs_epi16(y16__8_F, _mm_set1_epi16(16)), 4);
-                __m128i d16__8_F = _mm_slli_epi16(_mm_subs_epi16(u16__8_F, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
-                __m128i e16__8_F = _mm_slli_epi16(_mm_subs_epi16(v16__8_F, _mm_set1_epi16(128)), 4);
-                __m128i r16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(e16__8_F, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
-                __m128i g16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n100)), _mm_mulhi_epi16(e16__8_F, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
-                __m128i b16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
-
-                if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
+                if (FORMAT == RS2_FORMAT_RGB8)
                 {
-                    // Shuffle separate R, G, B values into four registers storing four pixels each in (R, G, B, A) order
-                    __m128i rg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                    __m128i ba8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_set1_epi8(-1));
-                    __m128i rgba_0_3 = _mm_unpacklo_epi16(rg8__0_7, ba8__0_7);
-                    __m128i rgba_4_7 = _mm_unpackhi_epi16(rg8__0_7, ba8__0_7);
-
-                    __m128i rg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                    __m128i ba8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_set1_epi8(-1));
-                    __m128i rgba_8_B = _mm_unpacklo_epi16(rg8__8_F, ba8__8_F);
-                    __m128i rgba_C_F = _mm_unpackhi_epi16(rg8__8_F, ba8__8_F);
-
-                    if (FORMAT == RS2_FORMAT_RGBA8)
-                    {
-                        // Store 16 pixels (64 bytes) at once
-                        _mm_storeu_si128(&dst[i * 4], rgba_0_3);
-                        _mm_storeu_si128(&dst[i * 4 + 1], rgba_4_7);
-                        _mm_storeu_si128(&dst[i * 4 + 2], rgba_8_B);
-                        _mm_storeu_si128(&dst[i * 4 + 3], rgba_C_F);
-                    }
-
-                    if (FORMAT == RS2_FORMAT_RGB8)
-                    {
-                        // Shuffle rgb triples to the start and end of each register
-                        __m128i rgb0 = _mm_shuffle_epi8(rgba_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i rgb1 = _mm_shuffle_epi8(rgba_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i rgb2 = _mm_shuffle_epi8(rgba_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
-                        __m128i rgb3 = _mm_shuffle_epi8(rgba_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
-
-                        // Align registers and store 16 pixels (48 bytes) at once
-                        _mm_storeu_si128(&dst[i * 3], _mm_alignr_epi8(rgb1, rgb0, 4));
-                        _mm_storeu_si128(&dst[i * 3 + 1], _mm_alignr_epi8(rgb2, rgb1, 8));
-                        _mm_storeu_si128(&dst[i * 3 + 2], _mm_alignr_epi8(rgb3, rgb2, 12));
-                    }
+                    // Shuffle rgb triples to the start and end of each register
+                    __m128i rgb0 = _mm_shuffle_epi8(rgba_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
+                    __m128i rgb1 = _mm_shuffle_epi8(rgba_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
+                    __m128i rgb2 = _mm_shuffle_epi8(rgba_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
+                    __m128i rgb3 = _mm_shuffle_epi8(rgba_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
+
+                    // Align registers and store 16 pixels (48 bytes) at once
+                    _mm_storeu_si128(&dst[i * 3], _mm_alignr_epi8(rgb1, rgb0, 4));
+                    _mm_storeu_si128(&dst[i * 3 + 1], _mm_alignr_epi8(rgb2, rgb1, 8));
+                    _mm_storeu_si128(&dst[i * 3 + 2], _mm_alignr_epi8(rgb3, rgb2, 12));
                 }
+            }
 
-                if (FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8)
+            if (FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8)
+            {
+                // Shuffle separate R, G, B values into four registers storing four pixels each in (B, G, R, A) order
+                __m128i bg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                __m128i ra8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_set1_epi8(-1));
+                __m128i bgra_0_3 = _mm_unpacklo_epi16(bg8__0_7, ra8__0_7);
+                __m128i bgra_4_7 = _mm_unpackhi_epi16(bg8__0_7, ra8__0_7);
+
+                __m128i bg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                __m128i ra8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_set1_epi8(-1));
+                __m128i bgra_8_B = _mm_unpacklo_epi16(bg8__8_F, ra8__8_F);
+                __m128i bgra_C_F = _mm_unpackhi_epi16(bg8__8_F, ra8__8_F);
+
+                if (FORMAT == RS2_FORMAT_BGRA8)
                 {
-                    // Shuffle separate R, G, B values into four registers storing four pixels each in (B, G, R, A) order
-                    __m128i bg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                    __m128i ra8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_set1_epi8(-1));
-                    __m128i bgra_0_3 = _mm_unpacklo_epi16(bg8__0_7, ra8__0_7);
-                    __m128i bgra_4_7 = _mm_unpackhi_epi16(bg8__0_7, ra8__0_7);
-
-                    __m128i bg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                    __m128i ra8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_set1_epi8(-1));
-                    __m128i bgra_8_B = _mm_unpacklo_epi16(bg8__8_F, ra8__8_F);
-                    __m128i bgra_C_F = _mm_unpackhi_epi16(bg8__8_F, ra8__8_F);
-
-                    if (FORMAT == RS2_FORMAT_BGRA8)
-                    {
-                        // Store 16 pixels (64 bytes) at once
-                        _mm_storeu_si128(&dst[i * 4], bgra_0_3);
-                        _mm_storeu_si128(&dst[i * 4 + 1], bgra_4_7);
-                        _mm_storeu_si128(&dst[i * 4 + 2], bgra_8_B);
-                        _mm_storeu_si128(&dst[i * 4 + 3], bgra_C_F);
-                    }
-
-                    if (FORMAT == RS2_FORMAT_BGR8)
-                    {
-                        // Shuffle rgb triples to the start and end of each register
-                        __m128i bgr0 = _mm_shuffle_epi8(bgra_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i bgr1 = _mm_shuffle_epi8(bgra_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                        __m128i bgr2 = _mm_shuffle_epi8(bgra_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
-                        __m128i bgr3 = _mm_shuffle_epi8(bgra_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
-
-                        // Align registers and store 16 pixels (48 bytes) at once
-                        _mm_storeu_si128(&dst[i * 3], _mm_alignr_epi8(bgr1, bgr0, 4));
-                        _mm_storeu_si128(&dst[i * 3 + 1], _mm_alignr_epi8(bgr2, bgr1, 8));
-                        _mm_storeu_si128(&dst[i * 3 + 2], _mm_alignr_epi8(bgr3, bgr2, 12));
-                    }
+                    // Store 16 pixels (64 bytes) at once
+                    _mm_storeu_si128(&dst[i * 4], bgra_0_3);
+                    _mm_storeu_si128(&dst[i * 4 + 1], bgra_4_7);
+                    _mm_storeu_si128(&dst[i * 4 + 2], bgra_8_B);
+                    _mm_storeu_si128(&dst[i * 4 + 3], bgra_C_F);
+                }
+
+                if (FORMAT == RS2_FORMAT_BGR8)
+                {
+                    // Shuffle rgb triples to the start and end of each register
+                    __m128i bgr0 = _mm_shuffle_epi8(bgra_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
+                    __m128i bgr1 = _mm_shuffle_epi8(bgra_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
+                    __m128i bgr2 = _mm_shuffle_epi8(bgra_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
+                    __m128i bgr3 = _mm_shuffle_epi8(bgra_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
+
+                    // Align registers and store 16 pixels (48 bytes) at once
+                    _mm_storeu_si128(&dst[i * 3], _mm_alignr_epi8(bgr1, bgr0, 4));
+                    _mm_storeu_si128(&dst[i * 3 + 1], _mm_alignr_epi8(bgr2, bgr1, 8));
+                    _mm_storeu_si128(&dst[i * 3 + 2], _mm_alignr_epi8(bgr3, bgr2, 12));
                 }
             }
         }
-#else  // Generic code for when SSSE3 is not available.
+    }
+#endif
+
+    // Generic code for when SSSE3 is not available, also unpacks the pixels remaining after the wider SIMD kernels
+    template<rs2_format FORMAT> void unpack_yuy2_generic(byte * const d[], const byte * s, int n)
+    {
         auto src = reinterpret_cast<const uint8_t *>(s);
         auto dst = reinterpret_cast<uint8_t *>(d[0]);
         for (; n; n -= 16, src += 32)
@@ -351,7 +401,33 @@ namespace librealsense
                 continue;
             }
         }
+    }
+
+    template<rs2_format FORMAT> unpack_dispatch resolve_yuy2(simd_isa isa)
+    {
+        unpack_dispatch res;
+        res.base = unpack_yuy2_generic<FORMAT>;
+#if defined __SSSE3__ && ! defined ANDROID
+        if (isa >= simd_isa_ssse3)
+            res.base = unpack_yuy2_ssse3<FORMAT>;
 #endif
+        if (isa >= simd_isa_avx512 && (res.simd = get_yuy2_avx512_kernel(FORMAT)))
+            res.simd_block = avx512_block_pixels;
+        else if (isa >= simd_isa_avx2 && (res.simd = get_yuy2_avx2_kernel(FORMAT)))
+            res.simd_block = avx2_block_pixels;
+        return res;
+    }
+
+    template<rs2_format FORMAT> void unpack_yuy2(byte * const d[], const byte * s, int width, int height, int actual_size)
+    {
+        auto n = width * height;
+#ifdef RS2_USE_CUDA
+        rscuda::unpack_yuy2_cuda<FORMAT>(d, s, n);
+        return;
+#endif
+        // Resolved on first use, for the best instruction set the running CPU supports
+        static const unpack_dispatch kernels = resolve_yuy2<FORMAT>(get_simd_isa());
+        unpack_pixels(kernels, FORMAT, d, s, n);
     }
 
     void unpack_yuy2(rs2_format dst_format, rs2_stream dst_stream, byte * const d[], const byte * s, int w, int h, int actual_size)
@@ -382,17 +458,31 @@ namespace librealsense
         }
     }
 
+    void unpack_yuy2(rs2_format dst_format, byte * const d[], const byte * s, int w, int h, simd_isa isa)
+    {
+        unpack_dispatch kernels;
+        switch (dst_format)
+        {
+        case RS2_FORMAT_Y8: kernels = resolve_yuy2<RS2_FORMAT_Y8>(isa); break;
+        case RS2_FORMAT_Y16: kernels = resolve_yuy2<RS2_FORMAT_Y16>(isa); break;
+        case RS2_FORMAT_RGB8: kernels = resolve_yuy2<RS2_FORMAT_RGB8>(isa); break;
+        case RS2_FORMAT_RGBA8: kernels = resolve_yuy2<RS2_FORMAT_RGBA8>(isa); break;
+        case RS2_FORMAT_BGR8: kernels = resolve_yuy2<RS2_FORMAT_BGR8>(isa); break;
+        case RS2_FORMAT_BGRA8: kernels = resolve_yuy2<RS2_FORMAT_BGRA8>(isa); break;
+        default: throw invalid_value_exception(to_string() << "Unsupported format for YUY2 conversion " << dst_format);
+        }
+        unpack_pixels(kernels, dst_format, d, s, w * h);
+    }
+
 
     /////////////////////////////
     // UYVY unpacking routines //
     /////////////////////////////
     // This templated function unpacks UYVY into RGB8/RGBA8/BGR8/BGRA8, depending on the compile-time parameter FORMAT.
     // It is expected that all branching outside of the loop control variable will be removed due to constant-folding.
-    template<rs2_format FORMAT> void unpack_uyvy(byte * const d[], const byte * s, int width, int height, int actual_size)
+#if defined __SSSE3__ && ! defined ANDROID
+    template<rs2_format FORMAT> void unpack_uyvy_ssse3(byte * const d[], const byte * s, int n)
     {
-        auto n = width * height;
-        assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
-#ifdef __SSSE3__
         auto src = reinterpret_cast<const __m128i *>(s);
         auto dst = reinterpret_cast<__m128i *>(d[0]);
         for (; n; n -= 16)
@@ -519,7 +609,11 @@ namespace librealsense
                 }
             }
         }
-#else  // Generic code for when SSSE3 is not available.
+    }
+#endif
+
+    template<rs2_format FORMAT> void unpack_uyvy_generic(byte * const d[], const byte * s, int n)
+    {
         auto src = reinterpret_cast<const uint8_t *>(s);
         auto dst = reinterpret_cast<uint8_t *>(d[0]);
         for (; n; n -= 16, src += 32)
@@ -624,7 +718,27 @@ namespace librealsense
                 continue;
             }
         }
+    }
+
+    template<rs2_format FORMAT> unpack_dispatch resolve_uyvy(simd_isa isa)
+    {
+        unpack_dispatch res;
+        res.base = unpack_uyvy_generic<FORMAT>;
+#if defined __SSSE3__ && ! defined ANDROID
+        if (isa >= simd_isa_ssse3)
+            res.base = unpack_uyvy_ssse3<FORMAT>;
 #endif
+        if (isa >= simd_isa_avx512 && (res.simd = get_uyvy_avx512_kernel(FORMAT)))
+            res.simd_block = avx512_block_pixels;
+        else if (isa >= simd_isa_avx2 && (res.simd = get_uyvy_avx2_kernel(FORMAT)))
+            res.simd_block = avx2_block_pixels;
+        return res;
+    }
+
+    template<rs2_format FORMAT> void unpack_uyvy(byte * const d[], const byte * s, int width, int height, int actual_size)
+    {
+        static const unpack_dispatch kernels = resolve_uyvy<FORMAT>(get_simd_isa());
+        unpack_pixels(kernels, FORMAT, d, s, width * height);
     }
 
     void unpack_uyvyc(rs2_format dst_format, rs2_stream dst_stream, byte * const d[], const byte * s, int w, int h, int actual_size)
@@ -649,21 +763,85 @@ namespace librealsense
         }
     }
 
+    void unpack_uyvy(rs2_format dst_format, byte * const d[], const byte * s, int w, int h, simd_isa isa)
+    {
+        unpack_dispatch kernels;
+        switch (dst_format)
+        {
+        case RS2_FORMAT_RGB8: kernels = resolve_uyvy<RS2_FORMAT_RGB8>(isa); break;
+        case RS2_FORMAT_RGBA8: kernels = resolve_uyvy<RS2_FORMAT_RGBA8>(isa); break;
+        case RS2_FORMAT_BGR8: kernels = resolve_uyvy<RS2_FORMAT_BGR8>(isa); break;
+        case RS2_FORMAT_BGRA8: kernels = resolve_uyvy<RS2_FORMAT_BGRA8>(isa); break;
+        default: throw invalid_value_exception(to_string() << "Unsupported format for UYVY conversion " << dst_format);
+        }
+        unpack_pixels(kernels, dst_format, d, s, w * h);
+    }
+
     /////////////////////////////
     // MJPEG unpacking routines //
     /////////////////////////////
-    void unpack_mjpeg(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
+    // JFIF (full range BT.601) conversion. Every pair of pixels keeps the chroma of its first pixel,
+    // the same as the libjpeg-turbo decoder does, and the last pixel of an odd row is written as Y and U
+    static byte rgb_to_y(const byte * rgb) { return static_cast<byte>((19595 * rgb[0] + 38470 * rgb[1] + 7471 * rgb[2] + 32768) >> 16); }
+    static byte rgb_to_u(const byte * rgb) { return static_cast<byte>(clamp_val(128 + ((-11059 * rgb[0] - 21709 * rgb[1] + 32768 * rgb[2] + 32768) >> 16), 0, 255)); }
+    static byte rgb_to_v(const byte * rgb) { return static_cast<byte>(clamp_val(128 + ((32768 * rgb[0] - 27439 * rgb[1] - 5329 * rgb[2] + 32768) >> 16), 0, 255)); }
+
+    void unpack_yuyv_from_rgb(byte * dest, const byte * rgb, int width, int height)
+    {
+        for (auto y = 0; y < height; ++y)
+        {
+            auto x = 0;
+            for (; x + 1 < width; x += 2, rgb += 6, dest += 4)
+            {
+                dest[0] = rgb_to_y(rgb);
+                dest[1] = rgb_to_u(rgb);
+                dest[2] = rgb_to_y(rgb + 3);
+                dest[3] = rgb_to_v(rgb);
+            }
+            if (x < width)
+            {
+                dest[0] = rgb_to_y(rgb);
+                dest[1] = rgb_to_u(rgb);
+                rgb += 3;
+                dest += 2;
+            }
+        }
+    }
+
+    void unpack_mjpeg(rs2_format dst_format, byte * const dest[], const byte * source, int width, int height, int actual_size)
     {
         int w, h, bpp;
-        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, false);
-        if (uncompressed_rgb)
+        auto components = (dst_format == RS2_FORMAT_RGBA8 || dst_format == RS2_FORMAT_BGRA8) ? 4 : 3;
+        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, components);
+        if (!uncompressed_rgb)
+        {
+            LOG_ERROR("jpeg decode failed");
+            return;
+        }
+        if (w != width || h != height)
         {
-            auto uncompressed_size = w * h * bpp;
-            librealsense::copy(dest[0], uncompressed_rgb, uncompressed_size);
+            LOG_ERROR("jpeg decode failed, unexpected image size " << w << "x" << h);
             stbi_image_free(uncompressed_rgb);
+            return;
         }
-        else
-            LOG_ERROR("jpeg decode failed");
+
+        auto count = w * h;
+        switch (dst_format)
+        {
+        case RS2_FORMAT_YUYV:
+            unpack_yuyv_from_rgb(dest[0], uncompressed_rgb, w, h);
+            break;
+        case RS2_FORMAT_BGR8:
+        case RS2_FORMAT_BGRA8:
+            librealsense::copy(dest[0], uncompressed_rgb, count * components);
+            for (auto i = 0; i < count; i++)
+                std::swap(dest[0][i * components], dest[0][i * components + 2]);
+            break;
+        default:
+            librealsense::copy(dest[0], uncompressed_rgb, count * components);
+            break;
+        }
+        stbi_image_free(uncompressed_rgb);
     }
 
     /////////////////////////////
@@ -694,7 +872,13 @@ namespace librealsense
 
     void mjpeg_converter::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+        // The compressed size is known when reported by the backend, the decoders stop at the end of image marker otherwise
+        auto size = input_size > 0 ? input_size : actual_size;
+#ifdef RS2_USE_LIBJPEG_TURBO
+        if (_decoder.decode(_target_format, dest[0], source, size, width, height))
+            return;
+#endif
+        unpack_mjpeg(_target_format, dest, source, width, height, size);
     }
 
     void bgr_to_rgb::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
@@ -4,9 +4,23 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "mjpeg-decoder.h"
 
 namespace librealsense
 {
+    // Instruction sets the YUY2/UYVY unpacking kernels are specialized for, in ascending order
+    enum simd_isa { simd_isa_none, simd_isa_ssse3, simd_isa_avx2, simd_isa_avx512 };
+
+    // Best instruction set of the running CPU, detected once. Kernels missing from the build fall back to the next one.
+    simd_isa get_simd_isa();
+
+    // Unpack using kernels up to the given instruction set, e.g. to compare the different code paths
+    void unpack_yuy2(rs2_format dst_format, byte * const d[], const byte * s, int w, int h, simd_isa isa);
+    void unpack_uyvy(rs2_format dst_format, byte * const d[], const byte * s, int w, int h, simd_isa isa);
+
+    // Decode a JPEG image with stb_image, the fallback of the MJPEG converter when libjpeg-turbo is not available
+    void unpack_mjpeg(rs2_format dst_format, byte * const dest[], const byte * source, int width, int height, int actual_size);
+
     class LRS_EXTENSION_API color_converter : public functional_processing_block
     {
     protected:
@@ -48,6 +62,10 @@ namespace librealsense
         mjpeg_converter(const char* name, rs2_format target_format) :
             color_converter(name, target_format) {};
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+        mjpeg_decoder _decoder;
+#endif
     };
 
     class LRS_EXTENSION_API bgr_to_rgb : public color_converter
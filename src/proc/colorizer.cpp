@@ -242,6 +242,7 @@ namespace librealsense
             auto depth_format = depth.get_profile().format();
             const auto w = depth.get_width(), h = depth.get_height();
             auto rgb_data = reinterpret_cast<uint8_t*>(const_cast<void *>(rgb.get_data()));
+            auto pool = environment::get_instance().get_processing_pool();
             auto coloring_function = [&, this](float data) {
                 auto hist_data = _hist_data[(int)data];
                 auto pixels = (float)_hist_data[MAX_DEPTH - 1];
@@ -251,13 +252,13 @@ namespace librealsense
             if (depth_format == RS2_FORMAT_DISPARITY32)
             {
                 auto depth_data = reinterpret_cast<const float*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
+                update_histogram(_hist_data, depth_data, w, h, *pool);
                 make_rgb_data<float>(depth_data, rgb_data, w, h, coloring_function);
             }
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
+                update_histogram(_hist_data, depth_data, w, h, *pool);
                 make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
             }
         };
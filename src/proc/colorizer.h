@@ -5,6 +5,7 @@
 
 #include <map>
 #include <vector>
+#include "environment.h"
 
 namespace rs2
 {
@@ -127,11 +128,51 @@ namespace librealsense {
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
             auto cm = _maps[_map_index];
-            for (auto i = 0; i < width*height; ++i)
+            auto pool = environment::get_instance().get_processing_pool();
+            pool->parallel_for(0, height, [&](int row_begin, int row_end)
             {
-                auto d = depth_data[i];
-                colorize_pixel(rgb_data, i, cm, d, coloring_func);
-            }
+                for (auto i = row_begin * width; i < row_end * width; ++i)
+                {
+                    auto d = depth_data[i];
+                    colorize_pixel(rgb_data, i, cm, d, coloring_func);
+                }
+            });
+        }
+
+        // Same as update_histogram, with every thread of the pool counting a band of rows into its own histogram
+        template<typename T>
+        void update_histogram(int* hist, const T* depth_data, int w, int h, worker_pool& pool)
+        {
+            const int bands = static_cast<int>(pool.get_threads_count());
+            if (bands == 1)
+                return update_histogram(hist, depth_data, w, h);
+
+            _partial_histograms.resize(size_t(bands) * MAX_DEPTH);
+            auto partials = _partial_histograms.data();
+            pool.parallel_for_chunks(0, bands, bands, [&](int band, int)
+            {
+                auto band_hist = partials + size_t(band) * MAX_DEPTH;
+                memset(band_hist, 0, MAX_DEPTH * sizeof(int));
+                for (auto i = w * (h * band / bands); i < w * (h * (band + 1) / bands); ++i)
+                {
+                    T depth_val = depth_data[i];
+                    int index = static_cast< int >( depth_val );
+                    band_hist[index] += 1;
+                }
+            });
+
+            pool.parallel_for(0, MAX_DEPTH, [&](int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    int sum = 0;
+                    for (auto band = 0; band < bands; ++band)
+                        sum += partials[size_t(band) * MAX_DEPTH + i];
+                    hist[i] = sum;
+                }
+            });
+
+            for (auto i = 2; i < MAX_DEPTH; ++i) hist[i] += hist[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
         }
 
         template<typename T, typename F>
@@ -161,6 +202,7 @@ namespace librealsense {
 
         std::vector<int> _histogram;
         int* _hist_data;
+        std::vector<int> _partial_histograms;
 
         int _preset = 0;
         rs2::stream_profile _target_stream_profile;
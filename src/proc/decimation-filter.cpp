@@ -356,17 +356,33 @@ namespace librealsense
 
     void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
+    {
+        // Every output row depends only on its own N input lines, so the bands are independent
+        auto pool = environment::get_instance().get_processing_pool();
+        pool->parallel_for(0, _real_height, [&](int row_begin, int row_end)
+        {
+            decimate_depth_rows(frame_data_in, frame_data_out, width_in, scale, row_begin, row_end);
+        });
+
+        // Fill-in the padded rows with zeros
+        memset(frame_data_out + size_t(_real_height) * _padded_width, 0,
+            size_t(_padded_height - _real_height) * _padded_width * sizeof(uint16_t));
+    }
+
+    void decimation_filter::decimate_depth_rows(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t scale, int row_begin, int row_end)
     {
         // Use median filtering
         std::vector<uint16_t> working_kernel(_kernel_size);
         auto wk_begin = working_kernel.data();
         auto wk_itr = wk_begin;
         std::vector<uint16_t*> pixel_raws(scale);
-        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in);
+        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in) + width_in * scale * row_begin;
+        frame_data_out += size_t(_padded_width) * row_begin;
 
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            for (int j = row_begin; j < row_end; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
@@ -438,7 +454,7 @@ namespace librealsense
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            for (int j = row_begin; j < row_end; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
@@ -476,13 +492,6 @@ namespace librealsense
                 block_start += width_in * scale;
             }
         }
-
-        // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
-        {
-            for (auto u = 0; u < _padded_width; ++u)
-                *frame_data_out++ = 0;
-        }
     }
 
     void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
@@ -3,6 +3,12 @@
 // Enhancing the input video frame by filling missing data.
 #pragma once
 
+#include "environment.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
 namespace librealsense
 {
     enum holes_filling_types : uint8_t
@@ -56,18 +62,23 @@ namespace librealsense
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
             auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
 
-            T* p = image_data;
-
-            for (int j = 0; j < height; ++j)
+            // Holes are propagated along the rows only, so the rows are independent
+            auto pool = environment::get_instance().get_processing_pool();
+            pool->parallel_for(0, static_cast<int>(height), [&](int row_begin, int row_end)
             {
-                ++p;
-                for (int i = 1; i < width; ++i)
+                T* p = image_data + row_begin * width;
+
+                for (int j = row_begin; j < row_end; ++j)
                 {
-                    if (empty(p))
-                        *p = *(p - 1);
                     ++p;
+                    for (int i = 1; i < width; ++i)
+                    {
+                        if (empty(p))
+                            *p = *(p - 1);
+                        ++p;
+                    }
                 }
-            }
+            });
         }
 
         template<typename T>
@@ -77,13 +88,12 @@ namespace librealsense
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
             auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
 
-            T tmp = 0;
-            T * p = image_data + width;
-            T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            fill_wavefront(width, height, [&](int j, int col_begin, int col_end)
             {
-                ++p;
-                for (int i = 1; i < width; ++i)
+                T tmp = 0;
+                T * p = image_data + j * width + col_begin;
+                T * q = nullptr;
+                for (int i = col_begin; i < col_end; ++i)
                 {
                     if (empty(p))
                     {
@@ -110,7 +120,7 @@ namespace librealsense
 
                     p++;
                 }
-            }
+            });
         }
 
         template<typename T>
@@ -120,13 +130,12 @@ namespace librealsense
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
             auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
 
-            T tmp = 0;
-            T * p = image_data + width;
-            T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            fill_wavefront(width, height, [&](int j, int col_begin, int col_end)
             {
-                ++p;
-                for (int i = 1; i < width; ++i)
+                T tmp = 0;
+                T * p = image_data + j * width + col_begin;
+                T * q = nullptr;
+                for (int i = col_begin; i < col_end; ++i)
                 {
                     if (empty(p))
                     {
@@ -153,9 +162,50 @@ namespace librealsense
 
                     p++;
                 }
-            }
+            });
         }
 
+        // The "around" modes fill the pixels in place, in raster order: a pixel sees the already filled row above
+        // and left neighbour, but the original row below. To keep the single-threaded result, the inner rows
+        // [1, height-1) are handed out one per thread, and a row advances over columns [1, width) in tiles,
+        // starting a tile only once the row above has completed the following one.
+        template<typename F>
+        void fill_wavefront(size_t width, size_t height, F fill_span)
+        {
+            if (height < 3 || width < 2)
+                return;
+
+            const int rows = static_cast<int>(height - 2);
+            const int tiles = static_cast<int>((width - 1 + hf_wavefront_tile - 1) / hf_wavefront_tile);
+            std::unique_ptr<std::atomic<int>[]> done_tiles(new std::atomic<int>[rows]);
+            for (int r = 0; r < rows; ++r)
+                done_tiles[r] = 0;
+
+            auto pool = environment::get_instance().get_processing_pool();
+            pool->parallel_for_chunks(0, rows, rows, [&](int row_begin, int row_end)
+            {
+                for (int r = row_begin; r < row_end; ++r)
+                {
+                    for (int t = 0; t < tiles; ++t)
+                    {
+                        // Rows are handed out in increasing order, so the row above is already being processed
+                        if (r > 0)
+                        {
+                            const int required = std::min(t + 2, tiles);
+                            while (done_tiles[r - 1].load(std::memory_order_acquire) < required)
+                                std::this_thread::yield();
+                        }
+
+                        const int col_begin = 1 + t * hf_wavefront_tile;
+                        fill_span(r + 1, col_begin, std::min(col_begin + hf_wavefront_tile, static_cast<int>(width)));
+                        done_tiles[r].store(t + 1, std::memory_order_release);
+                    }
+                }
+            });
+        }
+
+        static const int hf_wavefront_tile = 64;
+
     private:
 
         size_t                  _width, _height, _stride;
@@ -0,0 +1,393 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "mjpeg-decoder.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+#include "environment.h"
+
+#include <csetjmp>
+#include <cstdio>
+#include <jpeglib.h>
+#endif
+
+namespace librealsense
+{
+    static int read_be16(const byte* p)
+    {
+        return (p[0] << 8) | p[1];
+    }
+
+    // Collects the segments of the entropy-coded data, following the headers
+    static bool find_restart_markers(const byte* jpeg, size_t size, jpeg_restart_layout& layout)
+    {
+        layout.segments.push_back(layout.scan_offset);
+
+        auto p = jpeg + layout.scan_offset;
+        auto end = jpeg + size;
+        while (true)
+        {
+            p = static_cast<const byte*>(memchr(p, 0xFF, end - p));
+            if (!p || p + 1 >= end)
+                return false;
+
+            auto code = p[1];
+            if (code == 0x00) // stuffed 0xFF data byte
+                p += 2;
+            else if (code == 0xFF) // fill byte
+                p += 1;
+            else if (code >= 0xD0 && code <= 0xD7) // RSTn
+            {
+                layout.markers.push_back(p - jpeg);
+                layout.segments.push_back(p - jpeg + 2);
+                p += 2;
+            }
+            else if (code == 0xD9) // EOI
+            {
+                layout.segments.push_back(p - jpeg);
+                break;
+            }
+            else // Tables or another scan
+                return false;
+        }
+
+        // Every segment but the last one holds exactly restart_interval MCUs
+        auto mcus = int64_t(layout.mcus_per_row()) * layout.mcu_rows();
+        return layout.segments_count() == (mcus + layout.restart_interval - 1) / layout.restart_interval;
+    }
+
+    bool parse_jpeg_restart_layout(const byte* jpeg, size_t size, jpeg_restart_layout& layout)
+    {
+        // The vectors keep their storage from frame to frame
+        layout.width = layout.height = 0;
+        layout.restart_interval = 0;
+        layout.segments.clear();
+        layout.markers.clear();
+
+        if (size < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8) // SOI
+            return false;
+
+        int components = 0;
+        size_t pos = 2;
+        while (true)
+        {
+            // Markers may be preceded by any number of fill bytes
+            if (pos >= size || jpeg[pos] != 0xFF)
+                return false;
+            while (pos < size && jpeg[pos] == 0xFF)
+                pos++;
+            if (pos + 3 > size)
+                return false;
+
+            auto marker = jpeg[pos++];
+            auto length = static_cast<size_t>(read_be16(jpeg + pos));
+            if (length < 2 || pos + length > size)
+                return false;
+            auto payload = jpeg + pos + 2;
+
+            switch (marker)
+            {
+            case 0xC0: // SOF0, baseline
+            case 0xC1: // SOF1, extended sequential
+            {
+                if (length < 8)
+                    return false;
+                components = payload[5];
+                if (components < 1 || length < size_t(8 + 3 * components))
+                    return false;
+
+                layout.height_offset = pos + 3;
+                layout.height = read_be16(payload + 1);
+                layout.width = read_be16(payload + 3);
+
+                int h_max = 1, v_max = 1;
+                for (int c = 0; c < components; c++)
+                {
+                    auto sampling = payload[6 + 3 * c + 1];
+                    h_max = std::max(h_max, sampling >> 4);
+                    v_max = std::max(v_max, sampling & 0x0F);
+                }
+                // A single component scan is not interleaved, its MCU is a single block
+                layout.mcu_width = components == 1 ? 8 : 8 * h_max;
+                layout.mcu_height = components == 1 ? 8 : 8 * v_max;
+                break;
+            }
+            case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+            case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+                // Progressive, lossless, hierarchical or arithmetic coded
+                return false;
+            case 0xDD: // DRI
+                if (length < 4)
+                    return false;
+                layout.restart_interval = read_be16(payload);
+                break;
+            case 0xDA: // SOS
+                if (!layout.width || !layout.height || !layout.restart_interval || payload[0] != components)
+                    return false;
+                layout.scan_offset = pos + length;
+                return find_restart_markers(jpeg, size, layout);
+            default:
+                break;
+            }
+            pos += length;
+        }
+    }
+
+    std::vector<int> split_jpeg_bands(const jpeg_restart_layout& layout, int bands)
+    {
+        std::vector<int> starts{ 0 };
+
+        auto rows = layout.mcu_rows();
+        auto per_row = layout.mcus_per_row();
+        auto count = layout.segments_count();
+        bands = std::max(1, std::min(bands, rows));
+        for (int b = 1; b < bands; ++b)
+        {
+            // The first segment starting on a row of MCUs, at the nominal start of the band or past it
+            auto first_mcu = int64_t(rows) * b / bands * per_row;
+            auto k = static_cast<int>((first_mcu + layout.restart_interval - 1) / layout.restart_interval);
+            while (k < count && (int64_t(k) * layout.restart_interval) % per_row)
+                k++;
+            if (k >= count)
+                break;
+            if (k > starts.back())
+                starts.push_back(k);
+        }
+        return starts;
+    }
+
+    int make_jpeg_band(const byte* jpeg, const jpeg_restart_layout& layout, int first, int last, std::vector<byte>& band)
+    {
+        auto count = layout.segments_count();
+        auto per_row = layout.mcus_per_row();
+        auto row_begin = static_cast<int>(int64_t(first) * layout.restart_interval / per_row);
+        auto row_end = last >= count ? layout.mcu_rows() : static_cast<int>(int64_t(last) * layout.restart_interval / per_row);
+        auto height = std::min(row_end * layout.mcu_height, layout.height) - row_begin * layout.mcu_height;
+
+        band.clear();
+        band.insert(band.end(), jpeg, jpeg + layout.scan_offset);
+        band[layout.height_offset] = static_cast<byte>(height >> 8);
+        band[layout.height_offset + 1] = static_cast<byte>(height & 0xFF);
+
+        for (int k = first; k < last; ++k)
+        {
+            auto end = k + 1 < count ? layout.markers[k] : layout.segments[count];
+            band.insert(band.end(), jpeg + layout.segments[k], jpeg + end);
+            // Restart markers count modulo 8 from the beginning of the scan
+            if (k + 1 < last)
+            {
+                band.push_back(0xFF);
+                band.push_back(static_cast<byte>(0xD0 + (k - first) % 8));
+            }
+        }
+        band.push_back(0xFF);
+        band.push_back(0xD9);
+        return height;
+    }
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+    // Rows requested from libjpeg at once
+    static const int jpeg_rows_per_read = 16;
+
+    struct jpeg_error_handler
+    {
+        jpeg_error_mgr mgr;
+        jmp_buf jump;
+    };
+
+    static void on_jpeg_error(j_common_ptr info)
+    {
+        longjmp(reinterpret_cast<jpeg_error_handler*>(info->err)->jump, 1);
+    }
+
+    static void on_jpeg_message(j_common_ptr info)
+    {
+        char message[JMSG_LENGTH_MAX];
+        info->err->format_message(info, message);
+        LOG_DEBUG("MJPEG decoder: " << message);
+    }
+
+    // YCbCr 4:4:4 to YUYV, keeping the chroma of the first pixel of every pair. The last pixel of an odd row
+    // is written as Y and U
+    static void pack_yuyv(byte* dest, const byte* ycc, int width)
+    {
+        int x = 0;
+        for (; x + 1 < width; x += 2, ycc += 6, dest += 4)
+        {
+            dest[0] = ycc[0];
+            dest[1] = ycc[1];
+            dest[2] = ycc[3];
+            dest[3] = ycc[2];
+        }
+        if (x < width)
+        {
+            dest[0] = ycc[0];
+            dest[1] = ycc[1];
+        }
+    }
+
+    struct mjpeg_decoder::band_decoder
+    {
+        jpeg_decompress_struct info;
+        jpeg_error_handler error;
+        std::vector<byte> jpeg;    // Standalone image of the band, when the frame is split
+        std::vector<byte> scratch; // Rows decoded ahead of the YUYV packing, or discarded
+        bool result = false;
+
+        band_decoder()
+        {
+            info.err = jpeg_std_error(&error.mgr);
+            error.mgr.error_exit = on_jpeg_error;
+            error.mgr.output_message = on_jpeg_message;
+            jpeg_create_decompress(&info);
+        }
+
+        ~band_decoder()
+        {
+            jpeg_destroy_decompress(&info);
+        }
+
+        // Decodes an image of width x height, of which the first skip rows are discarded and the following ones written to dest.
+        // No object with a destructor may be alive across the setjmp, the error handler jumps over its frames.
+        bool decode(J_COLOR_SPACE space, bool yuyv, byte* dest, int stride, int width, int height, int skip, int rows,
+            const byte* data, size_t size)
+        {
+            if (setjmp(error.jump))
+            {
+                jpeg_abort_decompress(&info);
+                return false;
+            }
+
+            jpeg_mem_src(&info, const_cast<byte*>(data), static_cast<unsigned long>(size));
+            jpeg_read_header(&info, TRUE);
+            if (info.image_width != JDIMENSION(width) || info.image_height != JDIMENSION(height))
+            {
+                jpeg_abort_decompress(&info);
+                return false;
+            }
+
+            info.out_color_space = space;
+            // Pairs of pixels keep the chroma they were coded with, there is nothing to interpolate for YUYV
+            info.do_fancy_upsampling = yuyv ? FALSE : TRUE;
+            jpeg_start_decompress(&info);
+
+            JSAMPROW output[jpeg_rows_per_read];
+            const JDIMENSION end = skip + rows;
+            while (info.output_scanline < end)
+            {
+                auto first = info.output_scanline;
+                auto discard = first < JDIMENSION(skip);
+                auto count = std::min<JDIMENSION>(jpeg_rows_per_read, (discard ? skip : end) - first);
+                for (JDIMENSION i = 0; i < count; ++i)
+                    output[i] = (discard || yuyv) ? scratch.data() + i * width * 4 : dest + (first + i - skip) * stride;
+
+                auto read = jpeg_read_scanlines(&info, output, count);
+                if (yuyv && !discard)
+                {
+                    for (JDIMENSION i = 0; i < read; ++i)
+                        pack_yuyv(dest + (first + i - skip) * stride, output[i], width);
+                }
+            }
+
+            if (info.output_scanline < info.output_height)
+                jpeg_abort_decompress(&info);
+            else
+                jpeg_finish_decompress(&info);
+            return true;
+        }
+    };
+
+    mjpeg_decoder::mjpeg_decoder() = default;
+    mjpeg_decoder::~mjpeg_decoder() = default;
+
+    mjpeg_decoder::band_decoder& mjpeg_decoder::get_decoder(size_t index)
+    {
+        while (_decoders.size() <= index)
+            _decoders.emplace_back(new band_decoder());
+        return *_decoders[index];
+    }
+
+    bool mjpeg_decoder::decode(rs2_format format, byte* dest, const byte* jpeg, size_t size, int width, int height)
+    {
+        J_COLOR_SPACE space;
+        int bpp;
+        switch (format)
+        {
+        case RS2_FORMAT_RGB8: space = JCS_EXT_RGB; bpp = 3; break;
+        case RS2_FORMAT_BGR8: space = JCS_EXT_BGR; bpp = 3; break;
+        case RS2_FORMAT_RGBA8: space = JCS_EXT_RGBA; bpp = 4; break;
+        case RS2_FORMAT_BGRA8: space = JCS_EXT_BGRA; bpp = 4; break;
+        case RS2_FORMAT_YUYV: space = JCS_YCbCr; bpp = 2; break;
+        default: return false;
+        }
+        auto yuyv = format == RS2_FORMAT_YUYV;
+        auto stride = width * bpp;
+
+        auto pool = environment::get_instance().get_processing_pool();
+        std::vector<int> starts{ 0 };
+        if (pool->get_threads_count() > 1 && parse_jpeg_restart_layout(jpeg, size, _layout)
+            && _layout.width == width && _layout.height == height)
+        {
+            starts = split_jpeg_bands(_layout, static_cast<int>(pool->get_threads_count()));
+        }
+
+        auto& l = _layout;
+        // Vertically subsampled chroma is interpolated with the rows of the neighbouring MCUs, so every band is
+        // decoded together with the rows of MCUs surrounding it, to match the output of a single decoder
+        auto context = (l.mcu_height > 8 && !yuyv) ? 1 : 0;
+        auto segment_at = [&](int row) -> int
+        {
+            if (row <= 0) return 0;
+            if (row >= l.mcu_rows()) return l.segments_count();
+            auto mcu = int64_t(row) * l.mcus_per_row();
+            return mcu % l.restart_interval ? -1 : static_cast<int>(mcu / l.restart_interval);
+        };
+        auto row_of = [&](int segment) -> int
+        {
+            return segment >= l.segments_count() ? l.mcu_rows() : static_cast<int>(int64_t(segment) * l.restart_interval / l.mcus_per_row());
+        };
+        for (size_t b = 1; context && b < starts.size(); ++b)
+        {
+            if (segment_at(row_of(starts[b]) - 1) < 0 || segment_at(row_of(starts[b]) + 1) < 0)
+                starts.assign(1, 0);
+        }
+
+        auto bands = static_cast<int>(starts.size());
+        for (int b = 0; b < bands; ++b)
+            get_decoder(b).scratch.resize(jpeg_rows_per_read * width * 4);
+
+        if (bands == 1)
+            return _decoders[0]->decode(space, yuyv, dest, stride, width, height, 0, height, jpeg, size);
+
+        pool->parallel_for_chunks(0, bands, bands, [&](int begin, int end)
+        {
+            for (int b = begin; b < end; ++b)
+            {
+                auto& d = *_decoders[b];
+                auto row_begin = row_of(starts[b]);
+                auto row_end = b + 1 < bands ? row_of(starts[b + 1]) : l.mcu_rows();
+                auto first = segment_at(row_begin - context);
+                auto last = segment_at(row_end + context);
+
+                auto band_height = make_jpeg_band(jpeg, l, first, last, d.jpeg);
+                auto skip = (row_begin - row_of(first)) * l.mcu_height;
+                auto rows = std::min(row_end * l.mcu_height, height) - row_begin * l.mcu_height;
+                d.result = d.decode(space, yuyv, dest + row_begin * l.mcu_height * stride, stride, width, band_height, skip, rows,
+                    d.jpeg.data(), d.jpeg.size());
+            }
+        });
+
+        for (int b = 0; b < bands; ++b)
+        {
+            // A corrupted segment fails its band only, let the decoder resynchronize over the whole image instead
+            if (!_decoders[b]->result)
+                return _decoders[0]->decode(space, yuyv, dest, stride, width, height, 0, height, jpeg, size);
+        }
+        return true;
+    }
+#endif
+}
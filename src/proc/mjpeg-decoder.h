@@ -0,0 +1,68 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "types.h"
+
+#include <memory>
+#include <vector>
+
+namespace librealsense
+{
+    // Layout of a baseline JPEG image coded with restart markers. The entropy-coded data between two restart
+    // markers (a segment) does not depend on the data preceding it, so that segments starting at the beginning
+    // of a row of MCUs can be decoded as separate images, each holding a horizontal band of the original one.
+    struct jpeg_restart_layout
+    {
+        int width = 0, height = 0;
+        int mcu_width = 0, mcu_height = 0;  // in pixels
+        int restart_interval = 0;           // MCUs per segment, 0 when the image has no restart markers
+        size_t height_offset = 0;           // offset of the image height within the SOF segment
+        size_t scan_offset = 0;             // headers end here, the entropy-coded data starts
+        std::vector<size_t> segments;       // begin of every segment, followed by the offset of the EOI marker
+        std::vector<size_t> markers;        // offset of the restart marker ending every segment but the last
+
+        int mcus_per_row() const { return (width + mcu_width - 1) / mcu_width; }
+        int mcu_rows() const { return (height + mcu_height - 1) / mcu_height; }
+        int segments_count() const { return static_cast<int>(markers.size()) + 1; }
+    };
+
+    // Fills the layout of a single-scan baseline image. Returns false for images that cannot be split - progressive,
+    // multi-scan, without restart markers or malformed.
+    bool parse_jpeg_restart_layout(const byte* jpeg, size_t size, jpeg_restart_layout& layout);
+
+    // Segments, out of 0..segments_count(), each band should start at, so that every band starts on a new row
+    // of MCUs. At most the requested number of bands of nearly equal height are returned.
+    std::vector<int> split_jpeg_bands(const jpeg_restart_layout& layout, int bands);
+
+    // Writes a standalone JPEG image of segments [first, last) - the original headers with the height of the band,
+    // the segments with their restart markers renumbered, and EOI. Returns the height of the band in pixels.
+    int make_jpeg_band(const byte* jpeg, const jpeg_restart_layout& layout, int first, int last, std::vector<byte>& band);
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+    /*
+        libjpeg-turbo based decoder writing the image straight into the frame buffer, in RGB8, BGR8, RGBA8, BGRA8
+        or YUYV. The decompressors are kept from frame to frame. Images coded with restart markers are split into
+        bands that are decoded concurrently on the processing worker pool.
+        Not thread-safe - a decoder serves a single processing block.
+    */
+    class mjpeg_decoder
+    {
+    public:
+        mjpeg_decoder();
+        ~mjpeg_decoder();
+
+        // Returns false when the image could not be decoded into the given dimensions and format
+        bool decode(rs2_format format, byte* dest, const byte* jpeg, size_t size, int width, int height);
+
+    private:
+        struct band_decoder;
+
+        band_decoder& get_decoder(size_t index);
+
+        std::vector<std::unique_ptr<band_decoder>> _decoders;
+        jpeg_restart_layout _layout;
+    };
+#endif
+}
@@ -0,0 +1,267 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "ply-export.h"
+#include "worker-pool.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#define MIN_DISTANCE 1e-6
+
+namespace librealsense
+{
+    namespace
+    {
+        const size_t face_size = sizeof(uint8_t) + 3 * sizeof(int32_t);
+
+        inline float3 cross(const float3& a, const float3& b)
+        {
+            return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+
+        // PLY coordinates are right handed with y up, the camera looks down -z
+        inline float3 flip(const float3& v) { return { v.x, -v.y, -v.z }; }
+
+        inline uint8_t* put(uint8_t* dst, const void* src, size_t size)
+        {
+            memcpy(dst, src, size);
+            return dst + size;
+        }
+
+        class organized_cloud
+        {
+        public:
+            organized_cloud(int width, int height, const float3* vertices, const std::vector<int32_t>& index, float threshold)
+                : _width(width), _height(height), _vertices(vertices), _index(index), _threshold(threshold) {}
+
+            // Whether the quad with the top-left corner (x, y) is split into two faces
+            bool is_face(int x, int y) const
+            {
+                if (x < 0 || y < 0 || x >= _width - 1 || y >= _height - 1)
+                    return false;
+
+                auto a = y * _width + x, b = a + 1, c = a + _width, d = c + 1;
+                auto za = _vertices[a].z, zb = _vertices[b].z, zc = _vertices[c].z, zd = _vertices[d].z;
+                return za && zb && zc && zd
+                    && std::fabs(za - zb) < _threshold && std::fabs(za - zc) < _threshold
+                    && std::fabs(zb - zd) < _threshold && std::fabs(zc - zd) < _threshold
+                    && _index[a] >= 0 && _index[b] >= 0 && _index[c] >= 0 && _index[d] >= 0;
+            }
+
+            // The two faces of a quad are (a, d, b) and (d, a, c). The normal of a vertex is the sum of the normals
+            // of the faces it belongs to - gathered from the four quads around it rather than scattered from every
+            // face, so that rows can be processed in parallel
+            float3 normal(int x, int y) const
+            {
+                float3 sum = { 0, 0, 0 };
+                if (is_face(x, y))          sum = sum + first_face_normal(x, y) + second_face_normal(x, y);     // a
+                if (is_face(x - 1, y))      sum = sum + first_face_normal(x - 1, y);                            // b
+                if (is_face(x, y - 1))      sum = sum + second_face_normal(x, y - 1);                           // c
+                if (is_face(x - 1, y - 1))  sum = sum + first_face_normal(x - 1, y - 1) + second_face_normal(x - 1, y - 1); // d
+
+                auto length = std::sqrt(sum.x * sum.x + sum.y * sum.y + sum.z * sum.z);
+                return length > 0 ? sum * (1 / length) : sum;
+            }
+
+        private:
+            float3 point(int x, int y) const { return flip(_vertices[y * _width + x]); }
+
+            float3 first_face_normal(int x, int y) const
+            {
+                auto a = point(x, y), b = point(x + 1, y), d = point(x + 1, y + 1);
+                return cross(d - a, b - a);
+            }
+
+            float3 second_face_normal(int x, int y) const
+            {
+                auto a = point(x, y), c = point(x, y + 1), d = point(x + 1, y + 1);
+                return cross(c - a, d - a);
+            }
+
+            int _width, _height;
+            const float3* _vertices;
+            const std::vector<int32_t>& _index;
+            float _threshold;
+        };
+
+        template<class T>
+        void for_rows(worker_pool* pool, int rows, const T& task)
+        {
+            if (pool)
+                pool->parallel_for(0, rows, task);
+            else
+                task(0, rows);
+        }
+    }
+
+    std::vector<uint8_t> serialize_ply(int width, int height, const float3* vertices, const float2* texcoords,
+                                       const ply_texture* texture, const ply_export_options& options, worker_pool* pool)
+    {
+        const bool use_color = texture && texcoords;
+        const bool use_normals = options.mesh && options.normals;
+        if (use_color && texture->bytes_per_pixel < 3)
+            throw invalid_value_exception("texture must have at least 3 bytes per pixel");
+
+        // Position of every vertex in the file, -1 for the dropped ones
+        const int count = width * height;
+        std::vector<int32_t> index(count);
+        int32_t vertex_count = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            auto& v = vertices[i];
+            index[i] = (std::fabs(v.x) >= MIN_DISTANCE || std::fabs(v.y) >= MIN_DISTANCE || std::fabs(v.z) >= MIN_DISTANCE) ? vertex_count++ : -1;
+        }
+
+        organized_cloud cloud(width, height, vertices, index, options.threshold);
+
+        // Faces of every band of rows, kept by its first row and concatenated in raster order
+        const int quad_rows = options.mesh ? std::max(height - 1, 0) : 0;
+        std::vector<std::vector<int32_t>> band_faces(quad_rows + 1);
+        for_rows(pool, quad_rows, [&](int begin, int end)
+        {
+            auto& faces = band_faces[begin];
+            for (int y = begin; y < end; ++y)
+            {
+                for (int x = 0; x < width - 1; ++x)
+                {
+                    if (!cloud.is_face(x, y))
+                        continue;
+
+                    auto a = index[y * width + x], b = index[y * width + x + 1];
+                    auto c = index[(y + 1) * width + x], d = index[(y + 1) * width + x + 1];
+                    int32_t two_faces[] = { a, d, b, d, a, c };
+                    faces.insert(faces.end(), std::begin(two_faces), std::end(two_faces));
+                }
+            }
+        });
+
+        std::vector<size_t> band_offset(quad_rows + 1, 0);
+        size_t face_count = 0;
+        for (int i = 0; i < quad_rows; ++i)
+        {
+            band_offset[i] = face_count;
+            face_count += band_faces[i].size() / 3;
+        }
+
+        std::ostringstream header;
+        header << "ply\n";
+        header << "format binary_little_endian 1.0\n";
+        header << "comment pointcloud saved from Realsense Viewer\n";
+        header << "element vertex " << vertex_count << "\n";
+        header << "property float" << sizeof(float) * 8 << " x\n";
+        header << "property float" << sizeof(float) * 8 << " y\n";
+        header << "property float" << sizeof(float) * 8 << " z\n";
+        if (use_normals)
+        {
+            header << "property float" << sizeof(float) * 8 << " nx\n";
+            header << "property float" << sizeof(float) * 8 << " ny\n";
+            header << "property float" << sizeof(float) * 8 << " nz\n";
+        }
+        if (use_color)
+        {
+            header << "property uchar red\n";
+            header << "property uchar green\n";
+            header << "property uchar blue\n";
+        }
+        if (options.mesh)
+        {
+            header << "element face " << face_count << "\n";
+            header << "property list uchar int vertex_indices\n";
+        }
+        header << "end_header\n";
+        auto header_str = header.str();
+
+        const size_t vertex_size = sizeof(float3) + (use_normals ? sizeof(float3) : 0) + (use_color ? 3 : 0);
+        const size_t vertices_offset = header_str.size();
+        const size_t faces_offset = vertices_offset + vertex_count * vertex_size;
+        std::vector<uint8_t> ply(faces_offset + face_count * face_size);
+        memcpy(ply.data(), header_str.data(), header_str.size());
+
+        // Vertices - the write position of every row is known from the flat index
+        for_rows(pool, height, [&](int begin, int end)
+        {
+            for (int y = begin; y < end; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    auto i = y * width + x;
+                    if (index[i] < 0)
+                        continue;
+
+                    auto dst = ply.data() + vertices_offset + index[i] * vertex_size;
+                    auto v = flip(vertices[i]);
+                    dst = put(dst, &v, sizeof(v)); // we assume little endian architecture on your device
+                    if (use_normals)
+                    {
+                        auto n = cloud.normal(x, y);
+                        dst = put(dst, &n, sizeof(n));
+                    }
+                    if (use_color)
+                    {
+                        int u = std::min(std::max(int(texcoords[i].x * texture->width + .5f), 0), texture->width - 1);
+                        int t = std::min(std::max(int(texcoords[i].y * texture->height + .5f), 0), texture->height - 1);
+                        put(dst, texture->data + t * texture->stride + u * texture->bytes_per_pixel, 3);
+                    }
+                }
+            }
+        });
+
+        for_rows(pool, quad_rows, [&](int begin, int end)
+        {
+            for (int band = begin; band < end; ++band)
+            {
+                auto& faces = band_faces[band];
+                auto dst = ply.data() + faces_offset + band_offset[band] * face_size;
+                for (size_t f = 0; f < faces.size(); f += 3)
+                {
+                    *dst++ = 3;
+                    dst = put(dst, &faces[f], 3 * sizeof(int32_t));
+                }
+            }
+        });
+
+        return ply;
+    }
+
+    void write_ply(const std::string& fname, const std::vector<uint8_t>& ply)
+    {
+        std::ofstream out(fname, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        if (!out)
+            throw io_exception("failed to open " + fname + " for writing");
+        out.write(reinterpret_cast<const char*>(ply.data()), ply.size());
+        if (!out)
+            throw io_exception("failed to write " + fname);
+    }
+
+    void write_ply(int fd, const std::vector<uint8_t>& ply)
+    {
+        size_t written = 0;
+        while (written < ply.size())
+        {
+#ifdef _WIN32
+            auto chunk = static_cast<unsigned>(std::min<size_t>(ply.size() - written, 1 << 30));
+            auto res = _write(fd, ply.data() + written, chunk);
+#else
+            auto res = ::write(fd, ply.data() + written, ply.size() - written);
+#endif
+            if (res < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw io_exception(to_string() << "failed to write the point cloud to file descriptor " << fd << ", errno " << errno);
+            }
+            written += res;
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../types.h"
+
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    class worker_pool;
+
+    struct ply_export_options
+    {
+        bool mesh = true;           // Triangulate neighbouring vertices of similar depth into faces
+        bool normals = false;       // Per-vertex normals, averaged over the adjacent faces (only with the mesh)
+        float threshold = 0.05f;    // Maximal depth difference, in meters, between the corners of a face
+    };
+
+    // RGB source for the vertex colors, sampled at the texture coordinates of every vertex
+    struct ply_texture
+    {
+        const uint8_t* data;
+        int width, height;
+        int bytes_per_pixel;        // At least 3, the first three bytes of a pixel are written
+        int stride;
+    };
+
+    /*
+        Serializes an organized point cloud - width x height vertices in raster order, with zero depth where
+        there was none - as a binary little endian PLY, header included, into a single buffer. Vertices at the
+        origin are dropped and the faces refer to the remaining ones. The vertices are re-indexed through a flat
+        table, and with a pool, bands of rows are triangulated and serialized in parallel. The output does not
+        depend on the number of threads.
+    */
+    std::vector<uint8_t> serialize_ply(int width, int height, const float3* vertices, const float2* texcoords,
+                                       const ply_texture* texture, const ply_export_options& options,
+                                       worker_pool* pool = nullptr);
+
+    void write_ply(const std::string& fname, const std::vector<uint8_t>& ply);
+
+    // Writes to an open file descriptor (a file, pipe or socket), which is left open
+    void write_ply(int fd, const std::vector<uint8_t>& ply);
+}
@@ -10,6 +10,7 @@
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
 #include "proc/spatial-filter.h"
+#include "proc/sse/sse-spatial-filter.h"
 
 namespace librealsense
 {
@@ -226,21 +227,57 @@ namespace librealsense
         return tgt;
     }
 
+    // Rows/columns handed to a thread at a time, a multiple of the widest SIMD kernel
+    const int spatial_simd_block = 16;
+
     void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
     {
-        float *image = reinterpret_cast<float*>(image_data);
+        auto image = reinterpret_cast<float*>(image_data);
+        const auto isa = get_simd_isa();
+        const int blocks = int(_height + spatial_simd_block - 1) / spatial_simd_block;
+
+        auto pool = environment::get_instance().get_processing_pool();
+        pool->parallel_for(0, blocks, [&](int block_begin, int block_end)
+        {
+            spatial_filter_horizontal_fp(image, int(_width), block_begin * spatial_simd_block,
+                std::min(block_end * spatial_simd_block, int(_height)), alpha, deltaZ, isa);
+        });
+    }
+
+    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    {
+        auto image = reinterpret_cast<float*>(image_data);
+        const auto isa = get_simd_isa();
+        const int blocks = int(_width + spatial_simd_block - 1) / spatial_simd_block;
+
+        auto pool = environment::get_instance().get_processing_pool();
+        pool->parallel_for(0, blocks, [&](int block_begin, int block_end)
+        {
+            spatial_filter_vertical_fp(image, int(_width), int(_height), block_begin * spatial_simd_block,
+                std::min(block_end * spatial_simd_block, int(_width)), alpha, deltaZ, isa);
+        });
+    }
+
+    void spatial_filter_horizontal_fp(float* image, int width, int row_begin, int row_end, float alpha, float deltaZ, simd_isa isa)
+    {
+        // The vectorized kernels filter groups of rows, the remaining ones are filtered one by one below
+        if (isa >= simd_isa_avx2)
+            if (auto kernel = get_spatial_horizontal_avx2())
+                row_begin += kernel(image + row_begin * width, width, row_end - row_begin, alpha, deltaZ);
+        if (isa >= simd_isa_ssse3)
+            row_begin += spatial_horizontal_sse(image + row_begin * width, width, row_end - row_begin, alpha, deltaZ);
 
         int v, u;
 
-        for (v = 0; v < _height;) {
+        for (v = row_begin; v < row_end;) {
             // left to right
-            float *im = image + v * _width;
+            float *im = image + v * width;
             float state = *im;
             float previousInnovation = state;
 
             im++;
             float innovation = *im;
-            u = int(_width) - 1;
+            u = width - 1;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidLR;
             // else fall through
@@ -295,9 +332,9 @@ namespace librealsense
         DoneLR:
 
             // right to left
-            im = image + (v + 1) * _width - 2;  // end of row - two pixels
+            im = image + (v + 1) * width - 2;  // end of row - two pixels
             previousInnovation = state = im[1];
-            u = int(_width) - 1;
+            u = width - 1;
             innovation = *im;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidRL;
@@ -354,22 +391,27 @@ namespace librealsense
         }
     }
 
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter_vertical_fp(float* image, int width, int height, int col_begin, int col_end, float alpha, float deltaZ, simd_isa isa)
     {
-        float *image = reinterpret_cast<float*>(image_data);
+        // The vectorized kernels filter groups of adjacent columns, the remaining ones are filtered one by one below
+        if (isa >= simd_isa_avx2)
+            if (auto kernel = get_spatial_vertical_avx2())
+                col_begin += kernel(image + col_begin, width, height, col_end - col_begin, alpha, deltaZ);
+        if (isa >= simd_isa_ssse3)
+            col_begin += spatial_vertical_sse(image + col_begin, width, height, col_end - col_begin, alpha, deltaZ);
 
         int v, u;
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
 
-        for (u = 0; u < _width;) {
+        for (u = col_begin; u < col_end;) {
 
             float *im = image + u;
             float state = im[0];
             float previousInnovation = state;
 
-            v = int(_height) - 1;
-            im += _width;
+            v = height - 1;
+            im += width;
             float innovation = *im;
 
             if (!(*(int*)&previousInnovation > 0))
@@ -393,7 +435,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneTB;
                     previousInnovation = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                 }
                 else {  // switch to CurrentlyInvalid state
@@ -401,7 +443,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneTB;
                     previousInnovation = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                     goto CurrentlyInvalidTB;
                 }
@@ -414,22 +456,22 @@ namespace librealsense
                     goto DoneTB;
                 if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
                     previousInnovation = state = innovation;
-                    im += _width;
+                    im += width;
                     innovation = *im;
                     goto CurrentlyValidTB;
                 }
                 else {
-                    im += _width;
+                    im += width;
                     innovation = *im;
                 }
             }
         DoneTB:
 
-            im = image + u + (_height - 2) * _width;
-            state = im[_width];
+            im = image + u + (height - 2) * width;
+            state = im[width];
             previousInnovation = state;
             innovation = *im;
-            v = int(_height) - 1;
+            v = height - 1;
             if (!(*(int*)&previousInnovation > 0))
                 goto CurrentlyInvalidBT;
             // else fall through
@@ -450,7 +492,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneBT;
                     previousInnovation = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                 }
                 else {  // switch to CurrentlyInvalid state
@@ -458,7 +500,7 @@ namespace librealsense
                     if (v <= 0)
                         goto DoneBT;
                     previousInnovation = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                     goto CurrentlyInvalidBT;
                 }
@@ -471,12 +513,12 @@ namespace librealsense
                     goto DoneBT;
                 if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
                     previousInnovation = state = innovation;
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                     goto CurrentlyValidBT;
                 }
                 else {
-                    im -= _width;
+                    im -= width;
                     innovation = *im;
                 }
             }
@@ -9,12 +9,20 @@
 #include <map>
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
+#include "proc/color-formats-converter.h"
+#include "environment.h"
 
 namespace librealsense
 {
+    // Recursive filter passes over disparity data - rows [row_begin, row_end) left to right and back, or columns
+    // [col_begin, col_end) top to bottom and back. The result is identical for every instruction set.
+    void spatial_filter_horizontal_fp(float* image, int width, int row_begin, int row_end, float alpha, float delta_z, simd_isa isa);
+    void spatial_filter_vertical_fp(float* image, int width, int height, int col_begin, int col_end, float alpha, float delta_z, simd_isa isa);
+
     class spatial_filter : public depth_processing_block
     {
     public:
@@ -32,6 +40,8 @@ namespace librealsense
             static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
             bool fp = (std::is_floating_point<T>::value);
 
+            // Rows are independent in the horizontal pass, and columns in the vertical one
+            auto pool = environment::get_instance().get_processing_pool();
             for (int i = 0; i < iterations; i++)
             {
                 if (fp)
@@ -41,8 +51,16 @@ namespace librealsense
                 }
                 else
                 {
-                    recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
+                    pool->parallel_for(0, int(_height), [&](int row_begin, int row_end)
+                    {
+                        recursive_filter_horizontal<T>(frame_data, alpha, delta, row_begin, row_end);
+                    });
+                    const int col_blocks = int(_width + spatial_vertical_block - 1) / spatial_vertical_block;
+                    pool->parallel_for(0, col_blocks, [&](int block_begin, int block_end)
+                    {
+                        recursive_filter_vertical<T>(frame_data, alpha, delta, block_begin * spatial_vertical_block,
+                            std::min(block_end * spatial_vertical_block, int(_width)));
+                    });
                 }
             }
 
@@ -56,7 +74,7 @@ namespace librealsense
         void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
 
         template <typename T>
-        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
+        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ, int row_begin, int row_end)
         {
             size_t v{}, u{};
 
@@ -72,7 +90,7 @@ namespace librealsense
             auto image = reinterpret_cast<T*>(image_data);
             size_t cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            for (v = row_begin; v < row_end; v++)
             {
                 // left to right
                 T *im = image + v * _width;
@@ -151,7 +169,7 @@ namespace librealsense
         }
 
         template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
+        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ, int col_begin, int col_end)
         {
             size_t v{}, u{};
 
@@ -170,12 +188,13 @@ namespace librealsense
 
             // top to bottom
 
-            T *im = image;
+            T *im = nullptr;
             T im0{};
             T imw{};
             for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (v - 1) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -194,10 +213,10 @@ namespace librealsense
             }
 
             // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
+            for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (_height - 1 - v) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -223,46 +242,54 @@ namespace librealsense
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
             auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
 
-            size_t cur_fill = 0;
-
-            T* p = image_data;
-            for (int j = 0; j < _height; ++j)
+            // Holes are filled along the rows only
+            auto pool = environment::get_instance().get_processing_pool();
+            pool->parallel_for(0, int(_height), [&](int row_begin, int row_end)
             {
-                ++p;
-                cur_fill = 0;
+                size_t cur_fill = 0;
 
-                //Left to Right
-                for (size_t i = 1; i < _width; ++i)
+                T* p = image_data + row_begin * _width;
+                for (int j = row_begin; j < row_end; ++j)
                 {
-                    if (empty(p))
-                    {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p - 1);
-                    }
-                    else
-                        cur_fill = 0;
-
                     ++p;
-                }
+                    cur_fill = 0;
 
-                --p;
-                cur_fill = 0;
-                //Right to left
-                for (size_t i = 1; i < _width; ++i)
-                {
-                    if (empty(p))
+                    //Left to Right
+                    for (size_t i = 1; i < _width; ++i)
                     {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p + 1);
+                        if (empty(p))
+                        {
+                            if (++cur_fill < _holes_filling_radius)
+                                *p = *(p - 1);
+                        }
+                        else
+                            cur_fill = 0;
+
+                        ++p;
                     }
-                    else
-                        cur_fill = 0;
+
                     --p;
+                    cur_fill = 0;
+                    //Right to left
+                    for (size_t i = 1; i < _width; ++i)
+                    {
+                        if (empty(p))
+                        {
+                            if (++cur_fill < _holes_filling_radius)
+                                *p = *(p + 1);
+                        }
+                        else
+                            cur_fill = 0;
+                        --p;
+                    }
+                    p += _width;
                 }
-                p += _width;
-            }
+            });
         }
 
+        // The vertical pass is split into bands of whole cache lines, so that threads do not write into the same line
+        static const int spatial_vertical_block = 32;
+
     private:
 
         float                   _spatial_alpha_param;
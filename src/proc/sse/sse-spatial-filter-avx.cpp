@@ -0,0 +1,86 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+#include "sse-spatial-filter-impl.h"
+
+namespace librealsense
+{
+    namespace
+    {
+        struct avx2_vec
+        {
+            typedef __m256 vec;
+            enum { lanes = 8 };
+
+            static vec loadu(const float* p) { return _mm256_loadu_ps(p); }
+            static void storeu(float* p, vec x) { _mm256_storeu_ps(p, x); }
+            static vec set1(float x) { return _mm256_set1_ps(x); }
+            static vec add(vec a, vec b) { return _mm256_add_ps(a, b); }
+            static vec sub(vec a, vec b) { return _mm256_sub_ps(a, b); }
+            static vec mul(vec a, vec b) { return _mm256_mul_ps(a, b); }
+            static vec and_(vec a, vec b) { return _mm256_and_ps(a, b); }
+            static vec select(vec mask, vec a, vec b) { return _mm256_blendv_ps(b, a, mask); }
+            static vec lt(vec a, vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static vec gt(vec a, vec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+            static vec valid(vec x) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_castps_si256(x), _mm256_setzero_si256())); }
+
+            static void transpose(vec* t)
+            {
+                auto t0 = _mm256_unpacklo_ps(t[0], t[1]);
+                auto t1 = _mm256_unpackhi_ps(t[0], t[1]);
+                auto t2 = _mm256_unpacklo_ps(t[2], t[3]);
+                auto t3 = _mm256_unpackhi_ps(t[2], t[3]);
+                auto t4 = _mm256_unpacklo_ps(t[4], t[5]);
+                auto t5 = _mm256_unpackhi_ps(t[4], t[5]);
+                auto t6 = _mm256_unpacklo_ps(t[6], t[7]);
+                auto t7 = _mm256_unpackhi_ps(t[6], t[7]);
+
+                auto s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                auto s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                auto s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                auto s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+                auto s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+                auto s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+                auto s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+                auto s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+                t[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+                t[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+                t[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+                t[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+                t[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+                t[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+                t[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+                t[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+            }
+        };
+
+        int spatial_horizontal_avx2(float* image, int width, int rows, float alpha, float delta_z)
+        {
+            return spatial_horizontal<avx2_vec>(image, width, rows, alpha, delta_z);
+        }
+
+        int spatial_vertical_avx2(float* image, int width, int height, int cols, float alpha, float delta_z)
+        {
+            return spatial_vertical<avx2_vec>(image, width, height, cols, alpha, delta_z);
+        }
+    }
+
+    spatial_horizontal_kernel get_spatial_horizontal_avx2() { return spatial_horizontal_avx2; }
+    spatial_vertical_kernel get_spatial_vertical_avx2() { return spatial_vertical_avx2; }
+}
+
+#else
+
+namespace librealsense
+{
+    spatial_horizontal_kernel get_spatial_horizontal_avx2() { return nullptr; }
+    spatial_vertical_kernel get_spatial_vertical_avx2() { return nullptr; }
+}
+
+#endif
@@ -0,0 +1,170 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+#pragma once
+
+// Vector-width agnostic implementation of the spatial filter passes, instantiated by sse-spatial-filter.cpp
+// and sse-spatial-filter-avx.cpp with their respective vector traits (V):
+//   V::vec, V::lanes, loadu, storeu, set1, add, sub, mul, and_, select(mask, a, b), lt, gt,
+//   valid (positive when reinterpreted as int, same as the scalar code) and transpose (of lanes x lanes vectors).
+// No standard library templates are used - anything instantiated here is compiled with the TU's instruction set.
+
+namespace librealsense
+{
+    namespace
+    {
+        template<class V>
+        struct spatial_params
+        {
+            typename V::vec alpha, one_minus_alpha, delta_z, neg_delta_z;
+
+            spatial_params(float a, float dz)
+                : alpha(V::set1(a)), one_minus_alpha(V::set1(1.0f - a)), delta_z(V::set1(dz)), neg_delta_z(V::set1(-dz))
+            {}
+        };
+
+        template<class V>
+        struct spatial_state
+        {
+            typename V::vec state, prev, prev_valid;
+
+            void reset(typename V::vec x)
+            {
+                state = prev = x;
+                prev_valid = V::valid(x);
+            }
+
+            // One step of the recursion - the filtered value replaces the input when both the input and its
+            // predecessor are valid and close enough, otherwise a valid input restarts the recursion
+            typename V::vec step(typename V::vec x, const spatial_params<V>& p)
+            {
+                auto valid = V::valid(x);
+                auto delta = V::sub(prev, x);
+                auto small_difference = V::and_(V::lt(delta, p.delta_z), V::gt(delta, p.neg_delta_z));
+                auto filtered = V::add(V::mul(x, p.alpha), V::mul(state, p.one_minus_alpha));
+                auto out = V::select(V::and_(V::and_(valid, prev_valid), small_difference), filtered, x);
+
+                state = V::select(valid, out, state);
+                prev = x;
+                prev_valid = valid;
+                return out;
+            }
+        };
+
+        template<class V>
+        inline typename V::vec load_column(const float* image, int width, int col)
+        {
+            float values[V::lanes];
+            for (int k = 0; k < V::lanes; ++k)
+                values[k] = image[k * width + col];
+            return V::loadu(values);
+        }
+
+        template<class V>
+        inline void store_column(float* image, int width, int col, typename V::vec x)
+        {
+            float values[V::lanes];
+            V::storeu(values, x);
+            for (int k = 0; k < V::lanes; ++k)
+                image[k * width + col] = values[k];
+        }
+
+        // Filters groups of V::lanes rows: tiles of lanes x lanes pixels are transposed so that every vector
+        // holds one column of the group, and the recursion advances a column per step
+        template<class V>
+        int spatial_horizontal(float* image, int width, int rows, float alpha, float delta_z)
+        {
+            const int L = V::lanes;
+            if (width < 2)
+                return 0;
+
+            const spatial_params<V> p(alpha, delta_z);
+            spatial_state<V> s;
+            typename V::vec t[V::lanes];
+
+            int r = 0;
+            for (; r + L <= rows; r += L)
+            {
+                float* im = image + r * width;
+
+                // left to right
+                s.reset(load_column<V>(im, width, 0));
+                int u = 1;
+                for (; u + L <= width; u += L)
+                {
+                    for (int k = 0; k < L; ++k)
+                        t[k] = V::loadu(im + k * width + u);
+                    V::transpose(t);
+                    for (int k = 0; k < L; ++k)
+                        t[k] = s.step(t[k], p);
+                    V::transpose(t);
+                    for (int k = 0; k < L; ++k)
+                        V::storeu(im + k * width + u, t[k]);
+                }
+                for (; u < width; ++u)
+                    store_column<V>(im, width, u, s.step(load_column<V>(im, width, u), p));
+
+                // right to left
+                s.reset(load_column<V>(im, width, width - 1));
+                u = width - 2;
+                for (; u - L + 1 >= 0; u -= L)
+                {
+                    for (int k = 0; k < L; ++k)
+                        t[k] = V::loadu(im + k * width + u - L + 1);
+                    V::transpose(t);
+                    for (int k = L - 1; k >= 0; --k)
+                        t[k] = s.step(t[k], p);
+                    V::transpose(t);
+                    for (int k = 0; k < L; ++k)
+                        V::storeu(im + k * width + u - L + 1, t[k]);
+                }
+                for (; u >= 0; --u)
+                    store_column<V>(im, width, u, s.step(load_column<V>(im, width, u), p));
+            }
+            return r;
+        }
+
+        // N adjacent vectors are filtered together, so that every row access consumes whole cache lines
+        template<class V, int N>
+        void spatial_vertical_block(float* image, int width, int height, const spatial_params<V>& p)
+        {
+            spatial_state<V> s[N];
+
+            // top to bottom
+            for (int n = 0; n < N; ++n)
+                s[n].reset(V::loadu(image + n * V::lanes));
+            for (int v = 1; v < height; ++v)
+            {
+                float* im = image + v * width;
+                for (int n = 0; n < N; ++n)
+                    V::storeu(im + n * V::lanes, s[n].step(V::loadu(im + n * V::lanes), p));
+            }
+
+            // bottom to top
+            for (int n = 0; n < N; ++n)
+                s[n].reset(V::loadu(image + (height - 1) * width + n * V::lanes));
+            for (int v = height - 2; v >= 0; --v)
+            {
+                float* im = image + v * width;
+                for (int n = 0; n < N; ++n)
+                    V::storeu(im + n * V::lanes, s[n].step(V::loadu(im + n * V::lanes), p));
+            }
+        }
+
+        template<class V>
+        int spatial_vertical(float* image, int width, int height, int cols, float alpha, float delta_z)
+        {
+            const int L = V::lanes;
+            const int N = 16 / V::lanes;
+            if (height < 2)
+                return 0;
+
+            const spatial_params<V> p(alpha, delta_z);
+            int c = 0;
+            for (; c + L * N <= cols; c += L * N)
+                spatial_vertical_block<V, 16 / V::lanes>(image + c, width, height, p);
+            for (; c + L <= cols; c += L)
+                spatial_vertical_block<V, 1>(image + c, width, height, p);
+            return c;
+        }
+    }
+}
@@ -0,0 +1,55 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+
+#ifdef __SSSE3__
+
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#include "sse-spatial-filter-impl.h"
+
+namespace librealsense
+{
+    namespace
+    {
+        struct sse_vec
+        {
+            typedef __m128 vec;
+            enum { lanes = 4 };
+
+            static vec loadu(const float* p) { return _mm_loadu_ps(p); }
+            static void storeu(float* p, vec x) { _mm_storeu_ps(p, x); }
+            static vec set1(float x) { return _mm_set1_ps(x); }
+            static vec add(vec a, vec b) { return _mm_add_ps(a, b); }
+            static vec sub(vec a, vec b) { return _mm_sub_ps(a, b); }
+            static vec mul(vec a, vec b) { return _mm_mul_ps(a, b); }
+            static vec and_(vec a, vec b) { return _mm_and_ps(a, b); }
+            static vec select(vec mask, vec a, vec b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+            static vec lt(vec a, vec b) { return _mm_cmplt_ps(a, b); }
+            static vec gt(vec a, vec b) { return _mm_cmpgt_ps(a, b); }
+            static vec valid(vec x) { return _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_castps_si128(x), _mm_setzero_si128())); }
+            static void transpose(vec* t) { _MM_TRANSPOSE4_PS(t[0], t[1], t[2], t[3]); }
+        };
+    }
+
+    int spatial_horizontal_sse(float* image, int width, int rows, float alpha, float delta_z)
+    {
+        return spatial_horizontal<sse_vec>(image, width, rows, alpha, delta_z);
+    }
+
+    int spatial_vertical_sse(float* image, int width, int height, int cols, float alpha, float delta_z)
+    {
+        return spatial_vertical<sse_vec>(image, width, height, cols, alpha, delta_z);
+    }
+}
+
+#else
+
+namespace librealsense
+{
+    int spatial_horizontal_sse(float* image, int width, int rows, float alpha, float delta_z) { return 0; }
+    int spatial_vertical_sse(float* image, int width, int height, int cols, float alpha, float delta_z) { return 0; }
+}
+
+#endif
@@ -0,0 +1,23 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+#pragma once
+
+// Only plain declarations are included here, see image-avx.h for the reason
+
+namespace librealsense
+{
+    // Recursive edge-preserving passes of the spatial filter over disparity data, vectorized across
+    // independent rows (horizontal pass) or columns (vertical pass). Both passes filter in place the leading
+    // rows/columns of the given range, and return how many were handled - a multiple of the vector width.
+    // The remainder is left to the scalar implementation.
+    typedef int(*spatial_horizontal_kernel)(float* image, int width, int rows, float alpha, float delta_z);
+    typedef int(*spatial_vertical_kernel)(float* image, int width, int height, int cols, float alpha, float delta_z);
+
+    // image points to the first pixel of the range, the stride is always width
+    int spatial_horizontal_sse(float* image, int width, int rows, float alpha, float delta_z);
+    int spatial_vertical_sse(float* image, int width, int height, int cols, float alpha, float delta_z);
+
+    // nullptr when the library was built without AVX2
+    spatial_horizontal_kernel get_spatial_horizontal_avx2();
+    spatial_vertical_kernel get_spatial_vertical_avx2();
+}
@@ -9,6 +9,8 @@
 #include "stream.h"
 #include "types.h"
 
+#include <future>
+
 namespace librealsense
 {
     void processing_block::set_processing_callback(frame_processor_callback_ptr callback)
@@ -22,6 +24,13 @@ namespace librealsense
         _source.set_callback(callback);
     }
 
+    void processing_block::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        // Wait for the frame being processed, if any
+        std::lock_guard<std::mutex> lock(_mutex);
+        _source.set_frame_allocator(allocator);
+    }
+
     processing_block::processing_block(const char* name) :
         _source_wrapper(_source)
     {
@@ -494,6 +503,20 @@ namespace librealsense
         processing_block(name)
     {}
 
+    composite_processing_block::~composite_processing_block()
+    {
+        // The workers refer to the processing blocks, so they are stopped first.
+        // Frames still waiting in their queues are dropped.
+        std::vector<std::shared_ptr<dispatcher>> stages;
+        {
+            std::lock_guard<std::mutex> lock(_stages_mutex);
+            std::swap(stages, _stages);
+        }
+        stages.clear();
+
+        _source.flush();
+    }
+
     processing_block & composite_processing_block::get(rs2_option option)
     {
         // Find the first block which supports the option.
@@ -534,7 +557,7 @@ namespace librealsense
         for (i = 1; i < _processing_blocks.size(); i++)
         {
             auto output_cb = [i, this](frame_holder fh) {
-                _processing_blocks[i]->invoke(std::move(fh));
+                forward(i, std::move(fh));
             };
             _processing_blocks[i - 1]->set_output_callback(std::make_shared<internal_frame_callback<decltype(output_cb)>>(output_cb));
         }
@@ -543,11 +566,83 @@ namespace librealsense
         _processing_blocks.back()->set_output_callback(callback);
     }
 
+    void composite_processing_block::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        for (auto&& pb : _processing_blocks)
+            pb->set_frame_allocator(allocator);
+        processing_block::set_frame_allocator(allocator);
+    }
+
     void composite_processing_block::invoke(frame_holder frames)
     {
+        // In pipelined mode frames enter the chain one at a time, which lets set_pipelined drain it
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!is_pipelined())
+            lock.unlock();
+
         // Invoke the first processing block.
         // This will trigger processing the frame in a chain by the order of the given processing blocks vector.
-        _processing_blocks.front()->invoke(std::move(frames));
+        forward(0, std::move(frames));
+    }
+
+    void composite_processing_block::forward(size_t i, frame_holder frames)
+    {
+        std::shared_ptr<dispatcher> stage;
+        {
+            std::lock_guard<std::mutex> lock(_stages_mutex);
+            if (i < _stages.size())
+                stage = _stages[i];
+        }
+
+        if (!stage)
+        {
+            _processing_blocks[i]->invoke(std::move(frames));
+            return;
+        }
+
+        // frame_holder is not copyable, while the dispatcher queue holds std::function objects
+        auto pf = std::make_shared<frame_holder>(std::move(frames));
+        auto block = _processing_blocks[i];
+        // Blocking, so that no frame is dropped between the blocks - a slow block holds back the ones preceding it
+        stage->invoke([block, pf](dispatcher::cancellable_timer t)
+        {
+            block->invoke(std::move(*pf));
+        }, true);
+    }
+
+    void composite_processing_block::set_pipelined(bool pipelined, unsigned int queue_size)
+    {
+        // _stages is only modified here, under _mutex, and no new frame enters the chain meanwhile
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Let the frames already handed to the workers reach the output, block by block, so that they keep their order
+        for (auto&& stage : _stages)
+        {
+            std::promise<void> drained;
+            auto done = drained.get_future();
+            stage->invoke([&](dispatcher::cancellable_timer t) { drained.set_value(); }, true);
+            done.wait();
+        }
+
+        std::vector<std::shared_ptr<dispatcher>> stages;
+        if (pipelined)
+        {
+            for (size_t i = 0; i < _processing_blocks.size(); i++)
+            {
+                auto stage = std::make_shared<dispatcher>(std::max(queue_size, 1u));
+                stage->start();
+                stages.push_back(stage);
+            }
+        }
+
+        std::lock_guard<std::mutex> stages_lock(_stages_mutex);
+        std::swap(stages, _stages);
+    }
+
+    bool composite_processing_block::is_pipelined() const
+    {
+        std::lock_guard<std::mutex> lock(_stages_mutex);
+        return !_stages.empty();
     }
 
     interleaved_functional_processing_block::interleaved_functional_processing_block(const char* name,
@@ -6,6 +6,7 @@
 #include "core/processing.h"
 #include "image.h"
 #include "source.h"
+#include "concurrency.h"
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
@@ -54,6 +55,7 @@ namespace librealsense
         void set_output_callback(frame_callback_ptr callback) override;
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
 
         virtual ~processing_block() { _source.flush(); }
     protected:
@@ -206,6 +208,9 @@ namespace librealsense
 
     // Sequential chained processing blocks
     // The order of the processing blocks defines the execution flow.
+    // By default the whole chain runs on the invoking thread. In pipelined mode every block runs on a worker
+    // of its own, fed through a bounded queue, so that consecutive frames are processed by different blocks
+    // concurrently. Each block still sees the frames one at a time and in their original order.
     class LRS_EXTENSION_API composite_processing_block : public processing_block
     {
     public:
@@ -245,15 +250,28 @@ namespace librealsense
 
         composite_processing_block();
         composite_processing_block(const char* name);
-        virtual ~composite_processing_block() { _source.flush(); };
+        virtual ~composite_processing_block();
 
         processing_block& get(rs2_option option);
         void add(std::shared_ptr<processing_block> block);
         void set_output_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         void invoke(frame_holder frames) override;
 
+        // Frames already handed to the workers are processed before switching back to the sequential mode.
+        // queue_size is the number of frames each block may have waiting for it - invoke blocks when the queue
+        // of the first block is full, and so does every block on the one following it.
+        void set_pipelined(bool pipelined, unsigned int queue_size = 2);
+        bool is_pipelined() const;
+
     protected:
+        // Hands the frame over to the i-th processing block
+        void forward(size_t i, frame_holder frames);
+
         std::vector<std::shared_ptr<processing_block>> _processing_blocks;
+
+        mutable std::mutex _stages_mutex;
+        std::vector<std::shared_ptr<dispatcher>> _stages;
     };
 }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "types.h"
+#include "environment.h"
 
 namespace librealsense
 {
@@ -33,8 +34,21 @@ namespace librealsense
 
             unsigned char mask = 1 << _cur_frame_index;
 
+            // Pixels are filtered independently of each other, so the frame is processed in bands of rows
+            auto pool = environment::get_instance().get_processing_pool();
+            pool->parallel_for(0, static_cast<int>(_height), [&](int row_begin, int row_end)
+            {
+                temp_jw_smooth_pixels(frame, _last_frame, history, mask, delta_z, row_begin * _width, row_end * _width);
+            });
+
+            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+        }
+
+        template<typename T>
+        void temp_jw_smooth_pixels(T* frame, T* _last_frame, uint8_t *history, unsigned char mask, T delta_z, size_t begin, size_t end)
+        {
             // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
+            for (size_t i = begin; i < end; i++)
             {
                 T cur_val = frame[i];
                 T prev_val = _last_frame[i];
@@ -79,8 +93,6 @@ namespace librealsense
                     history[i] &= ~mask;
                 }
             }
-
-            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
 
     private:
@@ -0,0 +1,180 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "worker-pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace librealsense
+{
+    // Every thread gets a few ranges so that a band that happens to be slower does not stall the others
+    static const int ranges_per_thread = 4;
+
+    worker_pool::worker_pool(unsigned threads)
+        : _alive(true)
+    {
+        for (unsigned i = 1; i < threads; ++i)
+            _workers.emplace_back([this]() { worker(); });
+    }
+
+    worker_pool::~worker_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _alive = false;
+        }
+        _cv.notify_all();
+
+        for (auto&& t : _workers)
+            t.join();
+    }
+
+    void worker_pool::parallel_for(int begin, int end, const range_task& task, int min_grain)
+    {
+        if (end <= begin)
+            return;
+
+        auto count = end - begin;
+        auto threads = static_cast<int>(get_threads_count());
+        auto grain = std::max(std::max(min_grain, 1), (count + threads * ranges_per_thread - 1) / (threads * ranges_per_thread));
+        parallel_for_chunks(begin, end, (count + grain - 1) / grain, task);
+    }
+
+    void worker_pool::parallel_for_chunks(int begin, int end, int chunks, const range_task& task)
+    {
+        if (end <= begin)
+            return;
+
+        chunks = std::max(1, std::min(chunks, end - begin));
+        if (chunks == 1 || _workers.empty())
+        {
+            // Nothing to share - keep the per-range semantics but skip the synchronization
+            for (int i = 0; i < chunks; ++i)
+                task(begin + static_cast<int>(int64_t(end - begin) * i / chunks),
+                     begin + static_cast<int>(int64_t(end - begin) * (i + 1) / chunks));
+            return;
+        }
+
+        auto j = std::make_shared<job>();
+        j->task = &task;
+        j->begin = begin;
+        j->end = end;
+        j->chunks = chunks;
+        j->next = 0;
+        j->pending = chunks;
+        run(j);
+    }
+
+    void worker_pool::run(const std::shared_ptr<job>& j)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _jobs.push_back(j);
+        }
+        _cv.notify_all();
+
+        execute(*j);
+
+        {
+            std::unique_lock<std::mutex> lock(j->mtx);
+            j->done_cv.wait(lock, [&]() { return j->pending == 0; });
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            auto it = std::find(_jobs.begin(), _jobs.end(), j);
+            if (it != _jobs.end())
+                _jobs.erase(it);
+        }
+
+        if (j->error)
+            std::rethrow_exception(j->error);
+    }
+
+    void worker_pool::execute(job& j)
+    {
+        const int64_t count = j.end - j.begin;
+        for (int i = j.next++; i < j.chunks; i = j.next++)
+        {
+            try
+            {
+                (*j.task)(j.begin + static_cast<int>(count * i / j.chunks), j.begin + static_cast<int>(count * (i + 1) / j.chunks));
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(j.mtx);
+                if (!j.error)
+                    j.error = std::current_exception();
+            }
+
+            if (--j.pending == 0)
+            {
+                std::lock_guard<std::mutex> lock(j.mtx);
+                j.done_cv.notify_all();
+            }
+        }
+    }
+
+    void worker_pool::worker()
+    {
+        while (true)
+        {
+            std::shared_ptr<job> j;
+            {
+                std::unique_lock<std::mutex> lock(_mtx);
+                _cv.wait(lock, [&]() { return !_alive || !_jobs.empty(); });
+                if (!_alive)
+                    return;
+
+                j = _jobs.front();
+                // All the ranges were already handed out, the job only waits for its last ranges to complete
+                if (j->next >= j->chunks)
+                {
+                    _jobs.pop_front();
+                    continue;
+                }
+            }
+            execute(*j);
+        }
+    }
+
+    unsigned worker_pool::get_physical_cores()
+    {
+        unsigned cores = 0;
+#ifdef _WIN32
+        DWORD len = 0;
+        GetLogicalProcessorInformation(nullptr, &len);
+        std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(len / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+        if (len && GetLogicalProcessorInformation(info.data(), &len))
+        {
+            for (auto&& i : info)
+                if (i.Relationship == RelationProcessorCore)
+                    ++cores;
+        }
+#elif defined(__linux__)
+        // Hyper-threads share the same (package, core) pair
+        std::set<std::pair<int, int>> ids;
+        for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); ++cpu)
+        {
+            auto topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+            std::ifstream package(topology + "physical_package_id"), core(topology + "core_id");
+            int package_id = 0, core_id = 0;
+            if (package >> package_id && core >> core_id)
+                ids.insert({ package_id, core_id });
+        }
+        cores = static_cast<unsigned>(ids.size());
+#endif
+        if (!cores)
+            cores = std::thread::hardware_concurrency();
+        return std::max(cores, 1u);
+    }
+}
@@ -0,0 +1,71 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace librealsense
+{
+    /*
+        Library-owned pool of worker threads used by the processing blocks to split a frame into bands of rows.
+        The calling thread takes part in the work, so a pool of N threads runs N-1 background workers, and a
+        pool of a single thread executes everything inline. parallel_for may be called concurrently from
+        several processing blocks - the bands of all pending calls are shared between the workers.
+    */
+    class worker_pool
+    {
+    public:
+        // Invoked with a [begin, end) sub-range of the requested range
+        typedef std::function<void(int, int)> range_task;
+
+        explicit worker_pool(unsigned threads);
+        ~worker_pool();
+
+        worker_pool(const worker_pool&) = delete;
+        worker_pool& operator=(const worker_pool&) = delete;
+
+        // Total number of threads taking part in a parallel_for, including the caller
+        unsigned get_threads_count() const { return static_cast<unsigned>(_workers.size()) + 1; }
+
+        // Splits [begin, end) into ranges of at least min_grain items and blocks until all of them were processed.
+        // Ranges are handed out in increasing order. The first exception thrown by a task is rethrown to the caller.
+        void parallel_for(int begin, int end, const range_task& task, int min_grain = 1);
+
+        // Same as above, with the range split into exactly the given number of (nearly equal) ranges,
+        // for tasks that keep per-range state
+        void parallel_for_chunks(int begin, int end, int chunks, const range_task& task);
+
+        static unsigned get_physical_cores();
+
+    private:
+        struct job
+        {
+            const range_task* task;
+            int begin, end, chunks;
+            std::atomic<int> next;
+            std::atomic<int> pending;
+            std::mutex mtx;
+            std::condition_variable done_cv;
+            std::exception_ptr error;
+        };
+
+        void run(const std::shared_ptr<job>& j);
+        void execute(job& j);
+        void worker();
+
+        std::mutex _mtx;
+        std::condition_variable _cv;
+        std::deque<std::shared_ptr<job>> _jobs;
+        bool _alive;
+        std::vector<std::thread> _workers;
+    };
+}
@@ -668,6 +668,33 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_notification, user)
 
+librealsense::frame_allocator_ptr make_frame_allocator(rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user)
+{
+    if (!on_allocate && !on_deallocate)
+        return nullptr;
+    if (!on_allocate || !on_deallocate)
+        throw librealsense::invalid_value_exception("on_allocate and on_deallocate must be provided together");
+    return { new librealsense::frame_allocator(on_allocate, on_deallocate, user),
+        [](rs2_frame_allocator* p) { delete p; } };
+}
+
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    sensor->sensor->set_frame_allocator(make_frame_allocator(on_allocate, on_deallocate, user));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_allocate, on_deallocate, user)
+
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    librealsense::frame_allocator_ptr ptr;
+    if (allocator)
+        ptr = { allocator, [](rs2_frame_allocator* p) { p->release(); } };
+    sensor->sensor->set_frame_allocator(ptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocator)
+
 void rs2_software_device_set_destruction_callback(const rs2_device* dev, rs2_software_device_destruction_callback_ptr on_destruction, void* user, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(dev);
@@ -747,6 +774,20 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
+int rs2_get_frame_metadata_all(const rs2_frame* frame, rs2_frame_metadata_value* attributes, rs2_metadata_type* values, int capacity, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    if (capacity < 0)
+        throw librealsense::invalid_value_exception("capacity must not be negative");
+    if (capacity > 0)
+    {
+        VALIDATE_NOT_NULL(attributes);
+        VALIDATE_NOT_NULL(values);
+    }
+    return ((frame_interface*)frame)->get_all_frame_metadata(attributes, values, capacity);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, attributes, values, capacity)
+
 const char* rs2_get_notification_description(rs2_notification* notification, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(notification);
@@ -1487,6 +1528,37 @@ void rs2_playback_device_stop(const rs2_device* device, rs2_error** error) BEGIN
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+unsigned long long int rs2_playback_get_frames_count(const rs2_device* device, const rs2_stream_profile* profile, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->get_frames_count(*profile->profile);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile)
+
+rs2_frame* rs2_playback_get_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int index, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    auto fh = playback->get_frame(*profile->profile, static_cast<size_t>(index));
+
+    frame_interface* result = nullptr;
+    std::swap(result, fh.frame);
+    return (rs2_frame*)result;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, profile, index)
+
+unsigned long long int rs2_playback_find_frame(const rs2_device* device, const rs2_stream_profile* profile, unsigned long long int frame_number, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(profile);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->find_frame(*profile->profile, frame_number);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, profile, frame_number)
+
 rs2_device* rs2_create_record_device(const rs2_device* device, const char* file, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1918,6 +1990,23 @@ void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_p
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, on_frame, user)
 
+void rs2_processing_block_set_frame_allocator(rs2_processing_block* block, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    block->block->set_frame_allocator(make_frame_allocator(on_allocate, on_deallocate, user));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, on_allocate, on_deallocate, user)
+
+void rs2_processing_block_set_frame_allocator_cpp(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    librealsense::frame_allocator_ptr ptr;
+    if (allocator)
+        ptr = { allocator, [](rs2_frame_allocator* p) { p->release(); } };
+    block->block->set_frame_allocator(ptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, allocator)
+
 void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* queue, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
@@ -2002,6 +2091,40 @@ void rs2_export_to_ply(const rs2_frame* frame, const char* fname, rs2_frame* tex
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, frame, fname)
 
+static ply_export_options make_ply_export_options(int flags, float threshold)
+{
+    if (flags & ~(RS2_PLY_EXPORT_MESH | RS2_PLY_EXPORT_NORMALS | RS2_PLY_EXPORT_PARALLEL))
+        throw invalid_value_exception(to_string() << "invalid ply export flags " << flags);
+    if (!(threshold >= 0))
+        throw invalid_value_exception(to_string() << "invalid ply mesh threshold " << threshold);
+
+    ply_export_options options;
+    options.mesh = (flags & RS2_PLY_EXPORT_MESH) != 0;
+    options.normals = (flags & RS2_PLY_EXPORT_NORMALS) != 0;
+    options.threshold = threshold;
+    return options;
+}
+
+void rs2_export_to_ply_ex(const rs2_frame* frame, const char* fname, rs2_frame* texture, int flags, float threshold, rs2_error** error) BEGIN_API_CALL
+{
+    frame_holder tex((frame_interface*)texture);
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(fname);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    points->export_to_ply(fname, tex, make_ply_export_options(flags, threshold), (flags & RS2_PLY_EXPORT_PARALLEL) != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, frame, fname, texture, flags, threshold)
+
+void rs2_export_to_ply_fd(const rs2_frame* frame, int fd, rs2_frame* texture, int flags, float threshold, rs2_error** error) BEGIN_API_CALL
+{
+    frame_holder tex((frame_interface*)texture);
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_RANGE(fd, 0, std::numeric_limits<int>::max());
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    points->export_to_ply(fd, tex, make_ply_export_options(flags, threshold), (flags & RS2_PLY_EXPORT_PARALLEL) != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, frame, fd, texture, flags, threshold)
+
 rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -2127,6 +2250,26 @@ rs2_processing_block* rs2_create_huffman_depth_decompress_block(rs2_error** erro
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_processing_chain(rs2_processing_block** blocks, int count, int pipelined, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(blocks);
+    VALIDATE_RANGE(count, 1, std::numeric_limits<int>::max());
+
+    auto chain = std::make_shared<librealsense::composite_processing_block>("Processing Chain");
+    for (int i = 0; i < count; i++)
+    {
+        VALIDATE_NOT_NULL(blocks[i]);
+        auto block = std::dynamic_pointer_cast<librealsense::processing_block>(blocks[i]->block);
+        if (!block)
+            throw std::runtime_error("Processing block cannot be chained!");
+        chain->add(block);
+    }
+    chain->set_pipelined(pipelined != 0);
+
+    return new rs2_processing_block{ chain };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, blocks, count, pipelined)
+
 float rs2_get_depth_scale(rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -2299,6 +2442,19 @@ void rs2_software_sensor_set_metadata(rs2_sensor* sensor, rs2_frame_metadata_val
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, key, value)
 
+void rs2_software_sensor_set_metadata_block(rs2_sensor* sensor, const rs2_frame_metadata_value* keys, const rs2_metadata_type* values, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(keys);
+    VALIDATE_NOT_NULL(values);
+    VALIDATE_RANGE(count, 0, std::numeric_limits<int>::max());
+    auto bs = VALIDATE_INTERFACE(sensor->sensor, librealsense::software_sensor);
+    for (int i = 0; i < count; ++i)
+        VALIDATE_ENUM(keys[i]);
+    bs->set_metadata(keys, values, count);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, keys, values, count)
+
 rs2_stream_profile* rs2_software_sensor_add_video_stream(rs2_sensor* sensor, rs2_video_stream video_stream, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -2414,6 +2570,18 @@ void rs2_log(rs2_log_severity severity, const char * message, rs2_error ** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, severity, message)
 
+void rs2_set_processing_threads(int threads, rs2_error ** error) BEGIN_API_CALL
+{
+    environment::get_instance().set_processing_threads(threads);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, threads)
+
+int rs2_get_processing_threads(rs2_error ** error) BEGIN_API_CALL
+{
+    return environment::get_instance().get_processing_threads();
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(0)
+
 void rs2_loopback_enable(const rs2_device* device, const char* from_file, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2962,3 +3130,12 @@ void rs2_load_json(rs2_device* dev, const void* json_content, unsigned content_s
     serializable->load_json(std::string(static_cast<const char*>(json_content), content_size));
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, dev, json_content, content_size)
+
+void rs2_get_global_time_stats(const rs2_device* device, rs2_global_time_stats* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(stats);
+    auto global_timer = VALIDATE_INTERFACE(device->device, librealsense::global_time_interface);
+    *stats = global_timer->get_global_time_stats();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stats)
@@ -72,6 +72,14 @@ namespace librealsense
         _notifications_processor->set_callback(std::move(callback));
     }
 
+    void sensor_base::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        if (is_streaming())
+            throw wrong_api_call_sequence_exception("set_frame_allocator(...) failed. Sensor is streaming!");
+        _frame_allocator = allocator;
+        _source.set_frame_allocator(allocator);
+    }
+
     notifications_callback_ptr sensor_base::get_notifications_callback() const
     {
         return _notifications_processor->get_callback();
@@ -119,11 +127,11 @@ namespace librealsense
 
     void sensor_base::register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const
     {
-        if (_metadata_parsers.get()->end() != _metadata_parsers.get()->find(metadata))
+        if (_metadata_parsers->contains(metadata))
             throw invalid_value_exception(to_string() << "Metadata attribute parser for " << rs2_frame_metadata_to_string(metadata)
                 << " is already defined");
 
-        _metadata_parsers.get()->insert(std::pair<rs2_frame_metadata_value, std::shared_ptr<md_attribute_parser_base>>(metadata, metadata_parser));
+        (*_metadata_parsers)[metadata] = metadata_parser;
     }
 
     std::shared_ptr<std::map<uint32_t, rs2_format>>& sensor_base::get_fourcc_to_rs2_format_map()
@@ -247,9 +255,9 @@ namespace librealsense
     {
         auto system_time = environment::get_instance().get_time_service()->get_time();
         auto fr = std::make_shared<frame>();
-        byte* pix = (byte*)fo.pixels;
-        std::vector<byte> pixels(pix, pix + fo.frame_size);
-        fr->data = pixels;
+        // The frame is only used to parse timestamps and metadata while the backend buffer is still valid,
+        // so it may reference the pixels instead of copying them
+        fr->external_data = external_frame_buffer((byte*)fo.pixels, fo.frame_size, frame_continuation());
         fr->set_stream(profile);
 
         // generate additional data
@@ -294,6 +302,23 @@ namespace librealsense
         }
     }
 
+    bool uvc_sensor::can_borrow_backend_buffer(rs2_format format, int borrowed_buffers) const
+    {
+#ifdef ZERO_COPY
+        // Backends that recycle the buffer as soon as the callback returns cannot lend it
+        if (!_device->defers_buffer_requeue())
+            return false;
+        // Frames in user memory, or that are converted anyway, gain nothing from borrowing
+        if (_frame_allocator || !val_in_range(format, { RS2_FORMAT_Z16, RS2_FORMAT_Y8, RS2_FORMAT_Y16 }))
+            return false;
+        // Leave the backend enough buffers to keep streaming while the user holds on to frames,
+        // past that point frames fall back to being copied
+        return borrowed_buffers < max_borrowed_backend_buffers;
+#else
+        return false;
+#endif
+    }
+
     void uvc_sensor::open(const stream_profiles& requests)
     {
         std::lock_guard<std::mutex> lock(_configure_lock);
@@ -316,12 +341,12 @@ namespace librealsense
             {
                 unsigned long long last_frame_number = 0;
                 rs2_time_t last_timestamp = 0;
+                auto borrowed_buffers = std::make_shared<std::atomic<int>>(0);
                 _device->probe_and_commit(req_profile_base->get_backend_profile(),
-                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp, borrowed_buffers](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
                 {
                     const auto&& system_time = environment::get_instance().get_time_service()->get_time();
                     const auto&& fr = generate_frame_from_data(f, _timestamp_reader.get(), last_timestamp, last_frame_number, req_profile_base);
-                    const auto&& requires_processing = true; // TODO - Ariel add option
                     const auto&& timestamp_domain = _timestamp_reader->get_frame_timestamp_domain(fr);
                     const auto&& bpp = get_image_bpp(req_profile_base->get_format());
                     auto&& frame_counter = fr->additional_data.frame_number;
@@ -354,10 +379,14 @@ namespace librealsense
                     int width = vsp ? vsp->get_width() : 0;
                     int height = vsp ? vsp->get_height() : 0;
 
-                    frame_holder fh = _source.alloc_frame(stream_to_frame_types(req_profile_base->get_stream_type()), width * height * bpp / 8, fr->additional_data, requires_processing);
+                    const auto&& frame_size = width * height * bpp / 8;
+                    const auto&& requires_processing = !(f.frame_size >= frame_size &&
+                        can_borrow_backend_buffer(req_profile_base->get_format(), *borrowed_buffers));
+                    frame_holder fh = _source.alloc_frame(stream_to_frame_types(req_profile_base->get_stream_type()), frame_size, fr->additional_data, requires_processing);
                     if (fh.frame)
                     {
-                        memcpy((void*)fh->get_frame_data(), fr->data.data(), sizeof(byte)*fr->data.size());
+                        if (requires_processing)
+                            memcpy((void*)fh->get_frame_data(), fr->get_frame_data(), sizeof(byte)*fr->get_frame_data_size());
                         auto&& video = (video_frame*)fh.frame;
                         video->assign(width, height, width * bpp / 8, bpp);
                         video->set_timestamp_domain(timestamp_domain);
@@ -371,7 +400,14 @@ namespace librealsense
 
                     if (!requires_processing)
                     {
-                        fh->attach_continuation(std::move(release_and_enqueue));
+                        // Hand the backend buffer over to the frame, it is re-queued once the frame is released
+                        ++(*borrowed_buffers);
+                        frame_continuation release_and_count([borrowed_buffers, continuation]() {
+                            --(*borrowed_buffers);
+                            continuation();
+                        }, f.pixels);
+                        release_and_enqueue.reset();
+                        ((frame*)fh.frame)->external_data = external_frame_buffer((byte*)f.pixels, frame_size, std::move(release_and_count));
                     }
 
                     if (fh->get_stream().get())
@@ -828,12 +864,12 @@ namespace librealsense
             last_frame_number = frame_counter;
             last_timestamp = timestamp;
             frame_holder frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, fr->additional_data, true);
-            memcpy((void*)frame->get_frame_data(), fr->data.data(), sizeof(byte)*fr->data.size());
             if (!frame)
             {
                 LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
                 return;
             }
+            memcpy((void*)frame->get_frame_data(), fr->get_frame_data(), sizeof(byte)*fr->get_frame_data_size());
             frame->set_stream(request);
             frame->set_timestamp_domain(timestamp_domain);
             _source.invoke_callback(std::move(frame));
@@ -1319,6 +1355,8 @@ namespace librealsense
             // Retrieve source profile from cached map and generate the relevant processing block.
             std::unordered_set<std::shared_ptr<stream_profile_interface>> current_resolved_reqs;
             auto best_pb = best_pbf->generate();
+            if (_frame_allocator)
+                best_pb->set_frame_allocator(_frame_allocator);
             register_processing_block_options(*best_pb);
             for (auto&& req : best_reqs)
             {
@@ -1517,6 +1555,13 @@ namespace librealsense
         _post_process_callback = callback;
     }
 
+    void synthetic_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        // Formats delivered as-is come from the raw sensor, the rest from the conversion blocks created on open
+        sensor_base::set_frame_allocator(allocator);
+        _raw_sensor->set_frame_allocator(allocator);
+    }
+
     void synthetic_sensor::register_notifications_callback(notifications_callback_ptr callback)
     {
         sensor_base::register_notifications_callback(callback);
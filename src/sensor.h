@@ -61,6 +61,7 @@ namespace librealsense
         virtual std::shared_ptr<notifications_processor> get_notifications_processor() const;
         virtual frame_callback_ptr get_frames_callback() const override;
         virtual void set_frames_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         bool is_streaming() const override;
         virtual bool is_opened() const;
         virtual void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const;
@@ -105,6 +106,7 @@ namespace librealsense
         std::shared_ptr<notifications_processor> _notifications_processor;
         on_open _on_open;
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
+        frame_allocator_ptr _frame_allocator;
 
         sensor_base* _source_owner;
         frame_source _source;
@@ -216,6 +218,7 @@ namespace librealsense
         std::shared_ptr<sensor_base> get_raw_sensor() const { return _raw_sensor; };
         frame_callback_ptr get_frames_callback() const override;
         void set_frames_callback(frame_callback_ptr callback) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         void register_notifications_callback(notifications_callback_ptr callback) override;
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
@@ -351,9 +354,13 @@ namespace librealsense
         rs2_extension stream_to_frame_types(rs2_stream stream) const;
 
     private:
+        // Number of backend buffers a stream may lend to frames before falling back to copying
+        static const int max_borrowed_backend_buffers = DEFAULT_V4L2_FRAME_BUFFERS - 2;
+
         void acquire_power();
         void release_power();
         void reset_streaming();
+        bool can_borrow_backend_buffer(rs2_format format, int borrowed_buffers) const;
 
         struct power
         {
@@ -252,6 +252,12 @@ namespace librealsense
         _metadata_map[key] = value;
     }
 
+    void software_sensor::set_metadata(const rs2_frame_metadata_value* keys, const rs2_metadata_type* values, int count)
+    {
+        for (int i = 0; i < count; ++i)
+            _metadata_map[keys[i]] = values[i];
+    }
+
     void software_sensor::on_video_frame(rs2_software_video_frame software_frame)
     {
         if (!_is_streaming) {
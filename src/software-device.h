@@ -113,6 +113,7 @@ namespace librealsense
         void update_read_only_option(rs2_option option, float val);
         void add_option(rs2_option option, option_range range, bool is_writable);
         void set_metadata(rs2_frame_metadata_value key, rs2_metadata_type value);
+        void set_metadata(const rs2_frame_metadata_value* keys, const rs2_metadata_type* values, int count);
     private:
         friend class software_device;
         stream_profiles _profiles;
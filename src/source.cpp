@@ -41,6 +41,12 @@ namespace librealsense
         return std::make_shared<frame_queue_size>(&_max_publish_list_size, option_range{ 0, 32, 1, 16 });
     }
 
+    // Frame types whose data is only ever accessed through get_frame_data(), and thus can live in user memory
+    static bool supports_frame_allocator(rs2_extension type)
+    {
+        return type == RS2_EXTENSION_VIDEO_FRAME || type == RS2_EXTENSION_DEPTH_FRAME || type == RS2_EXTENSION_DISPARITY_FRAME;
+    }
+
     frame_source::frame_source(uint32_t max_publish_list_size)
             : _callback(nullptr, [](rs2_frame_callback*) {}),
               _max_publish_list_size(max_publish_list_size),
@@ -62,6 +68,8 @@ namespace librealsense
         for (auto type : supported)
         {
             _archive[type] = make_archive(type, &_max_publish_list_size, _ts, metadata_parsers);
+            if (_allocator && supports_frame_allocator(type))
+                _archive[type]->set_frame_allocator(_allocator);
         }
 
         _metadata_parsers = metadata_parsers;
@@ -91,6 +99,17 @@ namespace librealsense
         return it->second->alloc_and_track(size, additional_data, requires_memory);
     }
 
+    void frame_source::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        _allocator = allocator;
+        for (auto&& a : _archive)
+        {
+            if (a.second && supports_frame_allocator(a.first))
+                a.second->set_frame_allocator(_allocator);
+        }
+    }
+
     void frame_source::set_sensor(const std::shared_ptr<sensor_interface>& s)
     {
         for (auto&& a : _archive)
@@ -47,6 +47,9 @@ namespace librealsense
             _archive[ex] = std::make_shared<frame_archive<T>>(&_max_publish_list_size, _ts, _metadata_parsers);
         }
 
+        // Route the image buffers of video frames to a user allocator (nullptr for the default)
+        void set_frame_allocator(frame_allocator_ptr allocator);
+
         void set_max_publish_list_size(int qsize) {_max_publish_list_size = qsize; }
 
     private:
@@ -60,5 +63,6 @@ namespace librealsense
         frame_callback_ptr _callback;
         std::shared_ptr<platform::time_service> _ts;
         std::shared_ptr<metadata_parser_map> _metadata_parsers;
+        frame_allocator_ptr _allocator;
     };
 }
@@ -84,6 +84,8 @@ enum log_level {
 static const int MAX_TRANSFER_SIZE = 848 * 800 + sizeof(bulk_message_video_stream); // max size on ENDPOINT_HOST_IN
 static const int USB_TIMEOUT = 10000/*ms*/;
 static const int BUFFER_SIZE = 1024; // Max size for control transfers
+static const int DEFAULT_USB_REQUEST_COUNT = 4; // Reads in flight on the interrupt and stream endpoints
+static const int MAX_USB_REQUEST_COUNT = 32;
 
 const std::map<PixelFormat, rs2_format> tm2_formats_map =
 {
@@ -357,12 +359,21 @@ namespace librealsense
     };
 
     tm2_sensor::tm2_sensor(tm2_device* owner)
-        : sensor_base("Tracking Module", owner, this), _device(owner)
+        : sensor_base("Tracking Module", owner, this), _device(owner),
+        _interrupt_ring([this](platform::rs_usb_request r) { _device->submit_request(r); }, [this](platform::rs_usb_request r) { return _device->cancel_request(r); }),
+        _stream_ring([this](platform::rs_usb_request r) { _device->submit_request(r); }, [this](platform::rs_usb_request r) { return _device->cancel_request(r); })
     {
         LOG_DEBUG("Making a sensor " << this);
         _source.set_max_publish_list_size(256); //increase frame source queue size for TM2
         _data_dispatcher = std::make_shared<dispatcher>(256); // make a queue of the same size to dispatch data messages
         _data_dispatcher->start();
+
+        _usb_request_count = DEFAULT_USB_REQUEST_COUNT;
+        if (auto requests_var = getenv("LRS_TM2_USB_REQUESTS"))
+            _usb_request_count = std::min(std::max(atoi(requests_var), 1), MAX_USB_REQUEST_COUNT);
+        auto direct_var = getenv("LRS_TM2_DIRECT_DISPATCH");
+        _direct_dispatch = direct_var && atoi(direct_var) != 0;
+        LOG_DEBUG("T265 keeps " << _usb_request_count << " USB reads in flight per endpoint" << (_direct_dispatch ? ", frames are dispatched directly" : ""));
         register_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE, std::make_shared<md_tm2_parser>(RS2_FRAME_METADATA_ACTUAL_EXPOSURE));
         register_metadata(RS2_FRAME_METADATA_TEMPERATURE    , std::make_shared<md_tm2_parser>(RS2_FRAME_METADATA_TEMPERATURE));
         //Replacing md parser for RS2_FRAME_METADATA_TIME_OF_ARRIVAL
@@ -401,7 +412,7 @@ namespace librealsense
         try {
             _data_dispatcher->stop();
             // Use this as a proxy to know if we are still able to communicate with the device
-            bool device_valid = _stream_request && _interrupt_request;
+            bool device_valid = !_stream_ring.empty() && !_interrupt_ring.empty() && !_stream_ring.failed() && !_interrupt_ring.failed();
 
             if (device_valid && _is_streaming)
                 stop();
@@ -739,7 +750,7 @@ namespace librealsense
             f.profile.set(vframe->get_width(), vframe->get_height(), vframe->get_stride(), convertToTm2PixelFormat(vframe->get_stream()->get_format()));
             f.exposuretime = get_md_or_default(RS2_FRAME_METADATA_ACTUAL_EXPOSURE);
             f.frameLength = vframe->get_height()*vframe->get_stride()* (vframe->get_bpp() / 8);
-            f.data = vframe->data.data();
+            f.data = const_cast<uint8_t*>(vframe->get_frame_data());
             f.timestamp = to_nanos(vframe->additional_data.timestamp);
             f.systemTimestamp = to_nanos(vframe->additional_data.backend_timestamp);
             f.arrivalTimeStamp = to_nanos(vframe->additional_data.system_time);
@@ -814,6 +825,12 @@ namespace librealsense
         start_interrupt();
         start_stream();
 
+        {
+            std::lock_guard<std::mutex> lk(_latency_mutex);
+            for (auto&& stats : _latency)
+                stats = latency_stats();
+        }
+
         _source.set_callback(callback);
         raise_on_before_streaming_changes(true);
 
@@ -843,6 +860,11 @@ namespace librealsense
 
     void tm2_sensor::stop()
     {
+        // Frame callbacks run inside a USB completion when dispatched directly, stopping would cancel the
+        // reads of the completion that is waiting for the callback to return
+        if (_interrupt_ring.in_completion() || _stream_ring.in_completion())
+            throw wrong_api_call_sequence_exception("stop() cannot be called from a frame callback when frames are dispatched directly (LRS_TM2_DIRECT_DISPATCH)");
+
         std::lock_guard<std::mutex> lock(_tm_op_lock);
         LOG_DEBUG("Stopping T265");
         if (!_is_streaming)
@@ -867,6 +889,8 @@ namespace librealsense
         stop_stream();
         stop_interrupt();
 
+        log_latency_stats();
+
         raise_on_before_streaming_changes(false);
         _is_streaming = false;
     }
@@ -1071,14 +1095,58 @@ namespace librealsense
 
     void tm2_sensor::dispatch_threaded(frame_holder frame)
     {
+        if (_direct_dispatch)
+        {
+            // The user callback runs on the USB event thread, skipping the dispatcher queue. Reads keep
+            // arriving into the other requests of the ring meanwhile, but a slow callback delays the others.
+            update_latency_stats(frame.frame);
+            _source.invoke_callback(std::move(frame));
+            return;
+        }
+
         // TODO: Replace with C++14 move capture
         auto frame_holder_ptr = std::make_shared<frame_holder>();
         *frame_holder_ptr = std::move(frame);
         _data_dispatcher->invoke([this, frame_holder_ptr](dispatcher::cancellable_timer t) {
+                update_latency_stats(frame_holder_ptr->frame);
                 _source.invoke_callback(std::move(*frame_holder_ptr));
             });
     }
 
+    void tm2_sensor::update_latency_stats(const frame_interface* frame)
+    {
+        auto stream = frame->get_stream()->get_stream_type();
+        if (stream < 0 || stream >= RS2_STREAM_COUNT)
+            return;
+
+        // Frame timestamps are in the global time domain, same as the arrival time
+        auto now = environment::get_instance().get_time_service()->get_time();
+        auto transport = frame->get_frame_system_time() - frame->get_frame_timestamp();
+        auto dispatch = now - frame->get_frame_system_time();
+
+        std::lock_guard<std::mutex> lk(_latency_mutex);
+        auto& stats = _latency[stream];
+        stats.count++;
+        stats.transport_sum += transport;
+        stats.transport_max = std::max(stats.transport_max, transport);
+        stats.dispatch_sum += dispatch;
+        stats.dispatch_max = std::max(stats.dispatch_max, dispatch);
+    }
+
+    void tm2_sensor::log_latency_stats()
+    {
+        std::lock_guard<std::mutex> lk(_latency_mutex);
+        for (int stream = 0; stream < RS2_STREAM_COUNT; stream++)
+        {
+            auto& stats = _latency[stream];
+            if (!stats.count)
+                continue;
+            LOG_INFO("T265 " << get_string(static_cast<rs2_stream>(stream)) << " latency over " << stats.count << " frames [ms]:"
+                << " transport avg " << stats.transport_sum / stats.count << " max " << stats.transport_max
+                << ", dispatch avg " << stats.dispatch_sum / stats.count << " max " << stats.dispatch_max);
+        }
+    }
+
     void tm2_sensor::receive_pose_message(const interrupt_message_get_pose & pose_message)
     {
         const pose_data & pose = pose_message.pose;
@@ -1231,7 +1299,9 @@ namespace librealsense
             frame->set_timestamp_domain(RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME);
             frame->set_stream(profile);
             frame->set_sensor(this->shared_from_this()); //TODO? uvc doesn't set it?
-            video->data.assign(message->metadata.bFrameData, message->metadata.bFrameData + (height * stride));
+            // The frame may be backed by a user allocator, copy into the buffer the frame exposes
+            memcpy(const_cast<byte*>(frame->get_frame_data()), message->metadata.bFrameData,
+                std::min<size_t>(height * stride, frame->get_frame_data_size()));
         }
         else
         {
@@ -1255,14 +1325,21 @@ namespace librealsense
     {
         std::vector<uint8_t> buffer(BUFFER_SIZE);
 
-        if (_interrupt_request) return false;
+        if (!_interrupt_ring.empty())
+        {
+            if (!_interrupt_ring.failed()) return false;
+            stop_interrupt();
+        }
 
-        _interrupt_callback = std::make_shared<platform::usb_request_callback>([&](platform::rs_usb_request request) {
+        // The completions are serialized and the reads of an endpoint complete in order, so messages are
+        // still handled in the order they were sent
+        _interrupt_ring.start(_usb_request_count, [this, buffer](platform::rs_usb_request_callback callback) mutable {
+            return _device->interrupt_read_request(buffer, callback);
+        }, [this](platform::rs_usb_request request) {
             uint32_t transferred = request->get_actual_length();
             if(transferred == 0) { // something went wrong, exit
                 LOG_ERROR("Interrupt transfer failed, exiting");
-                _interrupt_request.reset();
-                return;
+                return false;
             }
 
             interrupt_message_header* header = (interrupt_message_header*)request->get_buffer().data();
@@ -1315,36 +1392,33 @@ namespace librealsense
             else
                 LOG_ERROR("Unknown interrupt message " <<  message_name(*((bulk_message_response_header*)header)) << " with status " << status_name(*((bulk_message_response_header*)header)));
 
-            _device->submit_request(request);
+            return true;
         });
-
-        _interrupt_request = _device->interrupt_read_request(buffer, _interrupt_callback);
-        _device->submit_request(_interrupt_request);
         return true;
     }
 
     void tm2_sensor::stop_interrupt()
     {
-        if (_interrupt_request) {
-            if (_device->cancel_request(_interrupt_request)) {
-                _interrupt_callback->cancel();
-                _interrupt_request.reset();
-            }
-        }
+        _interrupt_ring.stop();
     }
 
     bool tm2_sensor::start_stream()
     {
         std::vector<uint8_t> buffer(MAX_TRANSFER_SIZE);
 
-        if (_stream_request) return false;
+        if (!_stream_ring.empty())
+        {
+            if (!_stream_ring.failed()) return false;
+            stop_stream();
+        }
 
-        _stream_callback = std::make_shared<platform::usb_request_callback>([&](platform::rs_usb_request request) {
+        _stream_ring.start(_usb_request_count, [this, buffer](platform::rs_usb_request_callback callback) mutable {
+            return _device->stream_read_request(buffer, callback);
+        }, [this](platform::rs_usb_request request) {
             uint32_t transferred = request->get_actual_length();
             if(!transferred) {
                 LOG_ERROR("Stream transfer failed, exiting");
-                _stream_request.reset();
-                return;
+                return false;
             }
 
             auto header = (bulk_message_raw_stream_header *)request->get_buffer().data();
@@ -1376,22 +1450,14 @@ namespace librealsense
                 LOG_ERROR("Unexpected message on raw endpoint " << header->header.wMessageID);
             }
 
-            _device->submit_request(request);
+            return true;
         });
-
-        _stream_request = _device->stream_read_request(buffer, _stream_callback);
-        _device->submit_request(_stream_request);
         return true;
     }
 
     void tm2_sensor::stop_stream()
     {
-        if (_stream_request) {
-            if (_device->cancel_request(_stream_request)) {
-                _stream_callback->cancel();
-                _stream_request.reset();
-            }
-        }
+        _stream_ring.stop();
     }
 
     void tm2_sensor::print_logs(const std::unique_ptr<bulk_message_response_get_and_clear_event_log> & log)
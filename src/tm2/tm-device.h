@@ -12,6 +12,7 @@
 
 #include "../usb/usb-device.h"
 #include "../usb/usb-messenger.h"
+#include "../usb/usb-request-ring.h"
 
 #include "t265-messages.h"
 
@@ -179,11 +180,11 @@ namespace librealsense
         std::atomic<bool> _time_sync_thread_stop;
         std::atomic<bool> _log_poll_thread_stop;
 
-        platform::rs_usb_request          _interrupt_request;
-        platform::rs_usb_request_callback _interrupt_callback;
-
-        platform::rs_usb_request          _stream_request;
-        platform::rs_usb_request_callback _stream_callback;
+        // Every endpoint keeps a ring of reads in flight, a completed read is handled and resubmitted
+        // while the others keep receiving
+        int                                   _usb_request_count;
+        platform::usb_request_ring            _interrupt_ring;
+        platform::usb_request_ring            _stream_ring;
 
         float last_exposure = 200.f;
         float last_gain = 1.f;
@@ -202,10 +203,24 @@ namespace librealsense
 
         template <t265::SIXDOF_MODE flag, t265::SIXDOF_MODE depends_on, bool invert> friend class tracking_mode_option;
 
-        // threaded dispatch
+        // threaded dispatch, or straight from the USB completion when _direct_dispatch is set
         std::shared_ptr<dispatcher> _data_dispatcher;
+        bool _direct_dispatch;
         void dispatch_threaded(frame_holder frame);
 
+        // Delivery latency per stream type: from the device sample time to the host arrival (transport),
+        // and from the arrival to the user callback (dispatch). Reset on start, logged on stop.
+        struct latency_stats
+        {
+            unsigned long long count = 0;
+            double transport_sum = 0, transport_max = 0;
+            double dispatch_sum = 0, dispatch_max = 0;
+        };
+        std::mutex _latency_mutex;
+        latency_stats _latency[RS2_STREAM_COUNT];
+        void update_latency_stats(const frame_interface* frame);
+        void log_latency_stats();
+
         // interrupt endpoint receive
         void receive_pose_message(const t265::interrupt_message_get_pose & message);
         void receive_accel_message(const t265::interrupt_message_accelerometer_stream & message);
@@ -970,6 +970,35 @@ namespace librealsense
         void release() override { delete this; }
     };
 
+    class frame_allocator : public rs2_frame_allocator
+    {
+        rs2_frame_allocate_ptr aptr;
+        rs2_frame_deallocate_ptr dptr;
+        void * user;
+    public:
+        frame_allocator(rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void * user)
+            : aptr(on_allocate), dptr(on_deallocate), user(user) {}
+
+        void* allocate(int size) override
+        {
+            try { return aptr(size, user); }
+            catch (...)
+            {
+                LOG_ERROR("Received an exception from frame allocator!");
+            }
+            return nullptr;
+        }
+        void deallocate(void* buffer, int size) override
+        {
+            try { dptr(buffer, size, user); }
+            catch (...)
+            {
+                LOG_ERROR("Received an exception from frame deallocator!");
+            }
+        }
+        void release() override { delete this; }
+    };
+
     typedef void(*software_device_destruction_callback_function_ptr)(void * user);
 
     class software_device_destruction_callback : public rs2_software_device_destruction_callback
@@ -1045,6 +1074,7 @@ namespace librealsense
     typedef std::shared_ptr<rs2_frame_callback> frame_callback_ptr;
     typedef std::shared_ptr<rs2_frame_processor_callback> frame_processor_callback_ptr;
     typedef std::shared_ptr<rs2_notifications_callback> notifications_callback_ptr;
+    typedef std::shared_ptr<rs2_frame_allocator> frame_allocator_ptr;
     typedef std::shared_ptr<rs2_software_device_destruction_callback> software_device_destruction_callback_ptr;
     typedef std::shared_ptr<rs2_devices_changed_callback> devices_changed_callback_ptr;
     typedef std::shared_ptr<rs2_update_progress_callback> update_progress_callback_ptr;
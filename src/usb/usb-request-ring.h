@@ -0,0 +1,85 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "usb-request.h"
+
+#include <atomic>
+#include <thread>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Keeps a number of reads in flight on one endpoint. A completed read is handled and resubmitted
+        // while the others keep receiving, the completions of the ring are serialized by its callback
+        class usb_request_ring
+        {
+        public:
+            typedef std::function<rs_usb_request(rs_usb_request_callback)> create_function;
+            // Returns false when the read failed, it is then not resubmitted and the ring is marked as failed
+            typedef std::function<bool(rs_usb_request)> handle_function;
+
+            usb_request_ring(std::function<void(rs_usb_request)> submit, std::function<bool(rs_usb_request)> cancel)
+                : _submit(submit), _cancel(cancel), _failed(false), _completion_thread(std::thread::id()) {}
+
+            bool empty() const { return _requests.empty(); }
+            bool failed() const { return _failed; }
+
+            // True when called from the handler of a completion, stopping the ring there would deadlock
+            bool in_completion() const { return _completion_thread.load() == std::this_thread::get_id(); }
+
+            void start(int count, create_function create, handle_function handle)
+            {
+                _callback = std::make_shared<usb_request_callback>([this, handle](rs_usb_request request) {
+                    _completion_thread = std::this_thread::get_id();
+                    bool succeeded;
+                    try
+                    {
+                        succeeded = handle(request);
+                    }
+                    catch (...)
+                    {
+                        _completion_thread = std::thread::id();
+                        throw;
+                    }
+                    _completion_thread = std::thread::id();
+
+                    if (!succeeded)
+                    {
+                        _failed = true;
+                        return;
+                    }
+                    _submit(request);
+                });
+
+                _failed = false;
+                for (int i = 0; i < count; i++)
+                    _requests.push_back(create(_callback));
+                for (auto&& request : _requests)
+                    _submit(request);
+            }
+
+            void stop()
+            {
+                if (_requests.empty()) return;
+
+                // No read is resubmitted once the callback is cancelled, the requests wait for their
+                // cancellation to complete when released
+                _callback->cancel();
+                for (auto&& request : _requests)
+                    _cancel(request);
+                _requests.clear();
+            }
+
+        private:
+            std::function<void(rs_usb_request)> _submit;
+            std::function<bool(rs_usb_request)> _cancel;
+            std::vector<rs_usb_request> _requests;
+            rs_usb_request_callback _callback;
+            std::atomic<bool> _failed;
+            std::atomic<std::thread::id> _completion_thread;
+        };
+    }
+}
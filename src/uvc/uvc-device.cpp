@@ -13,6 +13,8 @@
 const int CONTROL_TRANSFER_TIMEOUT = 100;
 const int INTERRUPT_BUFFER_SIZE = 1024;
 const int FIRST_FRAME_MILLISECONDS_TIMEOUT = 2000;
+const int DEFAULT_USB_REQUEST_COUNT = 2;
+const int MAX_USB_REQUEST_COUNT = 16;
 
 class lock_singleton
 {
@@ -69,17 +71,26 @@ namespace librealsense
 
                 auto dev = usb_enumerator::create_usb_device(usb_info);
                 if(dev)
-                    return std::make_shared<rs_uvc_device>(dev, info);
+                {
+                    // Every request holds a buffer of a full frame, the depth is capped accordingly
+                    int request_count = DEFAULT_USB_REQUEST_COUNT;
+                    if (auto requests_var = getenv("LRS_RSUSB_REQUESTS"))
+                        request_count = std::min(std::max(atoi(requests_var), 1), MAX_USB_REQUEST_COUNT);
+                    auto zero_copy_var = getenv("LRS_RSUSB_ZERO_COPY");
+                    bool zero_copy = zero_copy_var && atoi(zero_copy_var) != 0;
+                    return std::make_shared<rs_uvc_device>(dev, info, static_cast<uint8_t>(request_count), zero_copy);
+                }
             }
 
             return nullptr;
         }
 
-        rs_uvc_device::rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count) :
+        rs_uvc_device::rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count, bool zero_copy) :
                 _usb_device(usb_device),
                 _info(info),
                 _action_dispatcher(10),
-                _usb_request_count(usb_request_count)
+                _usb_request_count(usb_request_count),
+                _zero_copy(zero_copy)
         {
             _parser = std::make_shared<uvc_parser>(usb_device, info);
             _action_dispatcher.start();
@@ -451,7 +462,7 @@ namespace librealsense
             if(sts != RS2_USB_STATUS_SUCCESS)
                 throw std::runtime_error("Failed to start streaming!");
 
-            uvc_streamer_context usc = { profile, callback, ctrl, _usb_device, _messenger, _usb_request_count };
+            uvc_streamer_context usc = { profile, callback, ctrl, _usb_device, _messenger, _usb_request_count, _zero_copy };
 
             auto streamer = std::make_shared<uvc_streamer>(usc);
             _streamers.push_back(streamer);
@@ -36,7 +36,7 @@ namespace librealsense
         class rs_uvc_device : public uvc_device
         {
         public:
-            rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count = 2);
+            rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count = 2, bool zero_copy = false);
             virtual ~rs_uvc_device();
 
             virtual void probe_and_commit(stream_profile profile, frame_callback callback, int buffers = DEFAULT_V4L2_FRAME_BUFFERS) override;
@@ -103,6 +103,7 @@ namespace librealsense
             rs_usb_request                          _interrupt_request;
             rs_usb_request_callback                 _interrupt_callback;
             uint8_t                                 _usb_request_count;
+            bool                                    _zero_copy;
 
             mutable dispatcher                      _action_dispatcher;
             // uvc internal
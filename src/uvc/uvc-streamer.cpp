@@ -17,7 +17,7 @@ namespace librealsense
     namespace platform
     {
         uvc_streamer::uvc_streamer(uvc_streamer_context context) :
-            _context(context), _action_dispatcher(10)
+            _context(context), _action_dispatcher(std::max(10, context.request_count + 2))
         {
             auto inf = context.usb_device->get_interface(context.control->bInterfaceNumber);
             if (inf == nullptr)
@@ -25,7 +25,8 @@ namespace librealsense
             _read_endpoint = inf->first_endpoint(platform::RS2_USB_ENDPOINT_DIRECTION_READ);
 
             _read_buff_length = UVC_PAYLOAD_MAX_HEADER_LENGTH + _context.control->dwMaxVideoFrameSize;
-            LOG_INFO("endpoint " << (int)_read_endpoint->get_address() << " read buffer size: " << std::dec <<_read_buff_length);
+            LOG_INFO("endpoint " << (int)_read_endpoint->get_address() << " read buffer size: " << std::dec <<_read_buff_length
+                << ", " << (int)_context.request_count << " requests in flight" << (_context.zero_copy ? ", zero-copy" : ""));
 
             _action_dispatcher.start();
 
@@ -113,29 +114,16 @@ namespace librealsense
 
             _request_callback = std::make_shared<usb_request_callback>([this](platform::rs_usb_request r)
             {
+                if(_context.zero_copy)
+                {
+                    // Nothing is copied, so the request is handled and resubmitted on the USB event thread
+                    // right away, leaving the transfer queue as deep as possible
+                    on_request_zero_copy(r);
+                    return;
+                }
                 _action_dispatcher.invoke([this, r](dispatcher::cancellable_timer)
                 {
-                    if(!_running)
-                      return;
-
-                    auto al = r->get_actual_length();
-                    // Relax the frame size constrain for compressed streams
-                    bool is_compressed = val_in_range(_context.profile.format, { 0x4d4a5047U , 0x5a313648U}); // MJPEG, Z16H
-                    if(al > 0L && ((al == r->get_buffer().data()[0] + _context.control->dwMaxVideoFrameSize) || is_compressed ))
-                    {
-                        auto f = backend_frame_ptr(_frames_archive->allocate(), &cleanup_frame);
-                        if(f)
-                        {
-                            _frame_arrived = true;
-                            _watchdog->kick();
-                            memcpy(f->pixels.data(), r->get_buffer().data(), r->get_buffer().size());
-                            uvc_process_bulk_payload(std::move(f), r->get_actual_length(), _queue);
-                        }
-                    }
-
-                    auto sts = _context.messenger->submit_request(r);
-                    if(sts != platform::RS2_USB_STATUS_SUCCESS)
-                        LOG_ERROR("failed to submit UVC request, error: " << sts);
+                    on_request_copy(r);
                 });
             });
 
@@ -148,6 +136,61 @@ namespace librealsense
             }
         }
 
+        bool uvc_streamer::is_valid_payload(const rs_usb_request& r) const
+        {
+            auto al = r->get_actual_length();
+            // Relax the frame size constrain for compressed streams
+            bool is_compressed = val_in_range(_context.profile.format, { 0x4d4a5047U , 0x5a313648U}); // MJPEG, Z16H
+            return al > 0L && ((al == r->get_buffer().data()[0] + _context.control->dwMaxVideoFrameSize) || is_compressed);
+        }
+
+        void uvc_streamer::on_request_copy(rs_usb_request r)
+        {
+            if(!_running)
+                return;
+
+            if(is_valid_payload(r))
+            {
+                auto f = backend_frame_ptr(_frames_archive->allocate(), &cleanup_frame);
+                if(f)
+                {
+                    _frame_arrived = true;
+                    _watchdog->kick();
+                    memcpy(f->pixels.data(), r->get_buffer().data(), r->get_buffer().size());
+                    uvc_process_bulk_payload(std::move(f), r->get_actual_length(), _queue);
+                }
+            }
+
+            auto sts = _context.messenger->submit_request(r);
+            if(sts != platform::RS2_USB_STATUS_SUCCESS)
+                LOG_ERROR("failed to submit UVC request, error: " << sts);
+        }
+
+        void uvc_streamer::on_request_zero_copy(rs_usb_request r)
+        {
+            if(!_running)
+                return;
+
+            if(is_valid_payload(r))
+            {
+                // When the pool is exhausted the frame is dropped and the request reuses its own buffer
+                auto f = backend_frame_ptr(_frames_archive->allocate(), &cleanup_frame);
+                if(f)
+                {
+                    _frame_arrived = true;
+                    _watchdog->kick();
+                    // All pool and request buffers have the same size, the transfer becomes the frame
+                    auto payload_len = r->get_actual_length();
+                    r->swap_buffer(f->pixels);
+                    uvc_process_bulk_payload(std::move(f), payload_len, _queue);
+                }
+            }
+
+            auto sts = _context.messenger->submit_request(r);
+            if(sts != platform::RS2_USB_STATUS_SUCCESS)
+                LOG_ERROR("failed to submit UVC request, error: " << sts);
+        }
+
         void uvc_streamer::start()
         {
             _action_dispatcher.invoke_and_wait([this](dispatcher::cancellable_timer c)
@@ -168,7 +211,7 @@ namespace librealsense
 
                 _publish_frame_thread->start();
 
-            }, [this](){ return _running; });
+            }, [this](){ return _running.load(); });
         }
 
         void uvc_streamer::stop()
@@ -7,6 +7,7 @@
 
 #include "stdio.h"
 #include "stdlib.h"
+#include <atomic>
 #include <cstring>
 #include <string>
 #include <chrono>
@@ -26,6 +27,9 @@ namespace librealsense
             rs_usb_device usb_device;
             rs_usb_messenger messenger;
             uint8_t request_count;
+            // Completed transfers are swapped into frames of the pool and the request is resubmitted with the
+            // frame's previous buffer, instead of being copied into the frame
+            bool zero_copy;
         };
 
         class uvc_streamer
@@ -44,9 +48,10 @@ namespace librealsense
             bool wait_for_first_frame(uint32_t timeout_ms);
 
         private:
-            bool _running = false;
-            bool _frame_arrived = false;
-            bool _publish_frames = true;
+            // Accessed from the USB event thread in zero-copy mode as well as the dispatcher and watchdog threads
+            std::atomic<bool> _running{ false };
+            std::atomic<bool> _frame_arrived{ false };
+            std::atomic<bool> _publish_frames{ true };
 
             int64_t _watchdog_timeout;
             uvc_streamer_context _context;
@@ -64,6 +69,9 @@ namespace librealsense
 
             void init();
             void flush();
+            bool is_valid_payload(const rs_usb_request& r) const;
+            void on_request_copy(rs_usb_request r);
+            void on_request_zero_copy(rs_usb_request r);
         };
     }
 }
@@ -52,8 +52,10 @@
 
 //#include "ros/subscription_callback_helper.h"
 
+#include <deque>
 #include <ios>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stdexcept>
@@ -124,6 +126,14 @@ public:
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
 
+    //! Set the number of threads compressing LZ4 chunks in the background, 0 to compress while writing
+    /*!
+     * Finished chunks are handed over to the threads, and written to the file in order once compressed.
+     * At most twice as many chunks as threads are pending, writing waits for the oldest one beyond that.
+     */
+    void            setCompressionThreads(uint32_t threads);
+    uint32_t        getCompressionThreads() const;                //!< Get the number of threads compressing chunks
+
     //! Write a message into the bag file
     /*!
      * \param topic The topic name
@@ -201,13 +211,20 @@ private:
     void appendConnectionRecordToBuffer(Buffer& buf, ConnectionInfo const* connection_info);
     template<class T>
     void writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& time, T const& msg);
-    void writeIndexRecords();
+    void writeIndexRecords(std::map<uint32_t, std::multiset<IndexEntry> > const& indexes);
     void writeConnectionRecords();
     void writeChunkInfoRecords();
     void startWritingChunk(rs2rosinternal::Time time);
     void writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size);
     void stopWritingChunk();
 
+    // Background compression
+
+    struct PendingChunk;
+    class ChunkCompressor;
+    void writeCompressedChunks(size_t max_pending);
+    void writeCompressedChunk(PendingChunk& chunk);
+
     // Reading
 
     void readVersion();
@@ -226,6 +243,7 @@ private:
 
     template<typename Stream>
     void readMessageDataIntoStream(IndexEntry const& index_entry, Stream& stream) const;
+    bool findMessageData(IndexEntry const& index_entry, uint64_t& offset, uint32_t& size) const;
 
     void     decompressChunk(uint64_t chunk_pos) const;
     void     decompressRawChunk(ChunkHeader const& chunk_header) const;
@@ -287,6 +305,7 @@ private:
 
     // Current chunk
     bool      chunk_open_;
+    bool      chunk_in_memory_;   //!< the chunk is only assembled in outgoing_chunk_buffer_, to be compressed in the background
     ChunkInfo curr_chunk_info_;
     uint64_t  curr_chunk_data_pos_;
 
@@ -307,9 +326,14 @@ private:
 
     mutable Buffer   outgoing_chunk_buffer_;   //!< reusable buffer to read chunk into
 
+    std::unique_ptr<ChunkCompressor>             compressor_;
+    std::deque<std::shared_ptr<PendingChunk> >   pending_chunks_;   //!< in file order
+
     mutable Buffer*  current_buffer_;
 
     mutable uint64_t decompressed_chunk_;      //!< position of decompressed chunk
+
+    mutable std::map<uint64_t, uint64_t> raw_chunk_data_pos_;   //!< chunk position => position of its data if uncompressed, 0 otherwise
 };
 
 } // namespace rosbag
@@ -555,8 +579,11 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
 
         std::multiset<IndexEntry>& chunk_connection_index = curr_chunk_connection_indexes_[connection_info->id];
         chunk_connection_index.insert(chunk_connection_index.end(), index_entry);
-        std::multiset<IndexEntry>& connection_index = connection_indexes_[connection_info->id];
-        connection_index.insert(connection_index.end(), index_entry);
+        // The position of a chunk compressed in the background is known once it is written, see writeCompressedChunk()
+        if (!chunk_in_memory_) {
+            std::multiset<IndexEntry>& connection_index = connection_indexes_[connection_info->id];
+            connection_index.insert(connection_index.end(), index_entry);
+        }
 
         // Increment the connection count
         curr_chunk_info_.connection_counts[connection_info->id]++;
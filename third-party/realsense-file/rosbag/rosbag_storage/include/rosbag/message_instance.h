@@ -93,6 +93,12 @@ public:
     //! Size of serialized message
     uint32_t size() const;
 
+    //! Locate the serialized message contents in the bag file
+    /*!
+     * returns false if the message is stored in a compressed chunk, and can only be read through a copy
+     */
+    bool getDataPosition(uint64_t& offset, uint32_t& size) const;
+
 private:
     MessageInstance(ConnectionInfo const* connection_info, IndexEntry const& index, Bag const& bag);
 
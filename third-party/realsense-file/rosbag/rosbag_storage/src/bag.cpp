@@ -44,6 +44,9 @@
 
 #include "console_bridge/console.h"
 #include <memory.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #define foreach BOOST_FOREACH
 
@@ -59,6 +62,93 @@ using rs2rosinternal::Time;
 
 namespace rosbag {
 
+// A finished chunk, waiting to be compressed and written
+struct Bag::PendingChunk
+{
+    ChunkInfo                                      info;
+    std::map<uint32_t, std::multiset<IndexEntry> > connection_indexes;
+    Buffer                                         data;
+    std::vector<char>                              compressed;
+    bool                                           done = false;
+    bool                                           failed = false;
+};
+
+class Bag::ChunkCompressor
+{
+public:
+    explicit ChunkCompressor(uint32_t threads) : threads_count_(threads), stopping_(false) {
+        for (uint32_t i = 0; i < threads; i++)
+            threads_.emplace_back([this]() { run(); });
+    }
+
+    ~ChunkCompressor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& t : threads_)
+            t.join();
+    }
+
+    uint32_t getThreadsCount() const { return threads_count_; }
+
+    void submit(std::shared_ptr<PendingChunk> chunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(std::move(chunk));
+        }
+        work_cv_.notify_one();
+    }
+
+    bool isDone(PendingChunk const& chunk) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return chunk.done;
+    }
+
+    void wait(PendingChunk const& chunk) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&]() { return chunk.done; });
+    }
+
+private:
+    void run() {
+        while (true) {
+            std::shared_ptr<PendingChunk> chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+                if (queue_.empty())
+                    return;
+                chunk = std::move(queue_.front());
+                queue_.pop_front();
+            }
+
+            // Same stream format as LZ4Stream writes, incompressible blocks are stored as is
+            unsigned int size = chunk->data.getSize();
+            unsigned int compressed_size = size + size / 64 + 64;
+            chunk->compressed.resize(compressed_size);
+            int ret = roslz4_buffToBuffCompress((char*) chunk->data.getData(), size, chunk->compressed.data(), &compressed_size, 6);
+            chunk->compressed.resize(compressed_size);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                chunk->failed = (ret != ROSLZ4_OK);
+                chunk->done = true;
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    uint32_t                                  threads_count_;
+    std::vector<std::thread>                  threads_;
+    std::mutex                                mutex_;
+    std::condition_variable                   work_cv_;
+    std::condition_variable                   done_cv_;
+    std::deque<std::shared_ptr<PendingChunk> > queue_;
+    bool                                      stopping_;
+};
+
 Bag::Bag() :
     mode_(bagmode::Write),
     version_(0),
@@ -71,6 +161,7 @@ Bag::Bag() :
     connection_count_(0),
     chunk_count_(0),
     chunk_open_(false),
+    chunk_in_memory_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
     decompressed_chunk_(0)
@@ -87,6 +178,7 @@ Bag::Bag(string const& filename, uint32_t mode) :
     connection_count_(0),
     chunk_count_(0),
     chunk_open_(false),
+    chunk_in_memory_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
     decompressed_chunk_(0)
@@ -173,8 +265,10 @@ void Bag::close() {
         delete i->second;
     connections_.clear();
     chunks_.clear();
+    pending_chunks_.clear();
     connection_indexes_.clear();
     curr_chunk_connection_indexes_.clear();
+    raw_chunk_data_pos_.clear();
 }
 
 void Bag::closeWrite() {
@@ -194,6 +288,18 @@ void Bag::setChunkThreshold(uint32_t chunk_threshold) {
     chunk_threshold_ = chunk_threshold;
 }
 
+void Bag::setCompressionThreads(uint32_t threads) {
+    if (file_.isOpen() && chunk_open_)
+        stopWritingChunk();
+    writeCompressedChunks(0);
+
+    compressor_.reset(threads > 0 ? new ChunkCompressor(threads) : nullptr);
+}
+
+uint32_t Bag::getCompressionThreads() const {
+    return compressor_ ? compressor_->getThreadsCount() : 0;
+}
+
 CompressionType Bag::getCompression() const { return compression_; }
 
 std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
@@ -297,6 +403,7 @@ void Bag::startWriting() {
 void Bag::stopWriting() {
     if (chunk_open_)
         stopWritingChunk();
+    writeCompressedChunks(0);
 
     seek(0, std::ios::end);
 
@@ -442,7 +549,9 @@ void Bag::readFileHeaderRecord() {
 }
 
 uint32_t Bag::getChunkOffset() const {
-    if (compression_ == compression::Uncompressed)
+    if (chunk_in_memory_)
+        return outgoing_chunk_buffer_.getSize();
+    else if (compression_ == compression::Uncompressed)
         return static_cast<uint32_t>(file_.getOffset() - curr_chunk_data_pos_);
     else
         return file_.getCompressedBytesIn();
@@ -454,6 +563,14 @@ void Bag::startWritingChunk(Time time) {
     curr_chunk_info_.start_time = time;
     curr_chunk_info_.end_time   = time;
 
+    // The records of the chunk are already assembled in outgoing_chunk_buffer_, nothing is written to the file until it is compressed
+    if (compressor_ && compression_ == compression::LZ4) {
+        chunk_in_memory_ = true;
+        chunk_open_ = true;
+        return;
+    }
+    writeCompressedChunks(0);
+
     // Write the chunk header, with a place-holder for the data sizes (we'll fill in when the chunk is finished)
     writeChunkHeader(compression_, 0, 0);
 
@@ -467,6 +584,21 @@ void Bag::startWritingChunk(Time time) {
 }
 
 void Bag::stopWritingChunk() {
+    if (chunk_in_memory_) {
+        std::shared_ptr<PendingChunk> chunk = std::make_shared<PendingChunk>();
+        chunk->info = curr_chunk_info_;
+        chunk->connection_indexes.swap(curr_chunk_connection_indexes_);
+        chunk->data.swap(outgoing_chunk_buffer_);
+        curr_chunk_info_.connection_counts.clear();
+        chunk_in_memory_ = false;
+        chunk_open_ = false;
+
+        pending_chunks_.push_back(chunk);
+        compressor_->submit(chunk);
+        writeCompressedChunks(2 * compressor_->getThreadsCount());
+        return;
+    }
+
     // Add this chunk to the index
     chunks_.push_back(curr_chunk_info_);
 
@@ -483,7 +615,7 @@ void Bag::stopWritingChunk() {
 
     // Write out the indexes and clear them
     seek(end_of_chunk_pos);
-    writeIndexRecords();
+    writeIndexRecords(curr_chunk_connection_indexes_);
     curr_chunk_connection_indexes_.clear();
 
     // Clear the connection counts
@@ -493,6 +625,43 @@ void Bag::stopWritingChunk() {
     chunk_open_ = false;
 }
 
+// Writes the compressed chunks in order, waiting for the oldest ones while more than max_pending are left
+void Bag::writeCompressedChunks(size_t max_pending) {
+    while (!pending_chunks_.empty()) {
+        std::shared_ptr<PendingChunk> chunk = pending_chunks_.front();
+        if (pending_chunks_.size() > max_pending)
+            compressor_->wait(*chunk);
+        else if (!compressor_->isDone(*chunk))
+            break;
+
+        pending_chunks_.pop_front();
+        writeCompressedChunk(*chunk);
+    }
+}
+
+void Bag::writeCompressedChunk(PendingChunk& chunk) {
+    if (chunk.failed)
+        throw BagException("Failed to compress chunk");
+
+    seek(0, std::ios::end);
+    uint64_t chunk_pos = file_.getOffset();
+    chunk.info.pos = chunk_pos;
+
+    writeChunkHeader(compression::LZ4, static_cast<uint32_t>(chunk.compressed.size()), chunk.data.getSize());
+    write(chunk.compressed.data(), chunk.compressed.size());
+    writeIndexRecords(chunk.connection_indexes);
+
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = chunk.connection_indexes.begin(); i != chunk.connection_indexes.end(); i++) {
+        multiset<IndexEntry>& connection_index = connection_indexes_[i->first];
+        foreach(IndexEntry index_entry, i->second) {
+            index_entry.chunk_pos = chunk_pos;
+            connection_index.insert(connection_index.end(), index_entry);
+        }
+    }
+    chunks_.push_back(chunk.info);
+    file_size_ = file_.getOffset();
+}
+
 void Bag::writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size) {
     ChunkHeader chunk_header;
     switch (compression) {
@@ -534,8 +703,8 @@ void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
 
 // Index records
 
-void Bag::writeIndexRecords() {
-    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = curr_chunk_connection_indexes_.begin(); i != curr_chunk_connection_indexes_.end(); i++) {
+void Bag::writeIndexRecords(map<uint32_t, multiset<IndexEntry> > const& indexes) {
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = indexes.begin(); i != indexes.end(); i++) {
         uint32_t                    connection_id = i->first;
         multiset<IndexEntry> const& index         = i->second;
 
@@ -902,6 +1071,42 @@ rs2rosinternal::Header Bag::readMessageDataHeader(IndexEntry const& index_entry)
     }
 }
 
+bool Bag::findMessageData(IndexEntry const& index_entry, uint64_t& offset, uint32_t& size) const {
+    // Only the chunks already in the file can be read in place
+    if (version_ != 200 || (chunk_open_ && curr_chunk_info_.pos == index_entry.chunk_pos))
+        return false;
+
+    std::map<uint64_t, uint64_t>::const_iterator chunk = raw_chunk_data_pos_.find(index_entry.chunk_pos);
+    if (chunk == raw_chunk_data_pos_.end()) {
+        seek(index_entry.chunk_pos);
+        ChunkHeader chunk_header;
+        readChunkHeader(chunk_header);
+        uint64_t data_pos = (chunk_header.compression == COMPRESSION_NONE) ? file_.getOffset() : 0;
+        chunk = raw_chunk_data_pos_.insert(std::make_pair(index_entry.chunk_pos, data_pos)).first;
+    }
+    if (chunk->second == 0)
+        return false;
+
+    // Skip the records that may precede the message in the chunk, as when reading it from a buffer
+    uint64_t pos = chunk->second + index_entry.offset;
+    uint8_t op = 0xFF;
+    do {
+        seek(pos);
+        rs2rosinternal::Header header;
+        if (!readHeader(header) || !readDataLength(size))
+            throw BagFormatException("Error reading header");
+
+        readField(*header.getValues(), OP_FIELD_NAME, true, &op);
+        offset = file_.getOffset();
+        pos = offset + size;
+    }
+    while (op == OP_MSG_DEF || op == OP_CONNECTION);
+
+    if (op != OP_MSG_DATA)
+        throw BagFormatException("Expected MSG_DATA op not found");
+    return true;
+}
+
 // NOTE: this loads the header, which is unnecessary
 uint32_t Bag::readMessageDataSize(IndexEntry const& index_entry) const {
     rs2rosinternal::Header header;
@@ -1155,7 +1360,12 @@ std::string Bag::toHeaderString(Time const* field) const {
 // Low-level I/O
 
 void Bag::write(string const& s)                  { write(s.c_str(), s.length()); }
-void Bag::write(char const* s, std::streamsize n) { file_.write((char*) s, n);    }
+void Bag::write(char const* s, std::streamsize n) {
+    // The same records are appended to outgoing_chunk_buffer_
+    if (chunk_in_memory_)
+        return;
+    file_.write((char*) s, n);
+}
 
 void Bag::read(char* b, std::streamsize n) const  { file_.read(b, n);             }
 void Bag::seek(uint64_t pos, int origin) const    { file_.seek(pos, origin);      }
@@ -0,0 +1,489 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include "tclap/CmdLine.h"
+
+using namespace std;
+using namespace chrono;
+using namespace TCLAP;
+using namespace rs2;
+
+// Heap allocations are counted by replacing the global operators. The library shares them with the executable
+// except on Windows, where it allocates through the runtime it was linked with
+#ifndef _WIN32
+#define COUNT_ALLOCATIONS
+static atomic<uint64_t> allocations_count(0);
+static atomic<uint64_t> allocated_bytes(0);
+
+void* operator new(size_t size)
+{
+    allocations_count++;
+    allocated_bytes += size;
+    if (auto p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc();
+}
+void* operator new[](size_t size) { return operator new(size); }
+void* operator new(size_t size, const nothrow_t&) noexcept
+{
+    try { return operator new(size); }
+    catch (...) { return nullptr; }
+}
+void* operator new[](size_t size, const nothrow_t&) noexcept { return operator new(size, nothrow); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, const nothrow_t&) noexcept { free(p); }
+void operator delete[](void* p, const nothrow_t&) noexcept { free(p); }
+#endif
+
+// The frames a processing block is fed with, all of the same resolution
+struct input_frames
+{
+    // Synthetic frames reference these, and are released first
+    vector<vector<uint8_t>> buffers;
+    device source;
+
+    int width = 0;
+    int height = 0;
+    vector<frame> depth;
+    vector<frameset> depth_color;
+    vector<frame> yuyv;
+};
+
+enum class input_kind { depth, depth_color, yuyv };
+
+struct block_test
+{
+    string name;
+    input_kind input;
+    function<shared_ptr<filter>()> create;
+};
+
+struct result
+{
+    string block;
+    int width;
+    int height;
+    size_t frames;
+    double throughput;      // frames per second, one frame at a time
+    double mean, p50, p90, p99, max;    // latency in ms
+    double allocations;     // per frame, negative when not counted
+    double bytes;
+};
+
+static vector<block_test> get_tests()
+{
+    return {
+        { "colorizer",           input_kind::depth,       []() { return make_shared<colorizer>(); } },
+        { "pointcloud",          input_kind::depth,       []() { return make_shared<pointcloud>(); } },
+        { "decimation_filter",   input_kind::depth,       []() { return make_shared<decimation_filter>(); } },
+        { "spatial_filter",      input_kind::depth,       []() { return make_shared<spatial_filter>(); } },
+        { "temporal_filter",     input_kind::depth,       []() { return make_shared<temporal_filter>(); } },
+        { "hole_filling_filter", input_kind::depth,       []() { return make_shared<hole_filling_filter>(); } },
+        { "threshold_filter",    input_kind::depth,       []() { return make_shared<threshold_filter>(); } },
+        { "disparity_transform", input_kind::depth,       []() { return make_shared<disparity_transform>(true); } },
+        { "units_transform",     input_kind::depth,       []() { return make_shared<units_transform>(); } },
+        { "align_to_color",      input_kind::depth_color, []() { return make_shared<rs2::align>(RS2_STREAM_COLOR); } },
+        { "align_to_depth",      input_kind::depth_color, []() { return make_shared<rs2::align>(RS2_STREAM_DEPTH); } },
+        { "yuy_decoder",         input_kind::yuyv,        []() { return make_shared<yuy_decoder>(); } },
+    };
+}
+
+static frameset make_frameset(const frame& depth, const frame& color)
+{
+    frame_queue q(1);
+    processing_block compose([&](frame, frame_source& src)
+    {
+        src.frame_ready(src.allocate_composite_frame({ depth, color }));
+    });
+    compose.start(q);
+    compose.invoke(depth);
+    frameset fs = q.wait_for_frame();
+    fs.keep();
+    return fs;
+}
+
+// A scene of slanted planes with noise and missing pixels, different in every frame
+static input_frames generate_frames(int width, int height, int count)
+{
+    input_frames input;
+    input.width = width;
+    input.height = height;
+    input.buffers.resize(3 * count);
+
+    software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto color_sensor = dev.add_sensor("Color");
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    rs2_intrinsics intrinsics = { width, height, width / 2.f, height / 2.f, width * 0.9f, width * 0.9f,
+        RS2_DISTORTION_BROWN_CONRADY, { 0, 0, 0, 0, 0 } };
+    auto depth_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, 2, RS2_FORMAT_Z16, intrinsics });
+    auto color_profile = color_sensor.add_video_stream({ RS2_STREAM_COLOR, 0, 1, width, height, 30, 3, RS2_FORMAT_RGB8, intrinsics });
+    auto yuyv_profile = color_sensor.add_video_stream({ RS2_STREAM_COLOR, 1, 2, width, height, 30, 2, RS2_FORMAT_YUYV, intrinsics });
+    depth_profile.register_extrinsics_to(color_profile, { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } });
+    depth_profile.register_extrinsics_to(yuyv_profile, { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } });
+
+    frame_queue depth_queue(count), color_queue(2 * count);
+    depth_sensor.open(depth_profile);
+    depth_sensor.start(depth_queue);
+    color_sensor.open({ color_profile, yuyv_profile });
+    color_sensor.start(color_queue);
+
+    mt19937 rng(width * height);
+    uniform_int_distribution<int> noise(-5, 5);
+    uniform_int_distribution<int> holes(0, 99);
+    for (int i = 0; i < count; i++)
+    {
+        auto& depth = input.buffers[3 * i];
+        auto& color = input.buffers[3 * i + 1];
+        auto& yuyv = input.buffers[3 * i + 2];
+        depth.resize(width * height * 2);
+        color.resize(width * height * 3);
+        yuyv.resize(width * height * 2);
+
+        auto z = reinterpret_cast<uint16_t*>(depth.data());
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                auto idx = y * width + x;
+                bool background = x > width / 2 && y > height / 3;
+                int distance = background ? 3000 + 1000 * y / height : 800 + 600 * x / width + 200 * y / height;
+                z[idx] = holes(rng) < 3 ? 0 : static_cast<uint16_t>(distance + noise(rng));
+
+                color[3 * idx] = static_cast<uint8_t>(x + i);
+                color[3 * idx + 1] = static_cast<uint8_t>(y);
+                color[3 * idx + 2] = static_cast<uint8_t>(x + y);
+
+                yuyv[2 * idx] = static_cast<uint8_t>(x + y + i);
+                yuyv[2 * idx + 1] = (x % 2) ? 100 : 150;
+            }
+        }
+
+        double timestamp = 1000. + i * 33.3;
+        depth_sensor.on_video_frame({ depth.data(), [](void*) {}, width * 2, 2, timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth_profile });
+        color_sensor.on_video_frame({ color.data(), [](void*) {}, width * 3, 3, timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, color_profile });
+        color_sensor.on_video_frame({ yuyv.data(), [](void*) {}, width * 2, 2, timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, yuyv_profile });
+    }
+
+    vector<frame> colors;
+    for (int i = 0; i < count; i++)
+    {
+        auto d = depth_queue.wait_for_frame();
+        d.keep();
+        input.depth.push_back(d);
+    }
+    for (int i = 0; i < 2 * count; i++)
+    {
+        auto c = color_queue.wait_for_frame();
+        c.keep();
+        if (c.get_profile().format() == RS2_FORMAT_YUYV)
+            input.yuyv.push_back(c);
+        else
+            colors.push_back(c);
+    }
+    for (int i = 0; i < count; i++)
+        input.depth_color.push_back(make_frameset(input.depth[i], colors[i]));
+
+    depth_sensor.stop();
+    color_sensor.stop();
+    depth_sensor.close();
+    color_sensor.close();
+    input.source = dev;
+    return input;
+}
+
+// Reads the frames of a recording as fast as they can be decoded
+static input_frames read_frames(const string& file, int count)
+{
+    input_frames input;
+
+    pipeline pipe;
+    config cfg;
+    cfg.enable_device_from_file(file, false);
+    auto profile = pipe.start(cfg);
+    profile.get_device().as<playback>().set_real_time(false);
+
+    frameset fs;
+    while (static_cast<int>(input.depth.size()) < count && pipe.try_wait_for_frames(&fs, 1000))
+    {
+        fs.keep();
+        auto depth = fs.get_depth_frame();
+        auto color = fs.get_color_frame();
+        if (depth)
+        {
+            input.width = depth.get_width();
+            input.height = depth.get_height();
+            input.depth.push_back(depth);
+            if (color && color.get_profile().format() != RS2_FORMAT_YUYV)
+                input.depth_color.push_back(fs);
+        }
+        if (color && color.get_profile().format() == RS2_FORMAT_YUYV)
+            input.yuyv.push_back(color);
+    }
+    pipe.stop();
+    return input;
+}
+
+static double percentile(const vector<double>& sorted, double p)
+{
+    auto rank = static_cast<size_t>(ceil(p / 100. * sorted.size()));
+    return sorted[min(sorted.size(), max<size_t>(rank, 1)) - 1];
+}
+
+template<class T>
+static result run(const block_test& test, const vector<T>& inputs, int width, int height, int frames, int warmup)
+{
+    auto block = test.create();
+
+    vector<double> latencies;
+    uint64_t allocations = 0, bytes = 0;
+    for (int i = 0; i < warmup + frames; i++)
+    {
+        const frame& input = inputs[i % inputs.size()];
+#ifdef COUNT_ALLOCATIONS
+        auto allocations_before = allocations_count.load();
+        auto bytes_before = allocated_bytes.load();
+#endif
+        auto start = high_resolution_clock::now();
+        auto output = block->process(input);
+        auto end = high_resolution_clock::now();
+        if (i < warmup)
+            continue;
+
+        latencies.push_back(duration_cast<nanoseconds>(end - start).count() * 1e-6);
+#ifdef COUNT_ALLOCATIONS
+        allocations += allocations_count.load() - allocations_before;
+        bytes += allocated_bytes.load() - bytes_before;
+#endif
+    }
+
+    result r;
+    r.block = test.name;
+    r.width = width;
+    r.height = height;
+    r.frames = latencies.size();
+
+    double total = 0;
+    for (auto l : latencies) total += l;
+    sort(latencies.begin(), latencies.end());
+    r.throughput = total > 0 ? 1000. * latencies.size() / total : 0;
+    r.mean = total / latencies.size();
+    r.p50 = percentile(latencies, 50);
+    r.p90 = percentile(latencies, 90);
+    r.p99 = percentile(latencies, 99);
+    r.max = latencies.back();
+#ifdef COUNT_ALLOCATIONS
+    r.allocations = static_cast<double>(allocations) / latencies.size();
+    r.bytes = static_cast<double>(bytes) / latencies.size();
+#else
+    r.allocations = r.bytes = -1;
+#endif
+    return r;
+}
+
+static bool parse_resolution(const string& s, int& width, int& height)
+{
+    char x;
+    stringstream ss(s);
+    return (ss >> width >> x >> height) && (x == 'x' || x == 'X') && width > 0 && height > 0 && width % 2 == 0;
+}
+
+static string json_string(const string& s)
+{
+    string escaped = "\"";
+    for (auto c : s)
+    {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+static void write_json(ostream& out, const string& source, int frames, const vector<result>& results)
+{
+    out << "{" << endl;
+    out << "  \"version\": \"" << RS2_API_VERSION_STR << "\"," << endl;
+    out << "  \"source\": " << json_string(source) << "," << endl;
+    out << "  \"cpu_threads\": " << thread::hardware_concurrency() << "," << endl;
+    out << "  \"frames\": " << frames << "," << endl;
+    out << "  \"results\": [" << endl;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        auto& r = results[i];
+        out << "    { \"block\": " << json_string(r.block) << ", \"width\": " << r.width << ", \"height\": " << r.height
+            << ", \"frames\": " << r.frames << ", \"fps\": " << r.throughput
+            << ", \"latency_ms\": { \"mean\": " << r.mean << ", \"p50\": " << r.p50 << ", \"p90\": " << r.p90
+            << ", \"p99\": " << r.p99 << ", \"max\": " << r.max << " }, ";
+        if (r.allocations < 0)
+            out << "\"allocations_per_frame\": null, \"allocated_bytes_per_frame\": null }";
+        else
+            out << "\"allocations_per_frame\": " << r.allocations << ", \"allocated_bytes_per_frame\": " << r.bytes << " }";
+        out << (i + 1 < results.size() ? "," : "") << endl;
+    }
+    out << "  ]" << endl;
+    out << "}" << endl;
+}
+
+static void write_csv(ostream& out, const vector<result>& results)
+{
+    out << "block,width,height,frames,fps,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,allocations_per_frame,allocated_bytes_per_frame" << endl;
+    for (auto&& r : results)
+    {
+        out << r.block << "," << r.width << "," << r.height << "," << r.frames << "," << r.throughput << ","
+            << r.mean << "," << r.p50 << "," << r.p90 << "," << r.p99 << "," << r.max << ",";
+        if (r.allocations < 0)
+            out << ",";
+        else
+            out << r.allocations << "," << r.bytes;
+        out << endl;
+    }
+}
+
+int main(int argc, char** argv) try
+{
+    CmdLine cmd("librealsense rs-processing-benchmark tool", ' ', RS2_API_VERSION_STR);
+    ValueArg<string> file_arg("i", "input", "Recording to read the frames from, instead of generating them", false, "", "path");
+    MultiArg<string> resolution_arg("r", "resolution", "Resolution of the generated frames, can be repeated (default: 424x240, 640x480, 848x480, 1280x720)", false, "WxH");
+    MultiArg<string> block_arg("b", "block", "Processing block to benchmark, can be repeated (default: all)", false, "name");
+    ValueArg<int> frames_arg("n", "frames", "Number of frames measured per block", false, 300, "frames");
+    ValueArg<int> warmup_arg("w", "warmup", "Number of frames processed before measuring", false, 10, "frames");
+    vector<string> formats{ "json", "csv" };
+    ValuesConstraint<string> format_constraint(formats);
+    ValueArg<string> format_arg("f", "format", "Output format", false, "json", &format_constraint);
+    ValueArg<string> output_arg("o", "output", "File to write the results to (default: standard output)", false, "", "path");
+    SwitchArg list_arg("l", "list", "List the processing blocks and exit");
+    cmd.add(file_arg);
+    cmd.add(resolution_arg);
+    cmd.add(block_arg);
+    cmd.add(frames_arg);
+    cmd.add(warmup_arg);
+    cmd.add(format_arg);
+    cmd.add(output_arg);
+    cmd.add(list_arg);
+    cmd.parse(argc, argv);
+
+    auto tests = get_tests();
+    if (list_arg.getValue())
+    {
+        for (auto&& test : tests)
+            cout << test.name << endl;
+        return EXIT_SUCCESS;
+    }
+
+    if (!block_arg.getValue().empty())
+    {
+        auto& names = block_arg.getValue();
+        for (auto&& name : names)
+        {
+            if (none_of(tests.begin(), tests.end(), [&](const block_test& t) { return t.name == name; }))
+                throw runtime_error("Unknown processing block " + name + ", see --list");
+        }
+        tests.erase(remove_if(tests.begin(), tests.end(), [&](const block_test& t)
+        {
+            return find(names.begin(), names.end(), t.name) == names.end();
+        }), tests.end());
+    }
+
+    auto frames = max(frames_arg.getValue(), 1);
+    auto warmup = max(warmup_arg.getValue(), 0);
+
+    vector<pair<int, int>> resolutions;
+    for (auto&& r : resolution_arg.getValue())
+    {
+        int width, height;
+        if (!parse_resolution(r, width, height))
+            throw runtime_error("Invalid resolution " + r + ", expected <width>x<height> with an even width");
+        resolutions.emplace_back(width, height);
+    }
+    if (resolutions.empty())
+        resolutions = { { 424, 240 }, { 640, 480 }, { 848, 480 }, { 1280, 720 } };
+
+    // A few distinct frames are enough to keep the blocks from processing the same one over and over
+    const int distinct_frames = 8;
+
+    vector<result> results;
+    auto benchmark = [&](const input_frames& input)
+    {
+        for (auto&& test : tests)
+        {
+            cerr << test.name << " " << input.width << "x" << input.height << endl;
+            switch (test.input)
+            {
+            case input_kind::depth:
+                if (!input.depth.empty())
+                    results.push_back(run(test, input.depth, input.width, input.height, frames, warmup));
+                break;
+            case input_kind::depth_color:
+                if (!input.depth_color.empty())
+                    results.push_back(run(test, input.depth_color, input.width, input.height, frames, warmup));
+                break;
+            case input_kind::yuyv:
+                if (!input.yuyv.empty())
+                    results.push_back(run(test, input.yuyv, input.width, input.height, frames, warmup));
+                break;
+            }
+        }
+    };
+
+    string source = "synthetic";
+    if (file_arg.isSet())
+    {
+        source = file_arg.getValue();
+        auto input = read_frames(source, min(frames + warmup, 64));
+        if (input.depth.empty() && input.yuyv.empty())
+            throw runtime_error("No depth or YUYV frames in " + source);
+        benchmark(input);
+    }
+    else
+    {
+        for (auto&& resolution : resolutions)
+            benchmark(generate_frames(resolution.first, resolution.second, distinct_frames));
+    }
+
+    ofstream file;
+    if (output_arg.isSet())
+    {
+        file.open(output_arg.getValue());
+        if (!file)
+            throw runtime_error("Could not open " + output_arg.getValue());
+    }
+    ostream& out = output_arg.isSet() ? file : cout;
+    out << fixed << setprecision(3);
+    if (format_arg.getValue() == "csv")
+        write_csv(out, results);
+    else
+        write_json(out, source, frames, results);
+
+    return EXIT_SUCCESS;
+}
+catch (const error & e)
+{
+    cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    " << e.what() << endl;
+    return EXIT_FAILURE;
+}
+catch (const exception& e)
+{
+    cerr << e.what() << endl;
+    return EXIT_FAILURE;
+}
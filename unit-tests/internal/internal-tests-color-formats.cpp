@@ -0,0 +1,218 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <cstdlib>
+#include <vector>
+#include "./../src/proc/color-formats-converter.h"
+#include "./../src/image.h"
+
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "./../third-party/stb_image_write.h"
+
+using namespace librealsense;
+
+typedef void(*unpack_func)(rs2_format, byte * const[], const byte *, int, int, simd_isa);
+
+static void compare_simd_kernels(unpack_func unpack, const std::vector<rs2_format>& formats)
+{
+    // Widths that exercise full SIMD blocks as well as the 16 pixel remainders handled by the narrower kernels
+    for (auto w : { 16, 48, 64, 80, 424, 640, 1296 })
+    {
+        const int h = 2;
+        std::vector<byte> src(w * h * 2);
+        for (auto&& b : src) b = static_cast<byte>(rand());
+
+        for (auto format : formats)
+        {
+            CAPTURE(w);
+            CAPTURE(format);
+            auto size = w * h * get_image_bpp(format) / 8;
+
+            std::vector<byte> generic(size), ssse3(size);
+            byte * const generic_dst[] = { generic.data() };
+            byte * const ssse3_dst[] = { ssse3.data() };
+            unpack(format, generic_dst, src.data(), w, h, simd_isa_none);
+            unpack(format, ssse3_dst, src.data(), w, h, simd_isa_ssse3);
+
+            // The fixed-point SIMD conversion may round differently than the generic code
+            for (auto i = 0; i < size; i++)
+                REQUIRE(std::abs(generic[i] - ssse3[i]) <= 2);
+
+            // Wider kernels (when available) must produce exactly the same output as the SSSE3 one
+            for (auto isa : { simd_isa_avx2, simd_isa_avx512 })
+            {
+                if (isa > get_simd_isa())
+                    continue;
+
+                CAPTURE(isa);
+                std::vector<byte> wide(size);
+                byte * const wide_dst[] = { wide.data() };
+                unpack(format, wide_dst, src.data(), w, h, isa);
+                REQUIRE(wide == ssse3);
+            }
+        }
+    }
+}
+
+TEST_CASE("unpack_yuy2_simd", "[code]")
+{
+    compare_simd_kernels(unpack_yuy2, { RS2_FORMAT_Y8, RS2_FORMAT_Y16, RS2_FORMAT_RGB8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGR8, RS2_FORMAT_BGRA8 });
+}
+
+TEST_CASE("unpack_uyvy_simd", "[code]")
+{
+    compare_simd_kernels(unpack_uyvy, { RS2_FORMAT_RGB8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGR8, RS2_FORMAT_BGRA8 });
+}
+
+TEST_CASE("unpack_mjpeg_yuyv", "[code]")
+{
+    // Odd widths end every row with a lone pixel, written as Y and U
+    for (auto w : { 64, 63 })
+    {
+        CAPTURE(w);
+        const int h = 8;
+        std::vector<byte> rgb(w * h * 3);
+        for (auto i = 0; i < w * h * 3; i++)
+            rgb[i] = static_cast<byte>(rand());
+        std::vector<byte> jpeg;
+        REQUIRE(stbi_write_jpg_to_func([](void* context, void* data, int size) {
+            auto bytes = static_cast<byte*>(data);
+            static_cast<std::vector<byte>*>(context)->insert(static_cast<std::vector<byte>*>(context)->end(), bytes, bytes + size);
+        }, &jpeg, w, h, 3, rgb.data(), 95));
+
+        std::vector<byte> decoded(w * h * 3), yuyv(w * h * 2, 0xee);
+        byte * const decoded_dst[] = { decoded.data() };
+        byte * const yuyv_dst[] = { yuyv.data() };
+        unpack_mjpeg(RS2_FORMAT_RGB8, decoded_dst, jpeg.data(), w, h, static_cast<int>(jpeg.size()));
+        unpack_mjpeg(RS2_FORMAT_YUYV, yuyv_dst, jpeg.data(), w, h, static_cast<int>(jpeg.size()));
+
+        // Every row is packed on its own, pairs never straddle two rows
+        for (auto y = 0; y < h; y++)
+        {
+            for (auto x = 0; x < w; x++)
+            {
+                CAPTURE(x);
+                CAPTURE(y);
+                auto p = &decoded[(y * w + x) * 3];
+                auto first = &decoded[(y * w + (x & ~1)) * 3];
+                auto luma = (19595 * p[0] + 38470 * p[1] + 7471 * p[2] + 32768) >> 16;
+                auto u = clamp_val(128 + ((-11059 * first[0] - 21709 * first[1] + 32768 * first[2] + 32768) >> 16), 0, 255);
+                auto v = clamp_val(128 + ((32768 * first[0] - 27439 * first[1] - 5329 * first[2] + 32768) >> 16), 0, 255);
+                REQUIRE(yuyv[(y * w + x) * 2] == luma);
+                REQUIRE(yuyv[(y * w + x) * 2 + 1] == ((x & 1) ? v : u));
+            }
+        }
+    }
+}
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+#include <cstdio>
+#include <jpeglib.h>
+#include "./../src/environment.h"
+
+// Noise by default, or smooth gradients that survive the compression without saturating the color conversions
+static std::vector<byte> encode_jpeg(int w, int h, int h_sampling, int v_sampling, int restart_rows, int restart_mcus, bool gradient = false)
+{
+    jpeg_compress_struct info;
+    jpeg_error_mgr error;
+    info.err = jpeg_std_error(&error);
+    jpeg_create_compress(&info);
+
+    unsigned char* data = nullptr;
+    unsigned long size = 0;
+    jpeg_mem_dest(&info, &data, &size);
+    info.image_width = w;
+    info.image_height = h;
+    info.input_components = 3;
+    info.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&info);
+    info.comp_info[0].h_samp_factor = h_sampling;
+    info.comp_info[0].v_samp_factor = v_sampling;
+    info.restart_in_rows = restart_rows;
+    info.restart_interval = restart_mcus;
+
+    jpeg_start_compress(&info, TRUE);
+    std::vector<byte> row(w * 3);
+    while (info.next_scanline < info.image_height)
+    {
+        for (int x = 0; x < w; x++)
+            for (int c = 0; c < 3; c++)
+                row[x * 3 + c] = static_cast<byte>(gradient ? (x * (c + 1) + info.next_scanline * (3 - c)) : rand());
+        JSAMPROW rows[] = { row.data() };
+        jpeg_write_scanlines(&info, rows, 1);
+    }
+    jpeg_finish_compress(&info);
+    jpeg_destroy_compress(&info);
+
+    std::vector<byte> jpeg(data, data + size);
+    free(data);
+    return jpeg;
+}
+
+TEST_CASE("mjpeg_decoder_bands", "[code]")
+{
+    struct { int w, h, h_sampling, v_sampling, restart_rows, restart_mcus; } images[] = {
+        { 640, 480, 2, 1, 1, 0 },   // 4:2:2, a restart marker every row of MCUs
+        { 1280, 720, 2, 2, 1, 0 },  // 4:2:0, the bands are decoded with the rows surrounding them
+        { 424, 240, 2, 1, 0, 7 },   // Restart intervals not aligned to rows of MCUs
+        { 333, 201, 1, 1, 2, 0 },   // Partial MCUs
+        { 640, 480, 2, 1, 0, 0 },   // No restart markers
+    };
+
+    for (auto&& image : images)
+    {
+        CAPTURE(image.w);
+        CAPTURE(image.h);
+        auto jpeg = encode_jpeg(image.w, image.h, image.h_sampling, image.v_sampling, image.restart_rows, image.restart_mcus);
+
+        jpeg_restart_layout layout;
+        REQUIRE(parse_jpeg_restart_layout(jpeg.data(), jpeg.size(), layout) == (image.restart_rows || image.restart_mcus));
+
+        for (auto format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGRA8, RS2_FORMAT_YUYV })
+        {
+            CAPTURE(format);
+            auto size = image.w * image.h * get_image_bpp(format) / 8;
+            std::vector<byte> results[2] = { std::vector<byte>(size), std::vector<byte>(size) };
+            for (auto threads : { 1, 4 })
+            {
+                environment::get_instance().set_processing_threads(threads);
+                mjpeg_decoder decoder;
+                REQUIRE(decoder.decode(format, results[threads == 1 ? 0 : 1].data(), jpeg.data(), jpeg.size(), image.w, image.h));
+            }
+            REQUIRE(results[0] == results[1]);
+        }
+    }
+    environment::get_instance().set_processing_threads(0);
+}
+
+TEST_CASE("mjpeg_decoder_matches_fallback", "[code]")
+{
+    // libjpeg-turbo and stb_image upsample the chroma differently, compare images where it makes no difference
+    const int h = 32;
+    for (auto w : { 64, 63 })
+    {
+        for (auto sampling : { 1, 2 })
+        {
+            CAPTURE(w);
+            CAPTURE(sampling);
+            auto jpeg = encode_jpeg(w, h, sampling, 1, 0, 0, true);
+            for (auto format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGRA8, RS2_FORMAT_YUYV })
+            {
+                CAPTURE(format);
+                auto size = w * h * get_image_bpp(format) / 8;
+                std::vector<byte> turbo(size), fallback(size);
+                byte * const fallback_dst[] = { fallback.data() };
+
+                mjpeg_decoder decoder;
+                REQUIRE(decoder.decode(format, turbo.data(), jpeg.data(), jpeg.size(), w, h));
+                unpack_mjpeg(format, fallback_dst, jpeg.data(), w, h, static_cast<int>(jpeg.size()));
+
+                for (auto i = 0; i < size; i++)
+                    REQUIRE(std::abs(turbo[i] - fallback[i]) <= 3);
+            }
+        }
+    }
+}
+#endif
@@ -0,0 +1,134 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include "./../src/device-cache.h"
+
+using namespace librealsense;
+
+TEST_CASE("device_cache_round_trip", "[code]")
+{
+    const std::string path = "internal-tests-device-cache.cache";
+    std::remove(path.c_str());
+    const std::vector<uint8_t> descriptor = { 1, 2, 3, 4, 5 };
+    const std::vector<uint8_t> table = { 10, 20, 30 };
+    std::vector<uint8_t> value;
+
+    {
+        device_cache cache(path, descriptor);
+        CHECK_FALSE(cache.get("table", value));
+        cache.put("table", table);
+        cache.put("empty", {});
+        REQUIRE(cache.get("table", value));
+        CHECK(value == table);
+    }
+
+    // Another process opening the same device and firmware reads the values back
+    {
+        device_cache cache(path, descriptor);
+        REQUIRE(cache.get("table", value));
+        CHECK(value == table);
+        REQUIRE(cache.get("empty", value));
+        CHECK(value.empty());
+    }
+
+    // A different descriptor makes the values stale
+    {
+        auto changed = descriptor;
+        changed.back() = 6;
+        device_cache cache(path, changed);
+        CHECK_FALSE(cache.get("table", value));
+        cache.put("table", { 7 });
+    }
+    {
+        device_cache cache(path, descriptor);
+        CHECK_FALSE(cache.get("table", value));
+        cache.put("table", table);
+        cache.clear();
+        CHECK_FALSE(cache.get("table", value));
+    }
+    {
+        device_cache cache(path, descriptor);
+        CHECK_FALSE(cache.get("table", value));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("device_cache_ignores_corrupt_files", "[code]")
+{
+    const std::string path = "internal-tests-device-cache-corrupt.cache";
+    const std::vector<uint8_t> descriptor = { 9, 8, 7 };
+    {
+        device_cache cache(path, descriptor);
+        cache.put("a", { 1, 2, 3, 4 });
+        cache.put("b", { 5, 6 });
+    }
+
+    // Cut the file in the middle of the last value
+    std::ifstream in(path, std::ios_base::binary);
+    std::vector<char> content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    REQUIRE(content.size() > 1);
+    std::ofstream out(path, std::ios_base::binary | std::ios_base::trunc);
+    out.write(content.data(), content.size() - 1);
+    out.close();
+
+    std::vector<uint8_t> value;
+    {
+        device_cache cache(path, descriptor);
+        CHECK_FALSE(cache.get("a", value));
+        CHECK_FALSE(cache.get("b", value));
+    }
+
+    std::ofstream garbage(path, std::ios_base::binary | std::ios_base::trunc);
+    garbage << "not a cache";
+    garbage.close();
+    {
+        device_cache cache(path, descriptor);
+        CHECK_FALSE(cache.get("a", value));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("device_cache_refresh", "[code]")
+{
+    const std::string path = "internal-tests-device-cache-refresh.cache";
+    std::remove(path.c_str());
+    const std::vector<uint8_t> descriptor = { 1, 2, 3 };
+    const std::vector<uint8_t> table = { 10, 20, 30 };
+    const std::vector<uint8_t> recalibrated = { 11, 21, 31 };
+    std::vector<uint8_t> value;
+
+    {
+        device_cache cache(path, descriptor);
+        cache.put("table", table);
+
+        // The device still holds the cached value
+        CHECK_FALSE(cache.refresh("table", table, cache.get_generation()));
+
+        // Another tool wrote the calibration, the descriptor did not change
+        CHECK(cache.refresh("table", recalibrated, cache.get_generation()));
+        REQUIRE(cache.get("table", value));
+        CHECK(value == recalibrated);
+    }
+
+    // The refreshed value is what the next process reads
+    {
+        device_cache cache(path, descriptor);
+        REQUIRE(cache.get("table", value));
+        CHECK(value == recalibrated);
+
+        // A value read before the library wrote the calibration must not be stored back
+        auto generation = cache.get_generation();
+        cache.clear();
+        CHECK_FALSE(cache.refresh("table", table, generation));
+        CHECK_FALSE(cache.get("table", value));
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,261 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#ifdef RS2_USE_V4L2_BACKEND
+
+#include "catch/catch.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "./../src/linux/udev-device-watcher.h"
+
+using namespace librealsense::platform;
+
+namespace
+{
+    std::string make_kernel_uevent(const std::string& action, const std::string& subsystem, const std::string& devpath)
+    {
+        std::string msg = action + "@" + devpath;
+        msg.push_back('\0');
+        for (auto&& property : { "ACTION=" + action, "DEVPATH=" + devpath, "SUBSYSTEM=" + subsystem, std::string("SEQNUM=42") })
+        {
+            msg += property;
+            msg.push_back('\0');
+        }
+        return msg;
+    }
+
+    std::string make_udev_uevent(const std::string& action, const std::string& subsystem, const std::string& devpath)
+    {
+        std::string properties;
+        for (auto&& property : { "ACTION=" + action, "DEVPATH=" + devpath, "SUBSYSTEM=" + subsystem })
+        {
+            properties += property;
+            properties.push_back('\0');
+        }
+
+        const uint32_t header_size = 40;
+        std::string msg(header_size, '\0');
+        memcpy(&msg[0], "libudev", 8);
+        uint32_t fields[] = { 0xcafefeed, header_size, header_size, static_cast<uint32_t>(properties.size()) };
+        memcpy(&msg[8], fields, sizeof(fields));
+        return msg + properties;
+    }
+
+    // Stands in for sysfs - the scanners return whatever devices are currently "connected"
+    struct fake_sysfs
+    {
+        std::mutex mutex;
+        std::vector<uvc_device_info> uvc;
+        std::vector<usb_device_info> usb;
+        std::vector<hid_device_info> hid;
+        std::atomic<int> uvc_scans{ 0 }, usb_scans{ 0 }, hid_scans{ 0 };
+
+        device_scanners scanners()
+        {
+            return {
+                [this]() { uvc_scans++; std::lock_guard<std::mutex> lock(mutex); return uvc; },
+                [this]() { usb_scans++; std::lock_guard<std::mutex> lock(mutex); return usb; },
+                [this]() { hid_scans++; std::lock_guard<std::mutex> lock(mutex); return hid; }
+            };
+        }
+    };
+
+    uvc_device_info make_uvc_info(const std::string& path)
+    {
+        uvc_device_info info;
+        info.id = path;
+        info.device_path = path;
+        info.vid = 0x8086;
+        info.pid = 0x0b07;
+        return info;
+    }
+
+    template<class T>
+    bool wait_for(T pred, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000))
+    {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!pred())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST_CASE("parse_uevent", "[code]")
+{
+    uevent ev;
+    auto kernel = make_kernel_uevent("add", "video4linux", "/devices/pci0000:00/usb2/2-1/2-1:1.0/video4linux/video0");
+    REQUIRE(parse_uevent(kernel.data(), kernel.size(), ev));
+    CHECK(ev.action == "add");
+    CHECK(ev.subsystem == "video4linux");
+    CHECK(ev.devpath == "/devices/pci0000:00/usb2/2-1/2-1:1.0/video4linux/video0");
+    CHECK(get_uevent_scope(ev) == uevent_scope_uvc);
+
+    auto udev = make_udev_uevent("remove", "iio", "/devices/platform/HID-SENSOR-200073.3.auto/iio:device1");
+    REQUIRE(parse_uevent(udev.data(), udev.size(), ev));
+    CHECK(ev.action == "remove");
+    CHECK(ev.subsystem == "iio");
+    CHECK(get_uevent_scope(ev) == uevent_scope_hid);
+
+    auto custom_hid = make_kernel_uevent("add", "platform", "/devices/pci0000:00/HID-SENSOR-2000e1.6.auto");
+    REQUIRE(parse_uevent(custom_hid.data(), custom_hid.size(), ev));
+    CHECK(get_uevent_scope(ev) == uevent_scope_hid);
+
+    auto usb = make_kernel_uevent("bind", "usb", "/devices/pci0000:00/usb2/2-1");
+    REQUIRE(parse_uevent(usb.data(), usb.size(), ev));
+    CHECK(get_uevent_scope(ev) == uevent_scope_usb);
+
+    auto other = make_kernel_uevent("change", "power_supply", "/devices/LNXSYSTM:00/AC");
+    REQUIRE(parse_uevent(other.data(), other.size(), ev));
+    CHECK(get_uevent_scope(ev) == uevent_scope_none);
+
+    // Truncated or foreign messages
+    std::string garbage("no header here");
+    CHECK_FALSE(parse_uevent(garbage.data(), garbage.size(), ev));
+    CHECK_FALSE(parse_uevent(udev.data(), 20, ev));
+    auto bad_offset = udev;
+    uint32_t off = 4096;
+    memcpy(&bad_offset[16], &off, sizeof(off));
+    CHECK_FALSE(parse_uevent(bad_offset.data(), bad_offset.size(), ev));
+}
+
+TEST_CASE("udev_device_watcher_rescans_affected_scope", "[code]")
+{
+    int sockets[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, sockets) == 0);
+    auto send_uevent = [&](const std::string& msg) { REQUIRE(send(sockets[1], msg.data(), msg.size(), 0) == ssize_t(msg.size())); };
+
+    fake_sysfs sysfs;
+    sysfs.uvc.push_back(make_uvc_info("/sys/devices/usb2/2-1/2-1:1.0"));
+
+    {
+        udev_device_watcher watcher(sockets[0], sysfs.scanners(), std::chrono::milliseconds(20));
+        REQUIRE(sysfs.uvc_scans == 1);
+        REQUIRE(sysfs.usb_scans == 1);
+        REQUIRE(sysfs.hid_scans == 1);
+
+        // Queries are served from the cache
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(watcher.get_devices().uvc_devices.size() == 1);
+        REQUIRE(sysfs.uvc_scans == 1);
+
+        std::mutex m;
+        std::condition_variable cv;
+        int notifications = 0;
+        backend_device_group last_old, last_curr;
+        watcher.start([&](backend_device_group old, backend_device_group curr)
+        {
+            std::lock_guard<std::mutex> lock(m);
+            last_old = old;
+            last_curr = curr;
+            notifications++;
+            cv.notify_all();
+        });
+
+        // A burst of events of a hot-plug is handled with a single rescan of the affected part only
+        {
+            std::lock_guard<std::mutex> lock(sysfs.mutex);
+            sysfs.uvc.push_back(make_uvc_info("/sys/devices/usb2/2-2/2-2:1.0"));
+        }
+        for (auto node : { "video2", "video3", "video4", "video5" })
+            send_uevent(make_kernel_uevent("add", "video4linux", std::string("/devices/usb2/2-2/2-2:1.0/video4linux/") + node));
+
+        {
+            std::unique_lock<std::mutex> lock(m);
+            REQUIRE(cv.wait_for(lock, std::chrono::seconds(2), [&]() { return notifications == 1; }));
+            CHECK(last_old.uvc_devices.size() == 1);
+            CHECK(last_curr.uvc_devices.size() == 2);
+        }
+        CHECK(sysfs.uvc_scans == 2);
+        CHECK(sysfs.usb_scans == 1);
+        CHECK(sysfs.hid_scans == 1);
+        CHECK(watcher.get_devices().uvc_devices.size() == 2);
+
+        // Events that do not change the enumeration are not reported
+        send_uevent(make_udev_uevent("change", "iio", "/devices/platform/HID-SENSOR-200076.4.auto/iio:device2"));
+        REQUIRE(wait_for([&]() { return sysfs.hid_scans == 2; }));
+        CHECK(sysfs.uvc_scans == 2);
+
+        // Unrelated events are ignored altogether
+        send_uevent(make_kernel_uevent("change", "power_supply", "/devices/LNXSYSTM:00/AC"));
+
+        {
+            std::lock_guard<std::mutex> lock(sysfs.mutex);
+            sysfs.uvc.erase(sysfs.uvc.begin());
+        }
+        send_uevent(make_kernel_uevent("remove", "video4linux", "/devices/usb2/2-1/2-1:1.0/video4linux/video0"));
+        {
+            std::unique_lock<std::mutex> lock(m);
+            REQUIRE(cv.wait_for(lock, std::chrono::seconds(2), [&]() { return notifications == 2; }));
+            CHECK(last_curr.uvc_devices.size() == 1);
+        }
+        CHECK(sysfs.uvc_scans == 3);
+        CHECK(sysfs.usb_scans == 1);
+        CHECK(sysfs.hid_scans == 2);
+
+        // The cache keeps following the devices once the watcher is stopped, without notifying
+        watcher.stop();
+        {
+            std::lock_guard<std::mutex> lock(sysfs.mutex);
+            sysfs.uvc.clear();
+        }
+        send_uevent(make_kernel_uevent("remove", "video4linux", "/devices/usb2/2-2/2-2:1.0/video4linux/video2"));
+        REQUIRE(wait_for([&]() { return watcher.get_devices().uvc_devices.empty(); }));
+        std::lock_guard<std::mutex> lock(m);
+        CHECK(notifications == 2);
+    }
+
+    ::close(sockets[1]);
+}
+
+TEST_CASE("udev_device_watcher_rescans_without_events", "[code]")
+{
+    // A socket that opens fine but never delivers anything, as inside a container without the host network namespace
+    int sockets[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, sockets) == 0);
+
+    fake_sysfs sysfs;
+    {
+        udev_device_watcher watcher(sockets[0], sysfs.scanners(), std::chrono::milliseconds(20), std::chrono::milliseconds(50));
+
+        std::atomic<int> notifications{ 0 };
+        watcher.start([&](backend_device_group, backend_device_group) { notifications++; });
+
+        // Hot-plug is still detected by the periodic rescans
+        {
+            std::lock_guard<std::mutex> lock(sysfs.mutex);
+            sysfs.uvc.push_back(make_uvc_info("/sys/devices/usb2/2-1/2-1:1.0"));
+        }
+        REQUIRE(wait_for([&]() { return notifications == 1; }));
+        CHECK(watcher.get_devices().uvc_devices.size() == 1);
+        CHECK(sysfs.usb_scans > 1);
+        CHECK(sysfs.hid_scans > 1);
+
+        // Once events arrive, only they trigger rescans
+        auto msg = make_kernel_uevent("change", "power_supply", "/devices/LNXSYSTM:00/AC");
+        REQUIRE(send(sockets[1], msg.data(), msg.size(), 0) == ssize_t(msg.size()));
+        REQUIRE(wait_for([&]() {
+            int usb_scans = sysfs.usb_scans;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            return sysfs.usb_scans == usb_scans;
+        }));
+        int usb_scans = sysfs.usb_scans;
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        CHECK(sysfs.usb_scans == usb_scans);
+        CHECK(notifications == 1);
+    }
+
+    ::close(sockets[1]);
+}
+
+#endif
@@ -0,0 +1,128 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#ifdef RS2_USE_V4L2_BACKEND
+
+#include "catch/catch.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include "./../src/linux/epoll-reactor.h"
+
+using namespace librealsense::platform;
+
+namespace
+{
+    // A pipe whose read end is served by the reactor, every write is one event
+    struct test_pipe
+    {
+        int fds[2];
+        test_pipe() { REQUIRE(pipe(fds) == 0); }
+        ~test_pipe() { close(fds[0]); close(fds[1]); }
+
+        int read_end() const { return fds[0]; }
+        void signal() { char c = 1; REQUIRE(write(fds[1], &c, 1) == 1); }
+        void drain() { char c; REQUIRE(read(fds[0], &c, 1) == 1); }
+    };
+
+    struct gate
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool open = false;
+
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            open = true;
+            cv.notify_all();
+        }
+
+        bool wait(std::chrono::milliseconds timeout = std::chrono::milliseconds(2000))
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            return cv.wait_for(lock, timeout, [this]() { return open; });
+        }
+    };
+
+    const std::chrono::milliseconds no_idle(60000);
+}
+
+TEST_CASE("epoll_reactor_add_remove_in_flight", "[code]")
+{
+    auto reactor = epoll_reactor::create(2);
+    test_pipe busy, other;
+    gate entered, resume, other_ready;
+    std::atomic<int> busy_calls{ 0 };
+
+    reactor->add(busy.read_end(), [&]()
+    {
+        busy.drain();
+        busy_calls++;
+        entered.release();
+        resume.wait();
+    }, nullptr, no_idle);
+
+    busy.signal();
+    REQUIRE(entered.wait());
+
+    // Registering another descriptor while a handler runs, it is served by the second worker
+    reactor->add(other.read_end(), [&]() { other.drain(); other_ready.release(); }, nullptr, no_idle);
+    other.signal();
+    REQUIRE(other_ready.wait());
+
+    // remove() waits for the handler in flight to return
+    auto removed = std::async(std::launch::async, [&]() { reactor->remove(busy.read_end()); });
+    CHECK(removed.wait_for(std::chrono::milliseconds(100)) == std::future_status::timeout);
+    resume.release();
+    REQUIRE(removed.wait_for(std::chrono::milliseconds(2000)) == std::future_status::ready);
+
+    // Nothing is dispatched to a removed descriptor
+    busy.signal();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CHECK(busy_calls == 1);
+
+    // A handler may remove its own descriptor
+    gate self_removed;
+    reactor->remove(other.read_end());
+    reactor->add(other.read_end(), [&]()
+    {
+        other.drain();
+        reactor->remove(other.read_end());
+        self_removed.release();
+    }, nullptr, no_idle);
+    other.signal();
+    REQUIRE(self_removed.wait());
+    reactor->remove(other.read_end());
+}
+
+TEST_CASE("epoll_reactor_destroyed_from_handler", "[code]")
+{
+    for (unsigned threads : { 1u, 3u })
+    {
+        auto reactor = epoll_reactor::create(threads);
+        std::weak_ptr<epoll_reactor> weak = reactor;
+        test_pipe p;
+        gate done;
+
+        // The handler drops the last reference and the reactor outlives it
+        reactor->add(p.read_end(), [&]()
+        {
+            p.drain();
+            reactor.reset();
+            done.release();
+        }, nullptr, no_idle);
+
+        p.signal();
+        REQUIRE(done.wait());
+        CHECK(weak.expired());
+        // Leave the reactor time to finish the dispatch and shut down before the pipe is closed
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+#endif
@@ -0,0 +1,75 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "./../src/global_timestamp_reader.h"
+
+using namespace librealsense;
+
+TEST_CASE("seqlock_readers_see_whole_values", "[code]")
+{
+    // Every published value has all of its fields equal, a torn read would mix two of them
+    struct wide { double a, b, c, d, e; };
+    seqlock<wide> published(wide{ 0, 0, 0, 0, 0 });
+
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+    std::atomic<long long> reads(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i)
+    {
+        readers.emplace_back([&]()
+        {
+            double last = 0;
+            while (!done)
+            {
+                auto v = published.load();
+                if (v.a != v.b || v.a != v.c || v.a != v.d || v.a != v.e || v.a < last)
+                    torn++;
+                last = v.a;
+                reads++;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 200000; ++i)
+    {
+        double x = i;
+        published.store(wide{ x, x, x, x, x });
+    }
+    done = true;
+    for (auto& t : readers)
+        t.join();
+
+    CHECK(torn == 0);
+    CHECK(reads > 0);
+    CHECK(published.load().e == 200000.);
+}
+
+TEST_CASE("linear_coefficients_follow_drifting_clock", "[code]")
+{
+    // The device clock runs 50 ppm slow and started 12345 ms after the host clock
+    const double drift = 1 - 50e-6, offset = 12345;
+    CLinearCoefficients coefs(15);
+
+    for (int i = 0; i < 30; ++i)
+    {
+        double hw = i * 1000.;
+        coefs.add_value(CSample(hw, hw / drift + offset));
+    }
+    CHECK(coefs.is_full());
+    CHECK(coefs.size() >= 15);
+    CHECK((coefs.get_slope() - 1) * 1e6 == Approx(50).epsilon(0.001));
+
+    // More than a second after the last sample, the latest fit applies in full
+    double hw = 31000;
+    CHECK(std::fabs(coefs.calc_value(hw) - (hw / drift + offset)) < 1e-3);
+
+    coefs.reset();
+    CHECK(coefs.size() == 0);
+    CHECK_FALSE(coefs.is_full());
+}
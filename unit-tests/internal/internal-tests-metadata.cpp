@@ -0,0 +1,122 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include "./../src/metadata-parser.h"
+
+using namespace librealsense;
+
+namespace
+{
+    // Lays out the metadata of a frame in the format of md_constant_parser - attribute and value pairs
+    void set_constant_metadata(frame& f, const std::vector<std::pair<rs2_frame_metadata_value, rs2_metadata_type>>& pairs)
+    {
+        f.additional_data.metadata_blob.fill(0xff);
+        auto pos = f.additional_data.metadata_blob.data();
+        for (auto& p : pairs)
+        {
+            memcpy(pos, &p.first, sizeof(p.first));
+            memcpy(pos + sizeof(p.first), &p.second, sizeof(p.second));
+            pos += sizeof(p.first) + sizeof(p.second);
+        }
+        f.additional_data.metadata_size = static_cast<uint32_t>(pos - f.additional_data.metadata_blob.data());
+    }
+}
+
+TEST_CASE("metadata_parser_map", "[code]")
+{
+    metadata_parser_map parsers;
+    CHECK_FALSE(parsers.contains(RS2_FRAME_METADATA_FRAME_COUNTER));
+    CHECK(parsers.find(RS2_FRAME_METADATA_FRAME_COUNTER) == nullptr);
+
+    auto parser = std::make_shared<md_constant_parser>(RS2_FRAME_METADATA_FRAME_COUNTER);
+    parsers[RS2_FRAME_METADATA_FRAME_COUNTER] = parser;
+    CHECK(parsers.contains(RS2_FRAME_METADATA_FRAME_COUNTER));
+    CHECK(parsers.find(RS2_FRAME_METADATA_FRAME_COUNTER) == parser);
+    CHECK_FALSE(parsers.contains(RS2_FRAME_METADATA_ACTUAL_FPS));
+
+    // The internal attributes share the table
+    auto width = (rs2_frame_metadata_value)RS2_FRAME_METADATA_WIDTH;
+    parsers[width] = parser;
+    CHECK(parsers.contains(width));
+
+    auto out_of_range = (rs2_frame_metadata_value)frame_metadata_internal::RS2_FRAME_METADATA_COUNT;
+    CHECK_FALSE(parsers.contains(out_of_range));
+    CHECK_THROWS(parsers[out_of_range]);
+}
+
+TEST_CASE("get_all_frame_metadata", "[code]")
+{
+    frame f;
+    rs2_frame_metadata_value attributes[rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT];
+    rs2_metadata_type values[rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT];
+
+    // No parsers - no metadata
+    CHECK(f.get_all_frame_metadata(attributes, values, rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT) == 0);
+
+    f.metadata_parsers = md_constant_parser::create_metadata_parser_map();
+    set_constant_metadata(f, { { RS2_FRAME_METADATA_ACTUAL_EXPOSURE, 33 },
+                               { RS2_FRAME_METADATA_FRAME_COUNTER, 1234567890123ll },
+                               { RS2_FRAME_METADATA_GAIN_LEVEL, -16 } });
+
+    auto count = f.get_all_frame_metadata(attributes, values, rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT);
+    REQUIRE(count == 3);
+    // In ascending order of the attributes, regardless of their order in the blob
+    CHECK(attributes[0] == RS2_FRAME_METADATA_FRAME_COUNTER);   CHECK(values[0] == 1234567890123ll);
+    CHECK(attributes[1] == RS2_FRAME_METADATA_ACTUAL_EXPOSURE); CHECK(values[1] == 33);
+    CHECK(attributes[2] == RS2_FRAME_METADATA_GAIN_LEVEL);      CHECK(values[2] == -16);
+
+    // The bulk query agrees with the single attribute queries
+    for (int i = 0; i < rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT; ++i)
+    {
+        auto attribute = static_cast<rs2_frame_metadata_value>(i);
+        auto it = std::find(attributes, attributes + count, attribute);
+        CAPTURE(attribute);
+        REQUIRE(f.supports_frame_metadata(attribute) == (it != attributes + count));
+        if (it != attributes + count)
+            CHECK(f.get_frame_metadata(attribute) == values[it - attributes]);
+    }
+
+    // A short buffer receives the first attributes, the count is still of all of them
+    rs2_frame_metadata_value first = rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT;
+    rs2_metadata_type first_value = 0;
+    CHECK(f.get_all_frame_metadata(&first, &first_value, 1) == 3);
+    CHECK(first == RS2_FRAME_METADATA_FRAME_COUNTER);
+    CHECK(first_value == 1234567890123ll);
+    CHECK(f.get_all_frame_metadata(nullptr, nullptr, 0) == 3);
+}
+
+TEST_CASE("metadata_attribute_try_get", "[code]")
+{
+    frame f;
+    md_capture_timing timing{};
+    timing.header.md_type_id = md_type::META_DATA_INTEL_CAPTURE_TIMING_ID;
+    timing.header.md_size = sizeof(timing);
+    timing.flags = static_cast<uint32_t>(md_capture_timing_attributes::frame_counter_attribute);
+    timing.frame_counter = 42;
+    timing.exposure_time = 8500;
+    memcpy(f.additional_data.metadata_blob.data(), &timing, sizeof(timing));
+    f.additional_data.metadata_size = sizeof(timing);
+
+    auto counter = make_attribute_parser(&md_capture_timing::frame_counter, md_capture_timing_attributes::frame_counter_attribute, 0);
+    auto exposure = make_attribute_parser(&md_capture_timing::exposure_time, md_capture_timing_attributes::exposure_attribute, 0,
+        [](rs2_metadata_type param) { return param / 10; });
+
+    rs2_metadata_type value = -1;
+    REQUIRE(counter->try_get(f, value));
+    CHECK(value == 42);
+
+    // Present in the blob but not flagged as valid
+    CHECK_FALSE(exposure->try_get(f, value));
+    CHECK(value == 42);
+    CHECK_FALSE(exposure->supports(f));
+    CHECK_THROWS(exposure->get(f));
+
+    f.additional_data.metadata_blob[offsetof(md_capture_timing, flags)] |= static_cast<uint8_t>(md_capture_timing_attributes::exposure_attribute);
+    REQUIRE(exposure->try_get(f, value));
+    CHECK(value == 850);
+    CHECK(exposure->get(f) == value);
+}
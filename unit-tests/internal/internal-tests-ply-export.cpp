@@ -0,0 +1,146 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <cstring>
+#include <string>
+#include <vector>
+#include "./../src/proc/ply-export.h"
+#include "./../src/proc/worker-pool.h"
+
+using namespace librealsense;
+
+namespace
+{
+    // Splits a serialized PLY into its header and binary body
+    std::string ply_header(const std::vector<uint8_t>& ply)
+    {
+        std::string text(ply.begin(), ply.end());
+        auto end = text.find("end_header\n");
+        REQUIRE(end != std::string::npos);
+        return text.substr(0, end + strlen("end_header\n"));
+    }
+
+    // A slanted plane with a hole, and a far away corner that is not connected to the rest
+    std::vector<float3> make_cloud(int width, int height)
+    {
+        std::vector<float3> vertices(width * height);
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                vertices[y * width + x] = { x * 0.01f, y * 0.01f, 1.f + x * 0.001f };
+        vertices[1 * width + 1] = { 0, 0, 0 };
+        vertices[(height - 1) * width + width - 1].z = 3.f;
+        return vertices;
+    }
+}
+
+TEST_CASE("ply_export_mesh", "[code]")
+{
+    const int width = 4, height = 3;
+    auto vertices = make_cloud(width, height);
+
+    auto ply = serialize_ply(width, height, vertices.data(), nullptr, nullptr, ply_export_options());
+    auto header = ply_header(ply);
+    CHECK(header.find("format binary_little_endian 1.0\n") != std::string::npos);
+    CHECK(header.find("element vertex 11\n") != std::string::npos);
+    CHECK(header.find("property uchar red") == std::string::npos);
+    CHECK(header.find(" nx\n") == std::string::npos);
+
+    // Of the 6 quads, 4 touch the hole and 1 the far corner
+    REQUIRE(header.find("element face 2\n") != std::string::npos);
+    REQUIRE(ply.size() == header.size() + 11 * sizeof(float3) + 2 * (1 + 3 * sizeof(int32_t)));
+
+    // The hole is dropped and the vertices after it shift, y and z are flipped
+    float3 v;
+    memcpy(&v, ply.data() + header.size() + 5 * sizeof(float3), sizeof(v));
+    CHECK(v.x == Approx(0.02f));
+    CHECK(v.y == Approx(-0.01f));
+    CHECK(v.z == Approx(-1.002f));
+
+    // The quad at (2, 0) is the first face pair - a = 2, b = 3, c = 6 -> 5, d = 7 -> 6
+    auto faces = ply.data() + header.size() + 11 * sizeof(float3);
+    int32_t indices[3];
+    CHECK(faces[0] == 3);
+    memcpy(indices, faces + 1, sizeof(indices));
+    CHECK(indices[0] == 2); CHECK(indices[1] == 6); CHECK(indices[2] == 3);
+    CHECK(faces[13] == 3);
+    memcpy(indices, faces + 14, sizeof(indices));
+    CHECK(indices[0] == 6); CHECK(indices[1] == 2); CHECK(indices[2] == 5);
+}
+
+TEST_CASE("ply_export_vertices_colors_and_normals", "[code]")
+{
+    const int width = 4, height = 3;
+    auto vertices = make_cloud(width, height);
+
+    std::vector<float2> texcoords(width * height, float2{ 0.f, 0.f });
+    texcoords[0] = { 0.99f, 0.99f };
+    uint8_t rgb[2 * 2 * 3] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    ply_texture texture = { rgb, 2, 2, 3, 6 };
+
+    ply_export_options vertices_only;
+    vertices_only.mesh = false;
+    vertices_only.normals = true; // Ignored without the mesh
+    auto ply = serialize_ply(width, height, vertices.data(), texcoords.data(), &texture, vertices_only);
+    auto header = ply_header(ply);
+    CHECK(header.find("element face") == std::string::npos);
+    CHECK(header.find(" nx\n") == std::string::npos);
+    REQUIRE(ply.size() == header.size() + 11 * (sizeof(float3) + 3));
+    auto first = ply.data() + header.size() + sizeof(float3);
+    CHECK(first[0] == 10); CHECK(first[1] == 11); CHECK(first[2] == 12);
+    auto second = first + 3 + sizeof(float3);
+    CHECK(second[0] == 1); CHECK(second[1] == 2); CHECK(second[2] == 3);
+
+    ply_export_options with_normals;
+    with_normals.normals = true;
+    ply = serialize_ply(width, height, vertices.data(), nullptr, nullptr, with_normals);
+    header = ply_header(ply);
+    CHECK(header.find(" nz\n") != std::string::npos);
+    REQUIRE(ply.size() == header.size() + 11 * 2 * sizeof(float3) + 2 * (1 + 3 * sizeof(int32_t)));
+
+    // Vertex 2 belongs to both faces of the slanted plane, vertex 0 to none
+    float3 n;
+    memcpy(&n, ply.data() + header.size() + 2 * 2 * sizeof(float3) + sizeof(float3), sizeof(n));
+    CHECK(std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z) == Approx(1.f));
+    CHECK(n.z > 0.99f);
+    memcpy(&n, ply.data() + header.size() + sizeof(float3), sizeof(n));
+    CHECK(n.x == 0.f); CHECK(n.y == 0.f); CHECK(n.z == 0.f);
+
+    texture.bytes_per_pixel = 2;
+    CHECK_THROWS(serialize_ply(width, height, vertices.data(), texcoords.data(), &texture, vertices_only));
+}
+
+TEST_CASE("ply_export_parallel_matches_serial", "[code]")
+{
+    const int width = 320, height = 241;
+    std::vector<float3> vertices(width * height);
+    std::vector<float2> texcoords(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            auto i = y * width + x;
+            bool hole = (x * 7 + y * 13) % 29 == 0;
+            float z = hole ? 0.f : 0.5f + ((x / 40 + y / 30) % 2) * 0.2f + x * 0.0005f;
+            vertices[i] = { hole ? 0.f : x * 0.002f, hole ? 0.f : y * 0.002f, z };
+            texcoords[i] = { float(x) / width, float(y) / height };
+        }
+    }
+    std::vector<uint8_t> rgb(width * height * 3);
+    for (size_t i = 0; i < rgb.size(); ++i)
+        rgb[i] = static_cast<uint8_t>(i * 31);
+    ply_texture texture = { rgb.data(), width, height, 3, width * 3 };
+
+    ply_export_options options;
+    options.normals = true;
+    auto serial = serialize_ply(width, height, vertices.data(), texcoords.data(), &texture, options);
+    CHECK(ply_header(serial).find("element face 0\n") == std::string::npos);
+
+    for (auto threads : { 2u, 5u })
+    {
+        CAPTURE(threads);
+        worker_pool pool(threads);
+        auto parallel = serialize_ply(width, height, vertices.data(), texcoords.data(), &texture, options, &pool);
+        REQUIRE(parallel == serial);
+    }
+}
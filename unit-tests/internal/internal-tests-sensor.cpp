@@ -0,0 +1,157 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "./../src/sensor.h"
+#include "./../src/software-device.h"
+
+using namespace librealsense;
+
+namespace
+{
+    const uint32_t z16_fourcc = rs_fourcc('Z', '1', '6', ' ');
+    const int width = 64, height = 48;
+
+    // Hands frames to the sensor the way a backend would. Buffers are either recycled as soon as the
+    // callback returns (the rsusb streamer) or only once the frame continuation runs (V4L2, MF)
+    class fake_uvc_device : public platform::uvc_device
+    {
+    public:
+        explicit fake_uvc_device(bool defers_requeue)
+            : _defers_requeue(defers_requeue), _buffers(4, std::vector<uint8_t>(width * height * 2))
+        {
+            for (auto&& b : _buffers) _free.push_back(b.data());
+        }
+
+        // Fills the next free buffer with value and delivers it, returns false when no buffer is free
+        bool deliver(uint8_t value)
+        {
+            uint8_t* buffer = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_free.empty()) return false;
+                buffer = _free.front();
+                _free.pop_front();
+            }
+            memset(buffer, value, width * height * 2);
+
+            platform::frame_object fo{ static_cast<size_t>(width * height * 2), 0, buffer, nullptr, 0 };
+            auto requeue = [this, buffer]() {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _free.push_back(buffer);
+            };
+            if (_defers_requeue)
+            {
+                _callback(_profile, fo, requeue);
+            }
+            else
+            {
+                _callback(_profile, fo, []() {});
+                requeue();
+            }
+            return true;
+        }
+
+        void probe_and_commit(platform::stream_profile profile, platform::frame_callback callback, int buffers) override
+        {
+            _profile = profile;
+            _callback = callback;
+        }
+        void stream_on(std::function<void(const notification& n)> error_handler) override {}
+        void start_callbacks() override {}
+        void stop_callbacks() override {}
+        void close(platform::stream_profile profile) override {}
+
+        void set_power_state(platform::power_state state) override { _state = state; }
+        platform::power_state get_power_state() const override { return _state; }
+
+        void init_xu(const platform::extension_unit& xu) override {}
+        bool set_xu(const platform::extension_unit& xu, uint8_t ctrl, const uint8_t* data, int len) override { return false; }
+        bool get_xu(const platform::extension_unit& xu, uint8_t ctrl, uint8_t* data, int len) const override { return false; }
+        platform::control_range get_xu_range(const platform::extension_unit& xu, uint8_t ctrl, int len) const override { return {}; }
+
+        bool get_pu(rs2_option opt, int32_t& value) const override { return false; }
+        bool set_pu(rs2_option opt, int32_t value) override { return false; }
+        platform::control_range get_pu_range(rs2_option opt) const override { return {}; }
+
+        std::vector<platform::stream_profile> get_profiles() const override
+        {
+            return { { static_cast<uint32_t>(width), static_cast<uint32_t>(height), 30, z16_fourcc } };
+        }
+
+        void lock() const override {}
+        void unlock() const override {}
+
+        std::string get_device_location() const override { return ""; }
+        platform::usb_spec get_usb_specification() const override { return platform::usb3_type; }
+
+        bool defers_buffer_requeue() const override { return _defers_requeue; }
+
+    private:
+        bool _defers_requeue;
+        platform::power_state _state = platform::D3;
+        platform::stream_profile _profile;
+        platform::frame_callback _callback;
+        std::mutex _mutex;
+        std::vector<std::vector<uint8_t>> _buffers;
+        std::deque<uint8_t*> _free;
+    };
+
+    class counter_timestamp_reader : public frame_timestamp_reader
+    {
+        unsigned long long _counter = 0;
+    public:
+        double get_frame_timestamp(const std::shared_ptr<frame_interface>& frame) override { return static_cast<double>(++_counter); }
+        unsigned long long get_frame_counter(const std::shared_ptr<frame_interface>& frame) const override { return _counter; }
+        rs2_timestamp_domain get_frame_timestamp_domain(const std::shared_ptr<frame_interface>& frame) const override { return RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME; }
+        void reset() override { _counter = 0; }
+    };
+}
+
+TEST_CASE("uvc_sensor_borrowed_frames", "[code]")
+{
+    for (auto defers_requeue : { false, true })
+    {
+        software_device owner;
+        auto dev = std::make_shared<fake_uvc_device>(defers_requeue);
+        auto sensor = std::make_shared<uvc_sensor>("fake", dev,
+            std::unique_ptr<frame_timestamp_reader>(new counter_timestamp_reader()), &owner);
+        sensor->set_source_owner(sensor.get());
+        sensor->get_fourcc_to_rs2_format_map() = std::make_shared<std::map<uint32_t, rs2_format>>(
+            std::map<uint32_t, rs2_format>{ { z16_fourcc, RS2_FORMAT_Z16 } });
+        sensor->get_fourcc_to_rs2_stream_map() = std::make_shared<std::map<uint32_t, rs2_stream>>(
+            std::map<uint32_t, rs2_stream>{ { z16_fourcc, RS2_STREAM_DEPTH } });
+
+        auto profiles = sensor->get_stream_profiles();
+        REQUIRE(profiles.size() == 1);
+
+        std::vector<frame_holder> held;
+        auto on_frame = [&held](frame_interface* f) { held.emplace_back(f); };
+        sensor->open(profiles);
+        sensor->start({ new internal_frame_callback<decltype(on_frame)>(on_frame),
+            [](rs2_frame_callback* p) { p->release(); } });
+
+        // Keep the first frame while later frames come in and get released
+        REQUIRE(dev->deliver(1));
+        REQUIRE(held.size() == 1);
+        for (uint8_t value = 2; value < 10; value++)
+        {
+            REQUIRE(dev->deliver(value));
+            REQUIRE(held.size() == 2);
+            held.pop_back();
+        }
+
+        auto data = held.front()->get_frame_data();
+        REQUIRE(held.front()->get_frame_data_size() == width * height * 2);
+        CHECK(std::all_of(data, data + width * height * 2, [](byte b) { return b == 1; }));
+
+        held.clear();
+        sensor->stop();
+        sensor->close();
+    }
+}
@@ -0,0 +1,62 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "./../src/proc/spatial-filter.h"
+
+using namespace librealsense;
+
+TEST_CASE("spatial_filter_simd", "[code]")
+{
+    // Sizes that leave partial SIMD groups of rows/columns, as well as the common disparity resolutions
+    for (auto dims : { std::make_pair(848, 480), std::make_pair(424, 240), std::make_pair(37, 23), std::make_pair(9, 5) })
+    {
+        const int w = dims.first, h = dims.second;
+        CAPTURE(w);
+        CAPTURE(h);
+
+        // A slowly varying surface with holes, jumps and values the filter treats as invalid
+        std::vector<float> src(w * h);
+        float surface = 50.f;
+        for (auto&& d : src)
+        {
+            surface = std::max(1.f, surface + (rand() % 200 - 100) / 50.f);
+            switch (rand() % 20)
+            {
+            case 0: d = 0.f; break;
+            case 1: d = -3.f; break;
+            case 2: d = NAN; break;
+            case 3: d = surface + rand() % 100; break;
+            default: d = surface;
+            }
+        }
+
+        for (auto alpha : { 0.25f, 0.5f, 0.9f })
+        {
+            std::vector<float> scalar = src;
+            spatial_filter_horizontal_fp(scalar.data(), w, 0, h, alpha, 20.f, simd_isa_none);
+            spatial_filter_vertical_fp(scalar.data(), w, h, 0, w, alpha, 20.f, simd_isa_none);
+
+            for (auto isa : { simd_isa_ssse3, simd_isa_avx2 })
+            {
+                if (isa > get_simd_isa())
+                    continue;
+
+                CAPTURE(isa);
+                // Uneven bands, as handed out by the worker pool
+                std::vector<float> simd = src;
+                for (int row = 0; row < h; row += 13)
+                    spatial_filter_horizontal_fp(simd.data(), w, row, std::min(row + 13, h), alpha, 20.f, isa);
+                for (int col = 0; col < w; col += 21)
+                    spatial_filter_vertical_fp(simd.data(), w, h, col, std::min(col + 21, w), alpha, 20.f, isa);
+
+                // NaN inputs are passed through, so compare the bit patterns
+                REQUIRE(memcmp(simd.data(), scalar.data(), simd.size() * sizeof(float)) == 0);
+            }
+        }
+    }
+}
@@ -12,6 +12,8 @@
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include "../../common/tiny-profiler.h"
 #include "./../src/environment.h"
+#include "./../src/frame-buffer-pool.h"
+#include "./../src/source.h"
 
 using namespace librealsense;
 using namespace librealsense::platform;
@@ -102,3 +104,129 @@ TEST_CASE("copy_2darray", "[code]")
             REQUIRE(src_double[i][j] != tgt_float[i][j]);
         }
 }
+
+TEST_CASE("frame_buffer_pool", "[code]")
+{
+    frame_buffer_pool pool;
+    std::vector<byte> buf;
+
+    // Empty pool - every allocation is a miss
+    REQUIRE_FALSE(pool.acquire(1024, buf));
+    buf.resize(1024);
+    auto ptr = buf.data();
+    pool.release(std::move(buf), 0.);
+
+    // Steady state - the same memory is handed back without touching the heap
+    for (int i = 1; i <= 100; i++)
+    {
+        std::vector<byte> b;
+        REQUIRE(pool.acquire(1024, b));
+        REQUIRE(b.data() == ptr);
+        pool.evict_stale(i * 10.);
+        pool.release(std::move(b), i * 10.);
+    }
+
+    // Buffers of a different size are kept apart
+    REQUIRE_FALSE(pool.acquire(2048, buf));
+
+    auto stats = pool.get_stats();
+    REQUIRE(stats.hits == 100);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.evictions == 0);
+
+    // Buffers not reused for more than max_buffer_age are freed by the next sweep
+    pool.evict_stale(1000. + 2 * frame_buffer_pool::max_buffer_age);
+    REQUIRE(pool.get_stats().evictions == 1);
+    REQUIRE_FALSE(pool.acquire(1024, buf));
+
+    // Overflowing a size class drops the extra buffers
+    for (size_t i = 0; i < frame_buffer_pool::slots_per_class + 2; i++)
+        pool.release(std::vector<byte>(16), 0.);
+    REQUIRE(pool.get_stats().evictions == 3);
+}
+
+struct test_allocator_state
+{
+    bool decline = false;
+    int allocated = 0;
+    int released = 0;
+    std::vector<std::unique_ptr<byte[]>> buffers;
+};
+
+TEST_CASE("frame_allocator", "[code]")
+{
+    test_allocator_state state;
+    auto on_allocate = [](int size, void* user) -> void*
+    {
+        auto s = static_cast<test_allocator_state*>(user);
+        if (s->decline) return nullptr;
+        s->buffers.emplace_back(new byte[size]);
+        s->allocated++;
+        return s->buffers.back().get();
+    };
+    auto on_deallocate = [](void* buffer, int size, void* user)
+    {
+        static_cast<test_allocator_state*>(user)->released++;
+    };
+
+    frame_source source(1);
+    source.init(std::make_shared<metadata_parser_map>());
+    source.set_frame_allocator({ new frame_allocator(on_allocate, on_deallocate, &state),
+        [](rs2_frame_allocator* p) { delete p; } });
+
+    // Video frames are backed by the user memory, which goes back to the user with the last reference
+    auto f = source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, 640 * 480 * 2, frame_additional_data(), true);
+    REQUIRE(f);
+    REQUIRE(state.allocated == 1);
+    REQUIRE(f->get_frame_data() == state.buffers.back().get());
+    REQUIRE(f->get_frame_data_size() == 640 * 480 * 2);
+    f->release();
+    REQUIRE(state.released == 1);
+
+    // Sensors filling a frame after allocation write through the buffer the frame exposes, which is the
+    // user memory
+    std::vector<byte> pixels(320 * 240 * 2);
+    for (size_t i = 0; i < pixels.size(); i++)
+        pixels[i] = static_cast<byte>(i * 7);
+    f = source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, pixels.size(), frame_additional_data(), true);
+    REQUIRE(f);
+    REQUIRE(state.allocated == 2);
+    ((video_frame*)f)->assign(320, 240, 320 * 2, 16);
+    memcpy(const_cast<byte*>(f->get_frame_data()), pixels.data(), std::min<size_t>(pixels.size(), f->get_frame_data_size()));
+    REQUIRE(std::equal(pixels.begin(), pixels.end(), state.buffers.back().get()));
+    REQUIRE(((video_frame*)f)->data.empty());
+    f->release();
+    REQUIRE(state.released == 2);
+
+    // Frames the archive cannot publish are dropped, and their buffers released right away
+    f = source.alloc_frame(RS2_EXTENSION_DEPTH_FRAME, 1024, frame_additional_data(), true);
+    REQUIRE(f);
+    REQUIRE(!source.alloc_frame(RS2_EXTENSION_DEPTH_FRAME, 1024, frame_additional_data(), true));
+    REQUIRE(state.allocated == 4);
+    REQUIRE(state.released == 3);
+    f->release();
+    REQUIRE(state.released == 4);
+
+    // Frame types that are not image frames keep using the library memory
+    f = source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, 12, frame_additional_data(), true);
+    REQUIRE(f);
+    REQUIRE(state.allocated == 4);
+    f->release();
+
+    // When the allocator declines, the frame falls back to the default allocator
+    state.decline = true;
+    f = source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, 1024, frame_additional_data(), true);
+    REQUIRE(f);
+    REQUIRE(state.allocated == 4);
+    REQUIRE(f->get_frame_data());
+    REQUIRE(f->get_frame_data_size() == 1024);
+    f->release();
+    REQUIRE(state.released == 4);
+
+    // Restoring the default allocator
+    state.decline = false;
+    source.set_frame_allocator(nullptr);
+    f = source.alloc_frame(RS2_EXTENSION_VIDEO_FRAME, 1024, frame_additional_data(), true);
+    REQUIRE(state.allocated == 4);
+    f->release();
+}
@@ -0,0 +1,122 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <algorithm>
+#include <thread>
+#include "./../src/usb/usb-request-ring.h"
+
+using namespace librealsense::platform;
+
+namespace
+{
+    class fake_request : public usb_request_base
+    {
+    public:
+        int get_actual_length() const override { return actual_length; }
+        void* get_native_request() const override { return nullptr; }
+
+        int actual_length = 0;
+
+    protected:
+        void set_native_buffer_length(int length) override {}
+        int get_native_buffer_length() override { return static_cast<int>(_buffer.size()); }
+        void set_native_buffer(uint8_t* buffer) override {}
+        uint8_t* get_native_buffer() const override { return const_cast<uint8_t*>(_buffer.data()); }
+    };
+
+    // Stands for the device, the test completes the submitted reads as the USB event thread would
+    struct fake_endpoint
+    {
+        std::vector<rs_usb_request> submitted;
+        std::vector<rs_usb_request> cancelled;
+
+        rs_usb_request create(rs_usb_request_callback callback)
+        {
+            auto r = std::make_shared<fake_request>();
+            r->set_buffer(std::vector<uint8_t>(16));
+            r->set_callback(callback);
+            return r;
+        }
+
+        // Completes the oldest read in flight with the given length
+        rs_usb_request complete(int length)
+        {
+            auto r = submitted.front();
+            submitted.erase(submitted.begin());
+            std::static_pointer_cast<fake_request>(r)->actual_length = length;
+            r->get_callback()->callback(r);
+            return r;
+        }
+    };
+}
+
+TEST_CASE("usb_request_ring", "[code]")
+{
+    fake_endpoint ep;
+    usb_request_ring ring(
+        [&ep](rs_usb_request r) { ep.submitted.push_back(r); },
+        [&ep](rs_usb_request r) { ep.cancelled.push_back(r); return true; });
+    std::vector<rs_usb_request> handled;
+    bool in_completion = false;
+
+    CHECK(ring.empty());
+    ring.start(4, [&ep](rs_usb_request_callback callback) { return ep.create(callback); },
+        [&](rs_usb_request r) {
+            in_completion = ring.in_completion();
+            if (!r->get_actual_length()) return false;
+            handled.push_back(r);
+            return true;
+        });
+    CHECK_FALSE(ring.empty());
+    REQUIRE(ep.submitted.size() == 4);
+    auto requests = ep.submitted;
+
+    // Every completion is handled and its read goes back to the end of the ring
+    for (int i = 0; i < 8; i++)
+    {
+        auto r = ep.complete(16);
+        REQUIRE(handled.size() == static_cast<size_t>(i + 1));
+        CHECK(handled.back() == r);
+        CHECK(r == requests[i % 4]);
+        CHECK(ep.submitted.size() == 4);
+        CHECK(ep.submitted.back() == r);
+    }
+
+    // The handler knows it runs inside a completion, so that stop() can refuse to be called from there
+    CHECK(in_completion);
+    CHECK_FALSE(ring.in_completion());
+    std::thread other([&]() { in_completion = ring.in_completion(); });
+    other.join();
+    CHECK_FALSE(in_completion);
+
+    // A failed read is not resubmitted and marks the ring as failed, the others keep receiving
+    CHECK_FALSE(ring.failed());
+    ep.complete(0);
+    CHECK(ring.failed());
+    CHECK(ep.submitted.size() == 3);
+    ep.complete(16);
+    CHECK(handled.size() == 9);
+    CHECK(ep.submitted.size() == 3);
+
+    // Stopping cancels every read, a completion arriving afterwards is ignored
+    auto in_flight = ep.submitted;
+    ring.stop();
+    CHECK(ring.empty());
+    CHECK(ep.cancelled.size() == 4);
+    for (auto&& r : requests)
+        CHECK(std::find(ep.cancelled.begin(), ep.cancelled.end(), r) != ep.cancelled.end());
+    ep.complete(16);
+    CHECK(handled.size() == 9);
+    CHECK(ep.submitted.size() == 2);
+
+    // The ring can be started again after a failure
+    ep.submitted.clear();
+    ring.start(2, [&ep](rs_usb_request_callback callback) { return ep.create(callback); },
+        [&](rs_usb_request r) { handled.push_back(r); return true; });
+    CHECK_FALSE(ring.failed());
+    CHECK(ep.submitted.size() == 2);
+    ep.complete(16);
+    CHECK(handled.size() == 10);
+    ring.stop();
+}
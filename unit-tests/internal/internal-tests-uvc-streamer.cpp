@@ -0,0 +1,189 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#if defined(RS2_USE_LIBUVC_BACKEND) || defined(RS2_USE_WINUSB_UVC_BACKEND)
+
+#include "catch/catch.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include "./../src/uvc/uvc-streamer.h"
+
+using namespace librealsense;
+using namespace librealsense::platform;
+
+namespace
+{
+    const uint32_t max_frame_size = 4096;
+    const uint8_t header_length = 12;
+
+    class fake_endpoint : public usb_endpoint
+    {
+    public:
+        uint8_t get_address() const override { return 0x82; }
+        endpoint_type get_type() const override { return RS2_USB_ENDPOINT_BULK; }
+        endpoint_direction get_direction() const override { return RS2_USB_ENDPOINT_DIRECTION_READ; }
+        uint8_t get_interface_number() const override { return 1; }
+    };
+
+    class fake_interface : public usb_interface
+    {
+    public:
+        uint8_t get_number() const override { return 1; }
+        uint8_t get_class() const override { return 0x0e; }
+        uint8_t get_subclass() const override { return 0x02; }
+        const std::vector<rs_usb_endpoint> get_endpoints() const override { return { _endpoint }; }
+        const rs_usb_endpoint first_endpoint(const endpoint_direction direction, const endpoint_type type) const override { return _endpoint; }
+
+    private:
+        rs_usb_endpoint _endpoint = std::make_shared<fake_endpoint>();
+    };
+
+    class fake_device : public usb_device_mock
+    {
+    public:
+        const rs_usb_interface get_interface(uint8_t interface_number) const override { return _interface; }
+
+    private:
+        rs_usb_interface _interface = std::make_shared<fake_interface>();
+    };
+
+    class fake_request : public usb_request_base
+    {
+    public:
+        explicit fake_request(rs_usb_endpoint endpoint) { _endpoint = endpoint; }
+
+        int get_actual_length() const override { return actual_length; }
+        void* get_native_request() const override { return nullptr; }
+
+        int actual_length = 0;
+
+    protected:
+        void set_native_buffer_length(int length) override {}
+        int get_native_buffer_length() override { return static_cast<int>(_buffer.size()); }
+        void set_native_buffer(uint8_t* buffer) override {}
+        uint8_t* get_native_buffer() const override { return const_cast<uint8_t*>(_buffer.data()); }
+    };
+
+    // Keeps the submitted requests, the test completes them as the USB event thread would
+    class fake_messenger : public usb_messenger
+    {
+    public:
+        usb_status control_transfer(int request_type, int request, int value, int index, uint8_t* buffer, uint32_t length, uint32_t& transferred, uint32_t timeout_ms) override { return RS2_USB_STATUS_SUCCESS; }
+        usb_status bulk_transfer(const rs_usb_endpoint& endpoint, uint8_t* buffer, uint32_t length, uint32_t& transferred, uint32_t timeout_ms) override { return RS2_USB_STATUS_SUCCESS; }
+        usb_status reset_endpoint(const rs_usb_endpoint& endpoint, uint32_t timeout_ms) override { return RS2_USB_STATUS_SUCCESS; }
+        usb_status submit_request(const rs_usb_request& request) override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            submitted.push_back(request);
+            return RS2_USB_STATUS_SUCCESS;
+        }
+        usb_status cancel_request(const rs_usb_request& request) override { return RS2_USB_STATUS_SUCCESS; }
+        rs_usb_request create_request(rs_usb_endpoint endpoint) override { return std::make_shared<fake_request>(endpoint); }
+
+        // Fills the request with a full frame and reports its completion
+        void complete(const rs_usb_request& request, uint8_t value)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                submitted.erase(std::find(submitted.begin(), submitted.end(), request));
+            }
+            auto r = std::static_pointer_cast<fake_request>(request);
+            auto& buffer = const_cast<std::vector<uint8_t>&>(r->get_buffer());
+            std::fill(buffer.begin(), buffer.end(), value);
+            buffer[0] = header_length;
+            buffer[1] = 0;
+            r->actual_length = header_length + max_frame_size;
+            r->get_callback()->callback(request);
+        }
+
+        bool is_submitted(const rs_usb_request& request)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return std::find(submitted.begin(), submitted.end(), request) != submitted.end();
+        }
+
+        std::mutex mutex;
+        std::vector<rs_usb_request> submitted;
+    };
+}
+
+TEST_CASE("uvc_streamer_zero_copy", "[code]")
+{
+    auto messenger = std::make_shared<fake_messenger>();
+    auto control = std::make_shared<uvc_stream_ctrl_t>();
+    control->bInterfaceNumber = 1;
+    control->dwMaxVideoFrameSize = max_frame_size;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool resume = false;
+    std::vector<std::pair<const void*, uint8_t>> frames;
+
+    uvc_streamer_context context{};
+    context.profile = { 64, 32, 30, rs_fourcc('Y', 'U', 'Y', 'V') };
+    context.usb_device = std::make_shared<fake_device>();
+    context.messenger = messenger;
+    context.control = control;
+    context.request_count = 2;
+    context.zero_copy = true;
+    // The first frame is held by the callback until the test lets it go, so that the pool fills up
+    context.user_cb = [&](platform::stream_profile p, frame_object f, std::function<void()> continuation)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        frames.emplace_back(f.pixels, static_cast<const uint8_t*>(f.pixels)[0]);
+        cv.notify_all();
+        cv.wait(lock, [&]() { return resume; });
+    };
+
+    uvc_streamer streamer(context);
+    streamer.start();
+    rs_usb_request request;
+    {
+        std::lock_guard<std::mutex> lock(messenger->mutex);
+        REQUIRE(messenger->submitted.size() == 2);
+        request = messenger->submitted.front();
+    }
+
+    // The transfer buffer becomes the frame, the request is resubmitted with a buffer of the pool
+    auto transfer = request->get_buffer().data();
+    messenger->complete(request, 1);
+    CHECK(request->get_buffer().data() != transfer);
+    CHECK(messenger->is_submitted(request));
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        REQUIRE(cv.wait_for(lock, std::chrono::seconds(2), [&]() { return frames.size() == 1; }));
+        CHECK(frames[0].first == transfer + header_length);
+        CHECK(frames[0].second == 1);
+    }
+
+    // Fill the rest of the pool, the frames wait in the queue behind the one held by the callback
+    auto pool_size = backend_frames_archive::CAPACITY;
+    for (auto i = 1; i < pool_size; i++)
+    {
+        transfer = request->get_buffer().data();
+        messenger->complete(request, static_cast<uint8_t>(i + 1));
+        CHECK(request->get_buffer().data() != transfer);
+    }
+
+    // With no frame left in the pool the frame is dropped, and the request keeps its own buffer
+    transfer = request->get_buffer().data();
+    messenger->complete(request, 0xff);
+    CHECK(request->get_buffer().data() == transfer);
+    CHECK(messenger->is_submitted(request));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        resume = true;
+        cv.notify_all();
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        REQUIRE(cv.wait_for(lock, std::chrono::seconds(2), [&]() { return frames.size() == static_cast<size_t>(pool_size); }));
+        for (auto i = 0; i < pool_size; i++)
+            CHECK(frames[i].second == i + 1);
+    }
+    streamer.stop();
+}
+
+#endif
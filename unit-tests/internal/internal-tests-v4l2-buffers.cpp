@@ -0,0 +1,130 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#ifdef RS2_USE_V4L2_BACKEND
+
+#include "catch/catch.hpp"
+#include <cstdarg>
+#include <cstring>
+#include <functional>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "./../src/linux/backend-v4l2.h"
+
+using namespace librealsense::platform;
+
+namespace
+{
+    // A memfd stands for the video node, its pages are the kernel buffers
+    struct fake_video_node
+    {
+        static const uint32_t buffer_size = 640 * 480 * 2;
+
+        int fd = -1;
+        int qbuf_calls = 0;
+
+        fake_video_node()
+        {
+            fd = static_cast<int>(syscall(SYS_memfd_create, "fake-video-node", 0));
+            REQUIRE(fd >= 0);
+            REQUIRE(ftruncate(fd, buffer_size * 2) == 0);
+        }
+        ~fake_video_node() { close(fd); }
+
+        void overwrite(uint32_t index, uint8_t value)
+        {
+            std::vector<uint8_t> data(buffer_size, value);
+            REQUIRE(pwrite(fd, data.data(), data.size(), index * buffer_size) == buffer_size);
+        }
+    };
+
+    fake_video_node* node = nullptr;
+}
+
+// The backend reaches the kernel through ioctl(), the requests to the fake node are answered here
+extern "C" int ioctl(int fd, unsigned long request, ...) __THROW
+{
+    va_list args;
+    va_start(args, request);
+    auto arg = va_arg(args, void*);
+    va_end(args);
+
+    if (!node || fd != node->fd)
+        return static_cast<int>(syscall(SYS_ioctl, fd, request, arg));
+
+    switch (request)
+    {
+    case VIDIOC_QUERYBUF:
+    {
+        auto buf = static_cast<v4l2_buffer*>(arg);
+        buf->length = fake_video_node::buffer_size;
+        buf->m.offset = buf->index * fake_video_node::buffer_size;
+        return 0;
+    }
+    case VIDIOC_QBUF:
+        node->qbuf_calls++;
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+// Hands the buffer to a frame the way the capture loop does, returns the continuation the frame runs when released
+static std::function<void()> lend_buffer(std::shared_ptr<buffer> buf, int fd, uint32_t index)
+{
+    buffers_mgr buf_mgr(true);
+    v4l2_buffer v4l_buf = {};
+    v4l_buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    v4l_buf.memory = V4L2_MEMORY_MMAP;
+    v4l_buf.index = index;
+    buf_mgr.handle_buffer(e_video_buf, fd, v4l_buf, buf);
+    buf->attach_buffer(v4l_buf);
+    buf_mgr.handle_buffer(e_video_buf, -1);
+    return [buf_mgr]() mutable { buf_mgr.request_next_frame(); };
+}
+
+TEST_CASE("v4l2_buffer_released_after_close", "[code]")
+{
+    fake_video_node fake;
+    node = &fake;
+
+    // A frame released while streaming re-queues its buffer
+    {
+        auto buf = std::make_shared<buffer>(fake.fd, V4L2_BUF_TYPE_VIDEO_CAPTURE, true, 0);
+        auto release = lend_buffer(buf, fake.fd, 0);
+        release();
+        CHECK(fake.qbuf_calls == 1);
+        release();
+        CHECK(fake.qbuf_calls == 1);
+    }
+    fake.qbuf_calls = 0;
+
+    // A frame still held when the device closes
+    auto buf = std::make_shared<buffer>(fake.fd, V4L2_BUF_TYPE_VIDEO_CAPTURE, true, 0);
+    fake.overwrite(0, 0x11);
+    auto release = lend_buffer(buf, fake.fd, 0);
+    auto pixels = buf->get_frame_start();
+    REQUIRE(pixels[0] == 0x11);
+
+    buf->detach_from_kernel();
+    buf.reset();
+
+    // The device is opened again, the new session fills the same kernel buffer
+    auto reopened = std::make_shared<buffer>(fake.fd, V4L2_BUF_TYPE_VIDEO_CAPTURE, true, 0);
+    reopened->prepare_for_streaming(fake.fd);
+    CHECK(fake.qbuf_calls == 1);
+    fake.overwrite(0, 0x22);
+    CHECK(reopened->get_frame_start()[0] == 0x22);
+
+    // The held frame kept its own pixels, and releasing it does not queue the buffer again
+    CHECK(pixels[0] == 0x11);
+    CHECK(pixels[fake_video_node::buffer_size - 1] == 0x11);
+    release();
+    release = nullptr;
+    CHECK(fake.qbuf_calls == 1);
+
+    node = nullptr;
+}
+
+#endif
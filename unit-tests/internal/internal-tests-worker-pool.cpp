@@ -0,0 +1,129 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+#include "catch/catch.hpp"
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "./../src/proc/synthetic-stream.h"
+#include "./../src/proc/hole-filling-filter.h"
+
+using namespace librealsense;
+
+TEST_CASE("worker_pool_covers_range", "[code]")
+{
+    for (auto threads : { 1u, 2u, 4u, 7u })
+    {
+        CAPTURE(threads);
+        worker_pool pool(threads);
+        REQUIRE(pool.get_threads_count() == threads);
+
+        for (auto count : { 1, 5, 64, 721 })
+        {
+            CAPTURE(count);
+            std::vector<std::atomic<int>> hits(count);
+            for (auto&& h : hits) h = 0;
+
+            // Catch assertions are not thread-safe, the tasks only record what they saw
+            std::atomic<int> empty_ranges(0);
+            pool.parallel_for(0, count, [&](int begin, int end)
+            {
+                if (begin >= end) empty_ranges++;
+                for (auto i = begin; i < end; ++i) hits[i]++;
+            });
+            REQUIRE(empty_ranges == 0);
+            for (auto&& h : hits) REQUIRE(h == 1);
+
+            std::atomic<int> ranges(0);
+            pool.parallel_for_chunks(0, count, 3, [&](int begin, int end)
+            {
+                for (auto i = begin; i < end; ++i) hits[i]++;
+                ranges++;
+            });
+            for (auto&& h : hits) REQUIRE(h == 2);
+            REQUIRE(ranges == std::min(count, 3));
+        }
+    }
+}
+
+TEST_CASE("worker_pool_concurrent_callers", "[code]")
+{
+    worker_pool pool(4);
+
+    // Several processing blocks sharing the pool, each waiting only for its own ranges
+    std::vector<std::thread> callers;
+    std::vector<long long> sums(6, 0);
+    for (size_t c = 0; c < sums.size(); ++c)
+    {
+        callers.emplace_back([&, c]()
+        {
+            for (int iteration = 0; iteration < 50; ++iteration)
+            {
+                std::vector<int> values(1000, 0);
+                pool.parallel_for(0, 1000, [&](int begin, int end)
+                {
+                    for (auto i = begin; i < end; ++i) values[i] = i;
+                });
+                for (auto v : values) sums[c] += v;
+            }
+        });
+    }
+    for (auto&& t : callers) t.join();
+
+    for (auto s : sums)
+        REQUIRE(s == 50LL * 999 * 1000 / 2);
+}
+
+TEST_CASE("worker_pool_propagates_exceptions", "[code]")
+{
+    worker_pool pool(3);
+    REQUIRE_THROWS_AS(pool.parallel_for(0, 100, [](int begin, int end)
+    {
+        if (begin <= 50 && 50 < end)
+            throw std::runtime_error("band failed");
+    }), std::runtime_error);
+
+    // The pool stays usable after a failed call
+    std::atomic<int> count(0);
+    pool.parallel_for(0, 100, [&](int begin, int end) { count += end - begin; });
+    REQUIRE(count == 100);
+}
+
+class hole_filling_tester : public hole_filling_filter
+{
+public:
+    using hole_filling_filter::holes_fill_left;
+    using hole_filling_filter::holes_fill_farest;
+    using hole_filling_filter::holes_fill_nearest;
+};
+
+TEST_CASE("hole_filling_parallel_matches_serial", "[code]")
+{
+    const size_t w = 424, h = 240;
+    std::vector<uint16_t> src(w * h);
+    for (auto&& d : src) d = (rand() % 3) ? 0 : static_cast<uint16_t>(rand() % 5000);
+
+    hole_filling_tester filter;
+    for (auto mode : { hf_fill_from_left, hf_farest_from_around, hf_nearest_from_around })
+    {
+        CAPTURE(mode);
+        std::vector<uint16_t> results[2];
+        for (auto threads : { 1, 4 })
+        {
+            environment::get_instance().set_processing_threads(threads);
+            auto& res = results[threads == 1 ? 0 : 1];
+            res = src;
+            switch (mode)
+            {
+            case hf_fill_from_left: filter.holes_fill_left(res.data(), w, h, w * 2); break;
+            case hf_farest_from_around: filter.holes_fill_farest(res.data(), w, h, w * 2); break;
+            case hf_nearest_from_around: filter.holes_fill_nearest(res.data(), w, h, w * 2); break;
+            default: break;
+            }
+        }
+        REQUIRE(results[0] != src);
+        REQUIRE(results[0] == results[1]);
+    }
+    environment::get_instance().set_processing_threads(0);
+}
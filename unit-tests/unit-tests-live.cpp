@@ -1409,6 +1409,73 @@ TEST_CASE("get_active_streams sanity check", "[live]")
     }
 }
 
+TEST_CASE("Frames held across sensor close", "[live]")
+{
+    // Depth frames may reference the backend buffers directly, the sensor must still close and
+    // stream again while the user holds on to one of them
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        auto list = ctx.query_devices();
+        REQUIRE(list.size() > 0);
+        auto dev = list[0];
+        disable_sensitive_options_for(dev);
+
+        for (auto&& sensor : dev.query_sensors())
+        {
+            auto profiles = sensor.get_stream_profiles();
+            auto depth = std::find_if(profiles.begin(), profiles.end(), [](const rs2::stream_profile& p) {
+                return p.format() == RS2_FORMAT_Z16 && p.is<rs2::video_stream_profile>();
+            });
+            if (depth == profiles.end()) continue;
+
+            std::mutex m;
+            std::condition_variable cv;
+            rs2::frame held;
+            auto hold_first = [&](rs2::frame f) {
+                std::lock_guard<std::mutex> lock(m);
+                if (!held) held = f;
+                cv.notify_one();
+            };
+
+            REQUIRE_NOTHROW(sensor.open(*depth));
+            REQUIRE_NOTHROW(sensor.start(hold_first));
+            {
+                std::unique_lock<std::mutex> lock(m);
+                REQUIRE(cv.wait_for(lock, std::chrono::seconds(10), [&]() { return bool(held); }));
+            }
+            REQUIRE_NOTHROW(sensor.stop());
+            REQUIRE_NOTHROW(sensor.close());
+
+            // The held frame stays readable after the sensor is closed
+            auto data = static_cast<const uint8_t*>(held.get_data());
+            auto size = held.get_data_size();
+            REQUIRE(data);
+            std::vector<uint8_t> pixels(data, data + size);
+
+            // Streaming again while the old frame is still held
+            rs2::frame previous;
+            {
+                std::lock_guard<std::mutex> lock(m);
+                std::swap(previous, held);
+            }
+            REQUIRE_NOTHROW(sensor.open(*depth));
+            REQUIRE_NOTHROW(sensor.start(hold_first));
+            {
+                std::unique_lock<std::mutex> lock(m);
+                REQUIRE(cv.wait_for(lock, std::chrono::seconds(10), [&]() { return bool(held); }));
+            }
+            REQUIRE_NOTHROW(sensor.stop());
+            REQUIRE_NOTHROW(sensor.close());
+
+            // The new session did not reuse the memory of the frame held from the previous one
+            REQUIRE(std::equal(pixels.begin(), pixels.end(), static_cast<const uint8_t*>(previous.get_data())));
+            previous = rs2::frame();
+            held = rs2::frame();
+        }
+    }
+}
+
 TEST_CASE("Check option API", "[live][options]")
 {
     // Require at least one device to be plugged in
@@ -5435,6 +5502,413 @@ TEST_CASE("Record software-device", "[software-device][record][!mayfail]")
         pose_frame.timestamp == recorded_pose.get_timestamp()));
 }
 
+TEST_CASE("Record software-device metadata", "[software-device][record][!mayfail]")
+{
+    const int W = 64;
+    const int H = 48;
+    const int BPP = 2;
+    const int frames = 20;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "recording_metadata.bag";
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor("Synthetic");
+    rs2_intrinsics depth_intrinsics = { W, H, (float)W / 2, H / 2, (float)W, (float)H,
+        RS2_DISTORTION_BROWN_CONRADY ,{ 0,0,0,0,0 } };
+    rs2_video_stream video_stream = { RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, depth_intrinsics };
+    auto depth_stream_profile = sensor.add_video_stream(video_stream);
+
+    std::vector<uint8_t> pixels(W * H * BPP, 100);
+    rs2::syncer sync;
+    {
+        recorder recorder(filename, dev);
+        sensor.open(depth_stream_profile);
+        sensor.start(sync);
+        for (int i = 0; i < frames; i++)
+        {
+            rs2_frame_metadata_value keys[] = { RS2_FRAME_METADATA_FRAME_COUNTER, RS2_FRAME_METADATA_ACTUAL_EXPOSURE };
+            rs2_metadata_type values[] = { i, 1000 + i };
+            sensor.set_metadata(keys, values, 2);
+            rs2_software_video_frame video_frame = { pixels.data(), [](void*) {}, W*BPP, BPP, 10000. + i * 16, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth_stream_profile };
+            sensor.on_video_frame(video_frame);
+        }
+    }
+
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+    auto player_dev = ctx.load_device(filename);
+    player_dev.set_real_time(false);
+    rs2::frame_queue q(frames);
+    auto s = player_dev.query_sensors()[0];
+    REQUIRE_NOTHROW(s.open(s.get_stream_profiles()));
+    REQUIRE_NOTHROW(s.start(q));
+
+    int played = 0;
+    rs2::frame depth;
+    while (q.try_wait_for_frame(&depth))
+    {
+        auto i = depth.get_frame_number();
+        CAPTURE(i);
+        REQUIRE(depth.get_frame_timestamp_domain() == RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK);
+        REQUIRE(depth.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER));
+        REQUIRE(depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER) == rs2_metadata_type(i));
+        REQUIRE(depth.get_frame_metadata(RS2_FRAME_METADATA_ACTUAL_EXPOSURE) == rs2_metadata_type(1000 + i));
+        played++;
+    }
+    REQUIRE(played == frames);
+}
+
+TEST_CASE("Playback read-ahead keeps frames in order", "[software-device][record][!mayfail]")
+{
+    const int W = 64;
+    const int H = 48;
+    const int BPP = 2;
+    const int frames = 200;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "recording_read_ahead.bag";
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor("Synthetic");
+    rs2_intrinsics depth_intrinsics = { W, H, (float)W / 2, H / 2, (float)W, (float)H,
+        RS2_DISTORTION_BROWN_CONRADY ,{ 0,0,0,0,0 } };
+    rs2_video_stream video_stream = { RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, depth_intrinsics };
+    auto depth_stream_profile = sensor.add_video_stream(video_stream);
+    rs2_motion_device_intrinsic motion_intrinsics = { { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },{ 2, 2, 2 },{ 3, 3 ,3 } };
+    rs2_motion_stream motion_stream = { RS2_STREAM_ACCEL, 0, 1, 200, RS2_FORMAT_MOTION_RAW, motion_intrinsics };
+    auto motion_stream_profile = sensor.add_motion_stream(motion_stream);
+
+    // Frames refer to the pixels until they are written
+    std::vector<std::vector<uint8_t>> pixels(frames);
+    float motion_data[3] = { 1, 1, 1 };
+    rs2::syncer sync;
+    {
+        recorder recorder(filename, dev);
+        sensor.open({ depth_stream_profile, motion_stream_profile });
+        sensor.start(sync);
+        for (int i = 0; i < frames; i++)
+        {
+            pixels[i].assign(W * H * BPP, uint8_t(i));
+            rs2_software_video_frame video_frame = { pixels[i].data(), [](void*) {}, W*BPP, BPP, 10000. + i * 16, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth_stream_profile };
+            sensor.on_video_frame(video_frame);
+            rs2_software_motion_frame motion_frame = { motion_data, [](void*) {}, 10000. + i * 16 + 8, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, motion_stream_profile };
+            sensor.on_motion_frame(motion_frame);
+        }
+    }
+
+    // Decode the frames on 4 threads
+#ifdef _WIN32
+    _putenv_s("LRS_PLAYBACK_READ_AHEAD_THREADS", "4");
+#else
+    setenv("LRS_PLAYBACK_READ_AHEAD_THREADS", "4", 1);
+#endif
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+    auto player_dev = ctx.load_device(filename);
+#ifdef _WIN32
+    _putenv_s("LRS_PLAYBACK_READ_AHEAD_THREADS", "");
+#else
+    unsetenv("LRS_PLAYBACK_READ_AHEAD_THREADS");
+#endif
+    player_dev.set_real_time(false);
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::vector<std::pair<rs2_stream, unsigned long long>> played;
+    bool pixels_match = true;
+    auto s = player_dev.query_sensors()[0];
+    REQUIRE_NOTHROW(s.open(s.get_stream_profiles()));
+    REQUIRE_NOTHROW(s.start([&](rs2::frame f)
+    {
+        std::lock_guard<std::mutex> lock(m);
+        auto stream = f.get_profile().stream_type();
+        if (stream == RS2_STREAM_DEPTH)
+            pixels_match &= (static_cast<const uint8_t*>(f.get_data())[0] == uint8_t(f.get_frame_number()));
+        played.emplace_back(stream, f.get_frame_number());
+        cv.notify_all();
+    }));
+
+    {
+        std::unique_lock<std::mutex> lock(m);
+        REQUIRE(cv.wait_for(lock, std::chrono::seconds(10), [&]() { return played.size() == 2 * frames; }));
+        REQUIRE(pixels_match);
+        for (int i = 0; i < frames; i++)
+        {
+            CAPTURE(i);
+            REQUIRE(played[2 * i] == std::make_pair(RS2_STREAM_DEPTH, (unsigned long long)i));
+            REQUIRE(played[2 * i + 1] == std::make_pair(RS2_STREAM_ACCEL, (unsigned long long)i));
+        }
+    }
+    s.stop();
+    s.close();
+}
+
+TEST_CASE("Record with a blocking queue and background compression", "[software-device][record][!mayfail]")
+{
+    const int W = 640;
+    const int H = 480;
+    const int BPP = 2;
+    const int frames = 60;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "recording_blocking_queue.bag";
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor("Synthetic");
+    rs2_intrinsics depth_intrinsics = { W, H, (float)W / 2, H / 2, (float)W, (float)H,
+        RS2_DISTORTION_BROWN_CONRADY ,{ 0,0,0,0,0 } };
+    rs2_video_stream video_stream = { RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, depth_intrinsics };
+    auto depth_stream_profile = sensor.add_video_stream(video_stream);
+
+    // Room for a couple of frames only: the sensor has to wait for the writer instead of dropping
+    std::vector<std::pair<const char*, const char*>> settings = {
+        { "LRS_RECORD_QUEUE_MB", "1" }, { "LRS_RECORD_QUEUE_POLICY", "block" }, { "LRS_RECORD_COMPRESSION_THREADS", "2" } };
+    for (auto&& setting : settings)
+    {
+#ifdef _WIN32
+        _putenv_s(setting.first, setting.second);
+#else
+        setenv(setting.first, setting.second, 1);
+#endif
+    }
+
+    // Frames refer to the pixels until they are written
+    std::vector<std::vector<uint8_t>> pixels(frames, std::vector<uint8_t>(W * H * BPP));
+    rs2::syncer sync;
+    {
+        recorder recorder(filename, dev);
+        sensor.open(depth_stream_profile);
+        sensor.start(sync);
+        for (int i = 0; i < frames; i++)
+        {
+            for (size_t k = 0; k < pixels[i].size(); k++)
+                pixels[i][k] = uint8_t(k / W + i);
+            rs2_software_video_frame video_frame = { pixels[i].data(), [](void*) {}, W*BPP, BPP, 10000. + i * 16, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth_stream_profile };
+            sensor.on_video_frame(video_frame);
+        }
+    }
+
+    for (auto&& setting : settings)
+    {
+#ifdef _WIN32
+        _putenv_s(setting.first, "");
+#else
+        unsetenv(setting.first);
+#endif
+    }
+
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+    auto player_dev = ctx.load_device(filename);
+    auto profile = player_dev.query_sensors()[0].get_stream_profiles()[0];
+    REQUIRE(player_dev.get_frames_count(profile) == frames);
+    for (int i = 0; i < frames; i++)
+    {
+        CAPTURE(i);
+        auto f = player_dev.get_frame(profile, i);
+        REQUIRE(f.get_frame_number() == i);
+        auto data = static_cast<const uint8_t*>(f.get_data());
+        REQUIRE(data[0] == uint8_t(i));
+        REQUIRE(data[W * BPP * (H - 1)] == uint8_t((W * BPP * (H - 1)) / W + i));
+    }
+}
+
+TEST_CASE("Playback random access by frame index", "[software-device][record][!mayfail]")
+{
+    const int W = 64;
+    const int H = 48;
+    const int BPP = 2;
+    const int frames = 50;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "recording_frame_index.bag";
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor("Synthetic");
+    rs2_intrinsics depth_intrinsics = { W, H, (float)W / 2, H / 2, (float)W, (float)H,
+        RS2_DISTORTION_BROWN_CONRADY ,{ 0,0,0,0,0 } };
+    rs2_video_stream video_stream = { RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, depth_intrinsics };
+    auto depth_stream_profile = sensor.add_video_stream(video_stream);
+
+    // Frames refer to the pixels until they are written
+    std::vector<std::vector<uint8_t>> pixels(frames);
+    rs2::syncer sync;
+    {
+        recorder recorder(filename, dev);
+        sensor.open(depth_stream_profile);
+        sensor.start(sync);
+        for (int i = 0; i < frames; i++)
+        {
+            pixels[i].assign(W * H * BPP, uint8_t(i));
+            rs2_software_video_frame video_frame = { pixels[i].data(), [](void*) {}, W*BPP, BPP, 10000. + i * 16, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 100 + 2 * i, depth_stream_profile };
+            sensor.on_video_frame(video_frame);
+        }
+    }
+
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+    auto player_dev = ctx.load_device(filename);
+    auto profile = player_dev.query_sensors()[0].get_stream_profiles()[0];
+
+    // Frames are read without streaming, in any order
+    REQUIRE(player_dev.get_frames_count(profile) == frames);
+    for (int i : { 0, frames - 1, 17, 3, 17 })
+    {
+        CAPTURE(i);
+        rs2::frame f;
+        REQUIRE_NOTHROW(f = player_dev.get_frame(profile, i));
+        REQUIRE(f.get_frame_number() == 100 + 2 * i);
+        REQUIRE(f.get_profile().stream_type() == RS2_STREAM_DEPTH);
+        REQUIRE(static_cast<const uint8_t*>(f.get_data())[0] == uint8_t(i));
+        REQUIRE(player_dev.find_frame(profile, f.get_frame_number()) == uint64_t(i));
+    }
+    REQUIRE_THROWS(player_dev.get_frame(profile, frames));
+    REQUIRE_THROWS(player_dev.find_frame(profile, 101));
+    REQUIRE(player_dev.get_position() == 0);
+}
+
+TEST_CASE("Playback of an uncompressed recording through a file mapping", "[software-device][record][!mayfail]")
+{
+    const int W = 64;
+    const int H = 48;
+    const int BPP = 2;
+    const int frames = 30;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "recording_mapped.bag";
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor("Synthetic");
+    rs2_intrinsics depth_intrinsics = { W, H, (float)W / 2, H / 2, (float)W, (float)H,
+        RS2_DISTORTION_BROWN_CONRADY ,{ 0,0,0,0,0 } };
+    rs2_video_stream video_stream = { RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, depth_intrinsics };
+    auto depth_stream_profile = sensor.add_video_stream(video_stream);
+
+    // Frames refer to the pixels until they are written
+    std::vector<std::vector<uint8_t>> pixels(frames);
+    rs2::syncer sync;
+    {
+        recorder recorder(filename, dev, false);
+        sensor.open(depth_stream_profile);
+        sensor.start(sync);
+        for (int i = 0; i < frames; i++)
+        {
+            pixels[i].resize(W * H * BPP);
+            for (size_t k = 0; k < pixels[i].size(); k++)
+                pixels[i][k] = uint8_t(k + i);
+            rs2_software_video_frame video_frame = { pixels[i].data(), [](void*) {}, W*BPP, BPP, 10000. + i * 16, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth_stream_profile };
+            sensor.on_video_frame(video_frame);
+        }
+    }
+
+#ifdef _WIN32
+    _putenv_s("LRS_PLAYBACK_MMAP", "1");
+#else
+    setenv("LRS_PLAYBACK_MMAP", "1", 1);
+#endif
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+    std::vector<rs2::frame> kept;
+    {
+        auto player_dev = ctx.load_device(filename);
+#ifdef _WIN32
+        _putenv_s("LRS_PLAYBACK_MMAP", "");
+#else
+        unsetenv("LRS_PLAYBACK_MMAP");
+#endif
+        auto profile = player_dev.query_sensors()[0].get_stream_profiles()[0];
+        REQUIRE(player_dev.get_frames_count(profile) == frames);
+        for (int i = 0; i < frames; i++)
+            kept.push_back(player_dev.get_frame(profile, i));
+    }
+
+    // The frames keep the mapping once the file was closed
+    for (int i = 0; i < frames; i++)
+    {
+        CAPTURE(i);
+        auto f = kept[i].as<rs2::video_frame>();
+        REQUIRE(f.get_frame_number() == i);
+        REQUIRE(f.get_width() == W);
+        REQUIRE(f.get_data_size() == W * H * BPP);
+        REQUIRE(memcmp(f.get_data(), pixels[i].data(), pixels[i].size()) == 0);
+    }
+}
+
+TEST_CASE("Pointcloud of images played through a file mapping", "[software-device][record][!mayfail]")
+{
+    // Odd dimensions shift the offset of every image in the file, so that some of them are not 16 bytes aligned
+    const int W = 321;
+    const int H = 241;
+    const int BPP = 2;
+    const int frames = 32;
+
+    std::string folder_name = get_folder_path(special_folder::temp_folder);
+    const std::string filename = folder_name + "recording_mapped_unaligned.bag";
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor("Synthetic");
+    rs2_intrinsics depth_intrinsics = { W, H, (float)W / 2, H / 2, (float)W, (float)H,
+        RS2_DISTORTION_BROWN_CONRADY ,{ 0,0,0,0,0 } };
+    rs2_video_stream video_stream = { RS2_STREAM_DEPTH, 0, 0, W, H, 60, BPP, RS2_FORMAT_Z16, depth_intrinsics };
+    auto depth_stream_profile = sensor.add_video_stream(video_stream);
+    sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+
+    std::vector<std::vector<uint16_t>> pixels(frames);
+    rs2::syncer sync;
+    {
+        recorder recorder(filename, dev, false);
+        sensor.open(depth_stream_profile);
+        sensor.start(sync);
+        for (int i = 0; i < frames; i++)
+        {
+            pixels[i].resize(W * H);
+            for (size_t k = 0; k < pixels[i].size(); k++)
+                pixels[i][k] = uint16_t(500 + (k + i) % 1000);
+            rs2_software_video_frame video_frame = { pixels[i].data(), [](void*) {}, W*BPP, BPP, 10000. + i * 16, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth_stream_profile };
+            sensor.on_video_frame(video_frame);
+        }
+    }
+
+#ifdef _WIN32
+    _putenv_s("LRS_PLAYBACK_MMAP", "1");
+#else
+    setenv("LRS_PLAYBACK_MMAP", "1", 1);
+#endif
+    rs2::context ctx;
+    if (!make_context(SECTION_FROM_TEST_NAME, &ctx))
+        return;
+    auto player_dev = ctx.load_device(filename);
+#ifdef _WIN32
+    _putenv_s("LRS_PLAYBACK_MMAP", "");
+#else
+    unsetenv("LRS_PLAYBACK_MMAP");
+#endif
+    auto profile = player_dev.query_sensors()[0].get_stream_profiles()[0];
+    REQUIRE(player_dev.get_frames_count(profile) == frames);
+
+    // Images that are not aligned in the file are copied, the SSE pointcloud reads every one of them
+    rs2::pointcloud pc;
+    for (int i = 0; i < frames; i++)
+    {
+        CAPTURE(i);
+        auto f = player_dev.get_frame(profile, i).as<rs2::depth_frame>();
+        REQUIRE(f);
+        REQUIRE(reinterpret_cast<uintptr_t>(f.get_data()) % 16 == 0);
+        REQUIRE(memcmp(f.get_data(), pixels[i].data(), pixels[i].size() * BPP) == 0);
+
+        rs2::points points;
+        REQUIRE_NOTHROW(points = pc.calculate(f));
+        REQUIRE(points.size() == W * H);
+        REQUIRE(points.get_vertices()[0].z > 0.f);
+    }
+}
+
 void compare(filter first, filter second)
 {
     CAPTURE(first.get_info(RS2_CAMERA_INFO_NAME));
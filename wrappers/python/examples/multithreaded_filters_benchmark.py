@@ -0,0 +1,106 @@
+## License: Apache 2.0. See LICENSE file in root directory.
+## Copyright(c) 2020 Intel Corporation. All Rights Reserved.
+
+#####################################################
+##     Multi-threaded post-processing throughput   ##
+#####################################################
+
+# Runs a chain of post-processing filters over synthetic depth frames on an increasing number of
+# Python threads. The filters release the GIL while they process, so the throughput should grow with
+# the number of threads (up to the number of cores), and plain Python code keeps running meanwhile.
+
+import sys
+import threading
+import time
+import numpy as np
+import pyrealsense2 as rs
+
+WIDTH, HEIGHT, FRAMES = 848, 480, 30
+DURATION = 3  # seconds per measurement
+
+
+def generate_frames():
+    dev = rs.software_device()
+    sensor = dev.add_sensor("Depth")
+    sensor.add_read_only_option(rs.option.depth_units, 0.001)
+
+    intrinsics = rs.intrinsics()
+    intrinsics.width, intrinsics.height = WIDTH, HEIGHT
+    intrinsics.ppx, intrinsics.ppy = WIDTH / 2, HEIGHT / 2
+    intrinsics.fx = intrinsics.fy = WIDTH * 0.9
+    intrinsics.model = rs.distortion.brown_conrady
+
+    stream = rs.video_stream()
+    stream.type = rs.stream.depth
+    stream.index, stream.uid = 0, 0
+    stream.width, stream.height, stream.fps, stream.bpp = WIDTH, HEIGHT, 30, 2
+    stream.fmt = rs.format.z16
+    stream.intrinsics = intrinsics
+    profile = sensor.add_video_stream(stream)
+
+    queue = rs.frame_queue(FRAMES, keep_frames=True)
+    sensor.open(profile)
+    sensor.start(queue)
+
+    # Slanted planes with noise and missing pixels, different in every frame
+    rng = np.random.RandomState(0)
+    x, y = np.meshgrid(np.arange(WIDTH), np.arange(HEIGHT))
+    plane = 800 + 600 * x // WIDTH + 200 * y // HEIGHT
+    for i in range(FRAMES):
+        depth = plane + rng.randint(-5, 6, plane.shape)
+        depth[rng.randint(0, 100, plane.shape) < 3] = 0
+        frame = rs.software_video_frame()
+        frame.pixels = depth.astype(np.uint16)
+        frame.stride, frame.bpp = WIDTH * 2, 2
+        frame.timestamp = i * 1000.0 / 30
+        frame.domain = rs.timestamp_domain.hardware_clock
+        frame.frame_number = i
+        frame.profile = profile.as_video_stream_profile()
+        sensor.on_video_frame(frame)
+
+    frames = [queue.wait_for_frame() for _ in range(FRAMES)]
+    sensor.stop()
+    sensor.close()
+    return frames
+
+
+def measure(frames, threads):
+    stop = threading.Event()
+    counts = [0] * threads
+    python_iterations = [0]
+
+    def worker(n):
+        # Filters keep state between frames, each thread has its own chain
+        chain = [rs.decimation_filter(), rs.spatial_filter(), rs.temporal_filter(), rs.hole_filling_filter()]
+        i = 0
+        while not stop.is_set():
+            frame = frames[i % len(frames)]
+            for f in chain:
+                frame = f.process(frame)
+            counts[n] += 1
+            i += 1
+
+    def python_work():
+        while not stop.is_set():
+            python_iterations[0] += 1
+
+    workers = [threading.Thread(target=worker, args=(n,)) for n in range(threads)]
+    workers.append(threading.Thread(target=python_work))
+    for t in workers:
+        t.start()
+    time.sleep(DURATION)
+    stop.set()
+    for t in workers:
+        t.join()
+    return sum(counts) / DURATION, python_iterations[0] / DURATION
+
+
+frames = generate_frames()
+max_threads = int(sys.argv[1]) if len(sys.argv) > 1 else 4
+
+print("threads  frames/s  speedup  python loop iterations/s")
+baseline = None
+for threads in range(1, max_threads + 1):
+    fps, python_rate = measure(frames, threads)
+    baseline = baseline or fps
+    print("%7d  %8.1f  %6.2fx  %24.0f" % (threads, fps, fps / baseline, python_rate))
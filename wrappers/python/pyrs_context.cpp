@@ -19,7 +19,7 @@ void init_context(py::module &m) {
     py::class_<rs2::context> context(m, "context", "Librealsense context class. Includes realsense API version.");
     context.def(py::init<>())
         .def("query_devices", (rs2::device_list(rs2::context::*)() const) &rs2::context::query_devices, "Create a static"
-             " snapshot of all connected devices at the time of the call.")
+             " snapshot of all connected devices at the time of the call.", py::call_guard<py::gil_scoped_release>())
         .def_property_readonly("devices", (rs2::device_list(rs2::context::*)() const) &rs2::context::query_devices,
                                "A static snapshot of all connected devices at time of access. Identical to calling query_devices.")
         .def("query_all_sensors", &rs2::context::query_all_sensors, "Generate a flat list of "
@@ -27,12 +27,12 @@ void init_context(py::module &m) {
         .def_property_readonly("sensors", &rs2::context::query_all_sensors, "A flat list of "
                                "all available sensors from all RealSense devices. Identical to calling query_all_sensors.")
         .def("get_sensor_parent", &rs2::context::get_sensor_parent, "s"_a) // no docstring in C++
-        .def("set_devices_changed_callback", [](rs2::context& self, std::function<void(rs2::event_information)> &callback) {
-            self.set_devices_changed_callback(callback);
+        .def("set_devices_changed_callback", [](rs2::context& self, std::function<void(rs2::event_information)> callback) {
+            self.set_devices_changed_callback(gil_safe(std::move(callback)));
         }, "Register devices changed callback.", "callback"_a)
         .def("load_device", &rs2::context::load_device, "Creates a devices from a RealSense file.\n"
              "On successful load, the device will be appended to the context and a devices_changed event triggered.",
-             "filename"_a)
+             "filename"_a, py::call_guard<py::gil_scoped_release>())
         .def("unload_device", &rs2::context::unload_device, "filename"_a) // No docstring in C++
         .def("unload_tracking_module", &rs2::context::unload_tracking_module); // No docstring in C++
 
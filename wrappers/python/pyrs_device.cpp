@@ -21,7 +21,7 @@ void init_device(py::module &m) {
         .def("supports", &rs2::device::supports, "Check if specific camera info is supported.", "info"_a)
         .def("get_info", &rs2::device::get_info, "Retrieve camera specific information, "
              "like versions of various internal components", "info"_a)
-        .def("hardware_reset", &rs2::device::hardware_reset, "Send hardware reset request to the device")
+        .def("hardware_reset", &rs2::device::hardware_reset, "Send hardware reset request to the device", py::call_guard<py::gil_scoped_release>())
         .def(py::init<>())
         .def("__nonzero__", &rs2::device::operator bool)
         .def(BIND_DOWNCAST(device, debug_protocol))
@@ -31,6 +31,7 @@ void init_device(py::module &m) {
         .def(BIND_DOWNCAST(device, updatable))
         .def(BIND_DOWNCAST(device, update_device))
         .def(BIND_DOWNCAST(device, auto_calibrated_device))
+        .def(BIND_DOWNCAST(device, global_timer))
         .def("__repr__", [](const rs2::device &self) {
             std::stringstream ss;
             ss << "<" SNAME ".device: " << self.get_info(RS2_CAMERA_INFO_NAME)
@@ -47,14 +48,14 @@ void init_device(py::module &m) {
         .def("create_flash_backup", (std::vector<uint8_t>(rs2::updatable::*)() const) &rs2::updatable::create_flash_backup,
              "Create backup of camera flash memory. Such backup does not constitute valid firmware image, and cannot be "
              "loaded back to the device, but it does contain all calibration and device information.", py::call_guard<py::gil_scoped_release>())
-        .def("create_flash_backup", [](rs2::updatable& self, std::function<void(float)> f) { return self.create_flash_backup(f); },
+        .def("create_flash_backup", [](rs2::updatable& self, std::function<void(float)> f) { return self.create_flash_backup(gil_safe(std::move(f))); },
              "Create backup of camera flash memory. Such backup does not constitute valid firmware image, and cannot be "
              "loaded back to the device, but it does contain all calibration and device information.",
              "callback"_a, py::call_guard<py::gil_scoped_release>())
         .def("update_unsigned", (void(rs2::updatable::*)(const std::vector<uint8_t>&, int) const) &rs2::updatable::update_unsigned,
              "Update an updatable device to the provided unsigned firmware. This call is executed on the caller's thread.", "fw_image"_a,
              "update_mode"_a = RS2_UNSIGNED_UPDATE_MODE_UPDATE, py::call_guard<py::gil_scoped_release>())
-        .def("update_unsigned", [](rs2::updatable& self, const std::vector<uint8_t>& fw_image, std::function<void(float)> f, int update_mode) { return self.update_unsigned(fw_image, f, update_mode); },
+        .def("update_unsigned", [](rs2::updatable& self, const std::vector<uint8_t>& fw_image, std::function<void(float)> f, int update_mode) { return self.update_unsigned(fw_image, gil_safe(std::move(f)), update_mode); },
              "Update an updatable device to the provided unsigned firmware. This call is executed on the caller's thread and it supports progress notifications via the callback.",
              "fw_image"_a, "callback"_a, "update_mode"_a = RS2_UNSIGNED_UPDATE_MODE_UPDATE, py::call_guard<py::gil_scoped_release>());
 
@@ -62,7 +63,7 @@ void init_device(py::module &m) {
     update_device.def(py::init<rs2::device>())
         .def("update", [](rs2::update_device& self, const std::vector<uint8_t>& fw_image) { return self.update(fw_image); },
              "Update an updatable device to the provided firmware. This call is executed on the caller's thread.", "fw_image"_a, py::call_guard<py::gil_scoped_release>())
-        .def("update", [](rs2::update_device& self, const std::vector<uint8_t>& fw_image, std::function<void(float)> f) { return self.update(fw_image, f); },
+        .def("update", [](rs2::update_device& self, const std::vector<uint8_t>& fw_image, std::function<void(float)> f) { return self.update(fw_image, gil_safe(std::move(f))); },
              "Update an updatable device to the provided firmware. This call is executed on the caller's thread and it supports progress notifications via the callback.",
              "fw_image"_a, "callback"_a, py::call_guard<py::gil_scoped_release>());
 
@@ -77,7 +78,7 @@ void init_device(py::module &m) {
         .def("run_on_chip_calibration", [](rs2::auto_calibrated_device& self, std::string json_content, std::function<void(float)> f, int timeout_ms)
         {
             float health;
-            return py::make_tuple(self.run_on_chip_calibration(json_content, &health, f, timeout_ms), health);
+            return py::make_tuple(self.run_on_chip_calibration(json_content, &health, gil_safe(std::move(f)), timeout_ms), health);
         },"This will improve the depth noise (plane fit RMS). This call is executed on the caller's thread and it supports progress notifications via the callback.", "json_content"_a, "callback"_a, "timeout_ms"_a, py::call_guard<py::gil_scoped_release>())
         .def("run_tare_calibration", [](const rs2::auto_calibrated_device& self, float ground_truth_mm, std::string json_content, int timeout_ms)
         {
@@ -85,13 +86,29 @@ void init_device(py::module &m) {
         }, "This will adjust camera absolute distance to flat target. This call is executed on the caller's thread and it supports progress notifications via the callback.", "ground_truth_mm"_a, "json_content"_a, "timeout_ms"_a, py::call_guard<py::gil_scoped_release>())
         .def("run_tare_calibration", [](const rs2::auto_calibrated_device& self, float ground_truth_mm, std::string json_content, std::function<void(float)> callback, int timeout_ms)
         {
-            return self.run_tare_calibration(ground_truth_mm, json_content, callback, timeout_ms);
+            return self.run_tare_calibration(ground_truth_mm, json_content, gil_safe(std::move(callback)), timeout_ms);
         }, "This will adjust camera absolute distance to flat target. This call is executed on the caller's thread.", "ground_truth_mm"_a, "json_content"_a, "callback"_a, "timeout_ms"_a, py::call_guard<py::gil_scoped_release>())
         .def("get_calibration_table", &rs2::auto_calibrated_device::get_calibration_table, "Read current calibration table from flash.")
         .def("set_calibration_table", &rs2::auto_calibrated_device::set_calibration_table, "Set current table to dynamic area.")
         .def("reset_to_factory_calibration", &rs2::auto_calibrated_device::reset_to_factory_calibration, "Reset device to factory calibration.");
 
 
+    py::class_<rs2_global_time_stats> global_time_stats(m, "global_time_stats", "Quality of the synchronization of a device clock to the host clock.");
+    global_time_stats.def(py::init<>())
+        .def_readonly("updates", &rs2_global_time_stats::updates, "Number of device clock samples taken since the device was opened")
+        .def_readonly("failures", &rs2_global_time_stats::failures, "Number of device clock samples that failed or took too long, and were skipped")
+        .def_readonly("resets", &rs2_global_time_stats::resets, "Number of times the device clock wrapped around and the fit was restarted")
+        .def_readonly("samples", &rs2_global_time_stats::samples, "Number of recent samples the linear fit is currently based on")
+        .def_readonly("drift_ppm", &rs2_global_time_stats::drift_ppm, "Drift of the device clock relative to the host clock, in parts per million")
+        .def_readonly("offset", &rs2_global_time_stats::offset, "Host time minus device time at the last sample, in milliseconds")
+        .def_readonly("residual", &rs2_global_time_stats::residual, "Host time at the last sample minus the host time the fit predicted for it, in milliseconds")
+        .def_readonly("last_update", &rs2_global_time_stats::last_update, "Host time of the last sample, in milliseconds since the epoch, 0 before the first one");
+
+    py::class_<rs2::global_timer, rs2::device> global_timer(m, "global_timer");
+    global_timer.def(py::init<rs2::device>(), "device"_a)
+        .def("get_global_time_stats", &rs2::global_timer::get_global_time_stats, "Statistics of the synchronization of the device clock to the host clock, "
+             "for monitoring the quality of global timestamps.");
+
     py::class_<rs2::debug_protocol> debug_protocol(m, "debug_protocol"); // No docstring in C++
     debug_protocol.def(py::init<rs2::device>())
         .def("send_and_receive_raw_data", &rs2::debug_protocol::send_and_receive_raw_data,
@@ -102,7 +102,7 @@ void init_frame(py::module &m) {
     pose_stream_profile.def(py::init<const rs2::stream_profile&>(), "sp"_a);
 
     py::class_<rs2::filter_interface> filter_interface(m, "filter_interface", "Interface for frame filtering functionality");
-    filter_interface.def("process", &rs2::filter_interface::process, "frame"_a); // No docstring in C++
+    filter_interface.def("process", &rs2::filter_interface::process, "frame"_a, py::call_guard<py::gil_scoped_release>()); // No docstring in C++
 
     py::class_<rs2::frame> frame(m, "frame", "Base class for multiple frame extensions");
     frame.def(py::init<>())
@@ -116,6 +116,7 @@ void init_frame(py::module &m) {
         .def_property_readonly("frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "The timestamp domain. Identical to calling get_frame_timestamp_domain.")
         .def("get_frame_metadata", &rs2::frame::get_frame_metadata, "Retrieve the current value of a single frame_metadata.", "frame_metadata"_a)
         .def("supports_frame_metadata", &rs2::frame::supports_frame_metadata, "Determine if the device allows a specific metadata to be queried.", "frame_metadata"_a)
+        .def("get_all_metadata", &rs2::frame::get_all_metadata, "Retrieve all the frame_metadata the frame supports, as a list of (frame_metadata, value) pairs.")
         .def("get_frame_number", &rs2::frame::get_frame_number, "Retrieve the frame number.")
         .def_property_readonly("frame_number", &rs2::frame::get_frame_number, "The frame number. Identical to calling get_frame_number.")
         .def("get_data_size", &rs2::frame::get_data_size, "Retrieve data size from frame handle.")
@@ -202,7 +203,13 @@ void init_frame(py::module &m) {
                 throw std::domain_error("dims arg only supports values of 1, 2 or 3");
             }
         }, "Retrieve the texture coordinates (uv map) for the point cloud", py::keep_alive<0, 1>(), "dims"_a=1)
-        .def("export_to_ply", &rs2::points::export_to_ply, "Export the point cloud to a PLY file")
+        .def("export_to_ply", (void (rs2::points::*)(const std::string&, rs2::video_frame)) &rs2::points::export_to_ply, "Export the point cloud to a PLY file", py::call_guard<py::gil_scoped_release>())
+        .def("export_to_ply", [](rs2::points& self, const std::string& fname, rs2::video_frame texture, bool mesh, bool normals, bool parallel, float threshold) {
+            int flags = (mesh ? RS2_PLY_EXPORT_MESH : 0) | (normals ? RS2_PLY_EXPORT_NORMALS : 0) | (parallel ? RS2_PLY_EXPORT_PARALLEL : 0);
+            self.export_to_ply(fname, texture, flags, threshold);
+        }, "Export the point cloud to a binary PLY file, with a mesh of neighbouring vertices of similar depth (up to threshold meters apart) "
+           "and per-vertex normals as requested. An empty frame as texture exports the vertices without color.",
+           "fname"_a, "texture"_a, "mesh"_a = true, "normals"_a = false, "parallel"_a = false, "threshold"_a = 0.05f, py::call_guard<py::gil_scoped_release>())
         .def("size", &rs2::points::size); // No docstring in C++
 
     py::class_<rs2::depth_frame, rs2::video_frame> depth_frame(m, "depth_frame", "Extends the video_frame class with additional depth related attributes and functions.");
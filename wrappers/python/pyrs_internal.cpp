@@ -117,17 +117,17 @@ void init_internal(py::module &m) {
     
     /** rs_internal.hpp **/
     // rs2::software_sensor
-    py::class_<rs2::software_sensor> software_sensor(m, "software_sensor");
+    py::class_<rs2::software_sensor, rs2::sensor> software_sensor(m, "software_sensor");
     software_sensor.def("add_video_stream", &rs2::software_sensor::add_video_stream, "Add video stream to software sensor",
                         "video_stream"_a, "is_default"_a=false)
         .def("add_motion_stream", &rs2::software_sensor::add_motion_stream, "Add motion stream to software sensor",
             "motion_stream"_a, "is_default"_a = false)
         .def("add_pose_stream", &rs2::software_sensor::add_pose_stream, "Add pose stream to software sensor",
             "pose_stream"_a, "is_default"_a = false)
-        .def("on_video_frame", &rs2::software_sensor::on_video_frame, "Inject video frame into the sensor", "frame"_a)
-        .def("on_motion_frame", &rs2::software_sensor::on_motion_frame, "Inject motion frame into the sensor", "frame"_a)
-        .def("on_pose_frame", &rs2::software_sensor::on_pose_frame, "Inject pose frame into the sensor", "frame"_a)
-        .def("set_metadata", &rs2::software_sensor::set_metadata, "Set frame metadata for the upcoming frames", "value"_a, "type"_a)
+        .def("on_video_frame", &rs2::software_sensor::on_video_frame, "Inject video frame into the sensor", "frame"_a, py::call_guard<py::gil_scoped_release>())
+        .def("on_motion_frame", &rs2::software_sensor::on_motion_frame, "Inject motion frame into the sensor", "frame"_a, py::call_guard<py::gil_scoped_release>())
+        .def("on_pose_frame", &rs2::software_sensor::on_pose_frame, "Inject pose frame into the sensor", "frame"_a, py::call_guard<py::gil_scoped_release>())
+        .def("set_metadata", (void (rs2::software_sensor::*)(rs2_frame_metadata_value, rs2_metadata_type)) &rs2::software_sensor::set_metadata, "Set frame metadata for the upcoming frames", "value"_a, "type"_a)
         .def("add_read_only_option", &rs2::software_sensor::add_read_only_option, "Register read-only option that "
              "will be supported by the sensor", "option"_a, "val"_a)
         .def("set_read_only_option", &rs2::software_sensor::set_read_only_option, "Update value of registered "
@@ -141,7 +141,9 @@ void init_internal(py::module &m) {
     software_device.def(py::init<>())
         .def("add_sensor", &rs2::software_device::add_sensor, "Add software sensor with given name "
             "to the software device.", "name"_a)
-        .def("set_destruction_callback", &rs2::software_device::set_destruction_callback<std::function<void()>>,
+        .def("set_destruction_callback", [](rs2::software_device& self, std::function<void()> callback) {
+            self.set_destruction_callback(gil_safe(std::move(callback)));
+        },
              "Register destruction callback", "callback"_a)
         .def("add_to", &rs2::software_device::add_to, "Add software device to existing context.\n"
              "Any future queries on the context will return this device.\n"
@@ -76,7 +76,7 @@ void init_pipeline(py::module &m) {
              "The pipeline profile selection during start() follows the same method. Thus, the selected profile is the same, if no change occurs to the available devices."
              "Resolving the pipeline configuration provides the application access to the pipeline selected device for advanced control."
              "The returned configuration is not applied to the device, so the application doesn't own the device sensors. However, the application can call enable_device(), "
-             "to enforce the device returned by this method is selected by pipeline start(), and configure the device and sensors options or extensions before streaming starts.", "p"_a)
+             "to enforce the device returned by this method is selected by pipeline start(), and configure the device and sensors options or extensions before streaming starts.", "p"_a, py::call_guard<py::gil_scoped_release>())
         .def("can_resolve", [](rs2::config* c, pipeline_wrapper pw) -> bool { return c->can_resolve(pw._ptr); }, "Check if the config can resolve the configuration filters, "
              "to find a matching device and streams profiles. The resolution conditions are as described in resolve().", "p"_a);
     
@@ -92,7 +92,7 @@ void init_pipeline(py::module &m) {
              "blocks, according to each module requirements and threading model.\n"
              "During the loop execution, the application can access the camera streams by calling wait_for_frames() or poll_for_frames().\n"
              "The streaming loop runs until the pipeline is stopped.\n"
-             "Starting the pipeline is possible only when it is not started. If the pipeline was started, an exception is raised.\n")
+             "Starting the pipeline is possible only when it is not started. If the pipeline was started, an exception is raised.\n", py::call_guard<py::gil_scoped_release>())
         .def("start", (rs2::pipeline_profile(rs2::pipeline::*)(const rs2::config&)) &rs2::pipeline::start, "Start the pipeline streaming according to the configuraion.\n"
              "The pipeline streaming loop captures samples from the device, and delivers them to the attached computer vision modules and processing blocks, according to "
              "each module requirements and threading model.\n"
@@ -103,12 +103,12 @@ void init_pipeline(py::module &m) {
              "When the rs2::config is provided to the method, the pipeline tries to activate the config resolve() result.\n"
              "If the application requests are conflicting with pipeline computer vision modules or no matching device is available on the platform, the method fails.\n"
              "Available configurations and devices may change between config resolve() call and pipeline start, in case devices are connected or disconnected, or another "
-             "application acquires ownership of a device.", "config"_a)
-        .def("start", [](rs2::pipeline& self, std::function<void(rs2::frame)> f) { return self.start(f); }, "Start the pipeline streaming with its default configuration.\n"
+             "application acquires ownership of a device.", "config"_a, py::call_guard<py::gil_scoped_release>())
+        .def("start", [](rs2::pipeline& self, std::function<void(rs2::frame)> f) { return self.start(gil_safe(std::move(f))); }, "Start the pipeline streaming with its default configuration.\n"
              "The pipeline captures samples from the device, and delivers them to the provided frame callback.\n"
              "Starting the pipeline is possible only when it is not started. If the pipeline was started, an exception is raised.\n"
-             "When starting the pipeline with a callback both wait_for_frames() and poll_for_frames() will throw exception.", "callback"_a)
-        .def("start", [](rs2::pipeline& self, const rs2::config& config, std::function<void(rs2::frame)> f) { return self.start(config, f); }, "Start the pipeline streaming according to the configuraion.\n"
+             "When starting the pipeline with a callback both wait_for_frames() and poll_for_frames() will throw exception.", "callback"_a, py::call_guard<py::gil_scoped_release>())
+        .def("start", [](rs2::pipeline& self, const rs2::config& config, std::function<void(rs2::frame)> f) { return self.start(config, gil_safe(std::move(f))); }, "Start the pipeline streaming according to the configuraion.\n"
              "The pipeline captures samples from the device, and delivers them to the provided frame callback.\n"
              "Starting the pipeline is possible only when it is not started. If the pipeline was started, an exception is raised.\n"
              "When starting the pipeline with a callback both wait_for_frames() and poll_for_frames() will throw exception.\n"
@@ -116,11 +116,11 @@ void init_pipeline(py::module &m) {
              "When the rs2::config is provided to the method, the pipeline tries to activate the config resolve() result.\n"
              "If the application requests are conflicting with pipeline computer vision modules or no matching device is available on the platform, the method fails.\n"
              "Available configurations and devices may change between config resolve() call and pipeline start, in case devices are connected or disconnected, "
-             "or another application acquires ownership of a device.", "config"_a, "callback"_a)
+             "or another application acquires ownership of a device.", "config"_a, "callback"_a, py::call_guard<py::gil_scoped_release>())
         .def("start", [](rs2::pipeline& self, rs2::frame_queue& queue) { return self.start(queue); },"Start the pipeline streaming with its default configuration.\n"
              "The pipeline captures samples from the device, and delivers them to the provided frame queue.\n"
              "Starting the pipeline is possible only when it is not started. If the pipeline was started, an exception is raised.\n"
-             "When starting the pipeline with a callback both wait_for_frames() and poll_for_frames() will throw exception.", "queue"_a)
+             "When starting the pipeline with a callback both wait_for_frames() and poll_for_frames() will throw exception.", "queue"_a, py::call_guard<py::gil_scoped_release>())
         .def("start", [](rs2::pipeline& self, const rs2::config& config, rs2::frame_queue queue) { return self.start(config, queue); }, "Start the pipeline streaming according to the configuraion.\n"
             "The pipeline captures samples from the device, and delivers them to the provided frame queue.\n"
             "Starting the pipeline is possible only when it is not started. If the pipeline was started, an exception is raised.\n"
@@ -129,7 +129,7 @@ void init_pipeline(py::module &m) {
             "When the rs2::config is provided to the method, the pipeline tries to activate the config resolve() result.\n"
             "If the application requests are conflicting with pipeline computer vision modules or no matching device is available on the platform, the method fails.\n"
             "Available configurations and devices may change between config resolve() call and pipeline start, in case devices are connected or disconnected, "
-            "or another application acquires ownership of a device.", "config"_a, "queue"_a)
+            "or another application acquires ownership of a device.", "config"_a, "queue"_a, py::call_guard<py::gil_scoped_release>())
         .def("stop", &rs2::pipeline::stop, "Stop the pipeline streaming.\n"
              "The pipeline stops delivering samples to the attached computer vision modules and processing blocks, stops the device streaming and releases "
              "the device resources used by the pipeline. It is the application's responsibility to release any frame reference it owns.\n"
@@ -29,6 +29,18 @@ Copyright(c) 2017 Intel Corporation. All Rights Reserved. */
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+// Python callables handed to the library are copied, invoked and released on its own threads, where the GIL
+// may not be held (e.g. while a binding running with py::gil_scoped_release waits for them). The callable is
+// shared rather than copied, and only released once the GIL was acquired. Calling it acquires the GIL anyway.
+template<class R, class... Args>
+std::function<R(Args...)> gil_safe(std::function<R(Args...)> f)
+{
+    if (!f) return f;
+    std::shared_ptr<std::function<R(Args...)>> shared(new std::function<R(Args...)>(std::move(f)),
+        [](std::function<R(Args...)>* p) { py::gil_scoped_acquire gil; delete p; });
+    return [shared](Args... args) -> R { return (*shared)(std::forward<Args>(args)...); };
+}
+
 // Hacky little bit of half-functions to make .def(BIND_DOWNCAST) look nice for binding as/is functions
 #define BIND_DOWNCAST(class, downcast) "is_"#downcast, &rs2::class::is<rs2::downcast>).def("as_"#downcast, &rs2::class::as<rs2::downcast>
 